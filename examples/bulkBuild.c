@@ -0,0 +1,147 @@
+/*
+  Copyright (C) 2026, International Business Machines
+  Corporation and others.  All Rights Reserved.
+
+  This code is licensed under the terms of the Eclipse Public License (EPL).
+
+*/
+
+/* Compares building a large model through the "C" interface one column at
+   a time (Cbc_addCol) against the block methods (Cbc_addRows/Cbc_addCols)
+   and against Cbc_assignProblem, which adopts the caller's arrays.
+
+   Usage: bulkBuild [numberColumns] [nonzerosPerColumn]
+   Default is 10000000 columns with 3 nonzeros each and one row for every
+   ten columns. */
+
+#include "Cbc_C_Interface.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <assert.h>
+
+static double seconds(clock_t start)
+{
+  return ((double)(clock() - start)) / CLOCKS_PER_SEC;
+}
+
+/* row index of k'th nonzero in column - deterministic pseudo random */
+static int rowOf(int iColumn, int k, int numberRows)
+{
+  unsigned int x = (unsigned int)iColumn * 2654435761u + (unsigned int)k * 40503u;
+  return (int)(x % (unsigned int)numberRows);
+}
+
+int main(int argc, const char *argv[])
+{
+  int numberColumns = 10000000;
+  int perColumn = 3;
+  int numberRows, iColumn, k;
+  size_t numberElements, nameBytes, pos;
+  clock_t start;
+  double timeAddCol, timeBulk, timeAssign;
+  char name[32];
+  Cbc_Model *model;
+  CoinBigIndex *columnStart;
+  int *row;
+  double *element, *lower, *upper, *objective, *rowLower, *rowUpper;
+  char *isInteger, *columnNames;
+
+  if (argc > 1)
+    numberColumns = atoi(argv[1]);
+  if (argc > 2)
+    perColumn = atoi(argv[2]);
+  numberRows = numberColumns / 10 + 1;
+  if (perColumn > numberRows)
+    perColumn = numberRows;
+  numberElements = (size_t)numberColumns * perColumn;
+  printf("Building model with %d columns, %d rows and %lu elements\n",
+    numberColumns, numberRows, (unsigned long)numberElements);
+
+  /* caller side data - allocated so it can later be handed over */
+  columnStart = Cbc_newBigIndexArray(numberColumns + 1);
+  row = Cbc_newIntArray(numberElements);
+  element = Cbc_newDoubleArray(numberElements);
+  lower = Cbc_newDoubleArray(numberColumns);
+  upper = Cbc_newDoubleArray(numberColumns);
+  objective = Cbc_newDoubleArray(numberColumns);
+  rowLower = Cbc_newDoubleArray(numberRows);
+  rowUpper = Cbc_newDoubleArray(numberRows);
+  isInteger = (char *)malloc(numberColumns);
+  columnNames = (char *)malloc((size_t)numberColumns * 12);
+  nameBytes = 0;
+  columnStart[0] = 0;
+  for (iColumn = 0; iColumn < numberColumns; iColumn++) {
+    for (k = 0; k < perColumn; k++) {
+      /* avoid duplicates in column */
+      int iRow = (rowOf(iColumn, 0, numberRows) + k) % numberRows;
+      row[columnStart[iColumn] + k] = iRow;
+      element[columnStart[iColumn] + k] = 1.0 + (iColumn + k) % 7;
+    }
+    columnStart[iColumn + 1] = columnStart[iColumn] + perColumn;
+    lower[iColumn] = 0.0;
+    upper[iColumn] = 1.0;
+    objective[iColumn] = 1.0 + iColumn % 13;
+    isInteger[iColumn] = (char)(iColumn & 1);
+    nameBytes += sprintf(columnNames + nameBytes, "x%d", iColumn) + 1;
+  }
+  for (k = 0; k < numberRows; k++) {
+    rowLower[k] = 1.0;
+    rowUpper[k] = 1.0e30;
+  }
+
+  /* 1 - column by column */
+  model = Cbc_newModel();
+  start = clock();
+  for (k = 0; k < numberRows; k++) {
+    sprintf(name, "r%d", k);
+    Cbc_addRow(model, name, 0, NULL, NULL, 'G', 1.0);
+  }
+  pos = 0;
+  for (iColumn = 0; iColumn < numberColumns; iColumn++) {
+    Cbc_addCol(model, columnNames + pos, lower[iColumn], upper[iColumn],
+      objective[iColumn], isInteger[iColumn], perColumn,
+      row + columnStart[iColumn], element + columnStart[iColumn]);
+    pos += strlen(columnNames + pos) + 1;
+  }
+  /* forces buffers to be flushed */
+  Cbc_getVectorStarts(model);
+  timeAddCol = seconds(start);
+  assert(Cbc_getNumCols(model) == numberColumns);
+  Cbc_deleteModel(model);
+  printf("Cbc_addCol          %8.2f seconds\n", timeAddCol);
+
+  /* 2 - in blocks, arrays copied once */
+  model = Cbc_newModel();
+  start = clock();
+  {
+    CoinBigIndex *emptyStart = (CoinBigIndex *)calloc(numberRows + 1, sizeof(CoinBigIndex));
+    Cbc_addRows(model, numberRows, emptyStart, NULL, NULL, rowLower, rowUpper, NULL);
+    free(emptyStart);
+  }
+  Cbc_addCols(model, numberColumns, columnStart, row, element, lower, upper,
+    objective, isInteger, columnNames);
+  timeBulk = seconds(start);
+  assert(Cbc_getNumCols(model) == numberColumns);
+  assert(Cbc_getNumElements(model) == (int)numberElements);
+  Cbc_deleteModel(model);
+  printf("Cbc_addCols         %8.2f seconds (%.1f times faster)\n", timeBulk,
+    timeBulk > 0.0 ? timeAddCol / timeBulk : 0.0);
+
+  /* 3 - arrays adopted by model */
+  model = Cbc_newModel();
+  start = clock();
+  Cbc_assignProblem(model, numberColumns, numberRows, columnStart, row,
+    element, lower, upper, objective, rowLower, rowUpper, isInteger,
+    columnNames, NULL);
+  timeAssign = seconds(start);
+  assert(Cbc_getNumCols(model) == numberColumns);
+  Cbc_deleteModel(model);
+  printf("Cbc_assignProblem   %8.2f seconds (%.1f times faster)\n", timeAssign,
+    timeAssign > 0.0 ? timeAddCol / timeAssign : 0.0);
+
+  free(isInteger);
+  free(columnNames);
+  return 0;
+}
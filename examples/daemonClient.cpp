@@ -0,0 +1,165 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+/* Measures request latency against a running solver daemon, started with
+   e.g.
+
+     cbc -batchWorkers 4 -serve /tmp/cbc.sock
+
+   Usage: daemonClient socket model [numberRequests] [cbc options]
+
+   The model file is sent numberRequests times (default 100) one after
+   another over one connection and the time from sending the request to
+   receiving its result line is reported (mean, median, 99th percentile and
+   maximum).  Format is taken from the file name (.mps, .mps.gz, .lp or
+   .cbcb).  Does not link with Cbc at all. */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+
+static double wallTime()
+{
+  struct timeval now;
+  gettimeofday(&now, NULL);
+  return now.tv_sec + 1.0e-6 * now.tv_usec;
+}
+
+static bool sendAll(int socket, const char *data, size_t length)
+{
+  while (length) {
+    ssize_t n = send(socket, data, length, 0);
+    if (n <= 0)
+      return false;
+    data += n;
+    length -= n;
+  }
+  return true;
+}
+
+static bool readLine(int socket, std::string &buffer, std::string &line)
+{
+  while (true) {
+    size_t newline = buffer.find('\n');
+    if (newline != std::string::npos) {
+      line = buffer.substr(0, newline);
+      buffer.erase(0, newline + 1);
+      return true;
+    }
+    char chunk[4096];
+    ssize_t n = recv(socket, chunk, sizeof(chunk), 0);
+    if (n <= 0)
+      return false;
+    buffer.append(chunk, n);
+  }
+}
+
+static bool hasEnding(const std::string &value, const char *ending)
+{
+  size_t length = strlen(ending);
+  return value.size() >= length && !value.compare(value.size() - length, length, ending);
+}
+
+int main(int argc, const char *argv[])
+{
+  if (argc < 3) {
+    fprintf(stderr, "Usage: %s socket model [numberRequests] [cbc options]\n",
+      argv[0]);
+    return 1;
+  }
+  std::string modelName = argv[2];
+  int numberRequests = argc > 3 ? atoi(argv[3]) : 100;
+  if (numberRequests < 1)
+    numberRequests = 1;
+  std::string options;
+  for (int i = 4; i < argc; i++) {
+    options += " ";
+    options += argv[i];
+  }
+  const char *format = NULL;
+  if (hasEnding(modelName, ".mps.gz"))
+    format = "mps.gz";
+  else if (hasEnding(modelName, ".mps"))
+    format = "mps";
+  else if (hasEnding(modelName, ".lp"))
+    format = "lp";
+  else if (hasEnding(modelName, ".cbcb"))
+    format = "cbcb";
+  if (!format) {
+    fprintf(stderr, "Model must be .mps, .mps.gz, .lp or .cbcb\n");
+    return 1;
+  }
+  FILE *fp = fopen(modelName.c_str(), "rb");
+  if (!fp) {
+    fprintf(stderr, "Unable to open %s\n", modelName.c_str());
+    return 1;
+  }
+  std::string model;
+  char chunk[65536];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), fp)) > 0)
+    model.append(chunk, n);
+  fclose(fp);
+
+  int server = socket(AF_UNIX, SOCK_STREAM, 0);
+  struct sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  strncpy(address.sun_path, argv[1], sizeof(address.sun_path) - 1);
+  if (server < 0 || connect(server, reinterpret_cast< struct sockaddr * >(&address), sizeof(address))) {
+    fprintf(stderr, "Unable to connect to %s\n", argv[1]);
+    return 1;
+  }
+  char header[200];
+  sprintf(header, "solve %lu %s", static_cast< unsigned long >(model.size()),
+    format);
+  std::string request = header + options + "\n" + model;
+  std::vector< double > latency;
+  std::string buffer;
+  std::string line;
+  std::string lastResult;
+  for (int i = 0; i < numberRequests; i++) {
+    double start = wallTime();
+    if (!sendAll(server, request.data(), request.size())) {
+      fprintf(stderr, "Server went away\n");
+      return 1;
+    }
+    bool gotResult = false;
+    while (!gotResult && readLine(server, buffer, line)) {
+      if (!line.compare(0, 6, "result")) {
+        gotResult = true;
+        lastResult = line;
+      } else if (!line.compare(0, 5, "error")) {
+        fprintf(stderr, "%s\n", line.c_str());
+        return 1;
+      }
+    }
+    if (!gotResult) {
+      fprintf(stderr, "Server went away\n");
+      return 1;
+    }
+    latency.push_back(wallTime() - start);
+  }
+  close(server);
+  std::sort(latency.begin(), latency.end());
+  double sum = 0.0;
+  for (size_t i = 0; i < latency.size(); i++)
+    sum += latency[i];
+  size_t p99 = (99 * latency.size()) / 100;
+  if (p99 >= latency.size())
+    p99 = latency.size() - 1;
+  printf("%s\n", lastResult.c_str());
+  printf("%d requests - latency mean %.3f ms, median %.3f ms, p99 %.3f ms, max %.3f ms\n",
+    numberRequests, 1000.0 * sum / latency.size(),
+    1000.0 * latency[latency.size() / 2], 1000.0 * latency[p99],
+    1000.0 * latency.back());
+  return 0;
+}
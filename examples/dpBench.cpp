@@ -0,0 +1,101 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+
+#include "CoinPragma.hpp"
+#include "CoinModel.hpp"
+#include "CoinTime.hpp"
+#include "CbcModel.hpp"
+#include "OsiClpSolverInterface.hpp"
+#include "CbcFathomDynamicProgramming.hpp"
+
+/************************************************************************
+
+Times CbcFathomDynamicProgramming on random set partitioning models as the
+right hand side grows.  Every row must be covered exactly rhs times and
+each column covers a few rows once.  Each model is solved with dense
+states, sparse (hashed) states and sparse states with threads; for each
+the number of states, seconds and objective are printed.
+
+Usage: dpBench [numberRows [numberColumns [maxRhs [numberThreads]]]]
+
+Defaults are 10 rows, 80 columns, rhs up to 5 and 4 threads.  Each row
+takes enough bits for its rhs so from rhs 4 the dense state space is too
+big and "too big" is printed, while sparse states still work.
+
+************************************************************************/
+
+static void partitioning(OsiClpSolverInterface &solver, int numberRows,
+  int numberColumns, int rhs)
+{
+  CoinModel build;
+  srand(1234567);
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    build.setColumnBounds(iColumn, 0.0, 1.0);
+    build.setColumnIsInteger(iColumn, true);
+    int n = 0;
+    for (int iRow = 0; iRow < numberRows; iRow++) {
+      if (rand() % 4 == 0) {
+        build.setElement(iRow, iColumn, 1.0);
+        n++;
+      }
+    }
+    if (!n)
+      build.setElement(rand() % numberRows, iColumn, 1.0);
+    build.setColumnObjective(iColumn, 1 + rand() % 20 + 2 * n);
+  }
+  for (int iRow = 0; iRow < numberRows; iRow++)
+    build.setRowBounds(iRow, rhs, rhs);
+  solver.loadFromCoinModel(build);
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+    solver.setInteger(iColumn);
+}
+
+int main(int argc, const char *argv[])
+{
+  int numberRows = argc > 1 ? atoi(argv[1]) : 10;
+  int numberColumns = argc > 2 ? atoi(argv[2]) : 80;
+  int maxRhs = argc > 3 ? atoi(argv[3]) : 5;
+  int numberThreads = argc > 4 ? atoi(argv[4]) : 4;
+  const char *modeName[] = { "dense", "sparse", "threads" };
+  for (int rhs = 1; rhs <= maxRhs; rhs++) {
+    for (int mode = 0; mode < 3; mode++) {
+      OsiClpSolverInterface solver;
+      partitioning(solver, numberRows, numberColumns, rhs);
+      CbcModel model(solver);
+      model.messageHandler()->setLogLevel(0);
+      CbcFathomDynamicProgramming fathom(model);
+      fathom.setMaximumSize(100000000);
+      fathom.setStateMode(mode ? 2 : 1);
+      fathom.setNumberThreads(mode == 2 ? numberThreads : 1);
+      double *solution = NULL;
+      double time1 = CoinCpuTime();
+      double wall1 = CoinGetTimeOfDay();
+      int returnCode = fathom.fathom(solution);
+      double time2 = CoinCpuTime();
+      double wall2 = CoinGetTimeOfDay();
+      printf("rhs %d %-8s", rhs, modeName[mode]);
+      if (!returnCode) {
+        printf(" too big\n");
+        continue;
+      }
+      printf(" states %10d cpu %8.3f wall %8.3f", fathom.numberStates(),
+        time2 - time1, wall2 - wall1);
+      if (solution) {
+        const double *objective = model.solver()->getObjCoefficients();
+        double objValue = 0.0;
+        for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+          objValue += solution[iColumn] * objective[iColumn];
+        printf(" objective %g\n", objValue);
+        delete[] solution;
+      } else {
+        printf(" infeasible\n");
+      }
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,203 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <deque>
+
+#include "CoinPragma.hpp"
+#include "CoinModel.hpp"
+#include "CoinTime.hpp"
+#include "CbcModel.hpp"
+#include "OsiClpSolverInterface.hpp"
+#include "CbcSolver.hpp"
+
+/************************************************************************
+
+Compares search with and without symmetry handling (-orbit) on models with
+a lot of symmetry.  Node counts and times are printed for each setting and
+the log shows group size and time taken to find it.  If Cbc was built
+without nauty the built-in symmetry search is used.
+
+Usage: orbitalBench [file.mps ...]
+
+With no files two models are built here -
+
+  binpack - 16 items into identical bins (any permutation of bins is a
+            symmetry) minimizing number of bins used.  Assignment of items
+            to bins is a partitioning orbitope so "-orbit orbitope" fixes
+            variables to keep bins in lexicographic order.
+  sudoku  - 0-1 formulation of sudoku_sample.csv (as used by sudoku.cpp)
+            with a zero objective - the given values leave little symmetry
+            so this mainly shows the cost of detection.
+
+************************************************************************/
+
+static void binPacking(OsiClpSolverInterface &solver)
+{
+  const int numberItems = 16;
+  const int numberBins = 8;
+  const double capacity = 100.0;
+  const double weight[numberItems] = { 42, 63, 27, 51, 38, 19, 44, 71,
+    33, 58, 26, 47, 35, 29, 64, 22 };
+  CoinModel build;
+  // x(item,bin) then y(bin)
+  for (int i = 0; i < numberItems; i++) {
+    for (int j = 0; j < numberBins; j++) {
+      int iColumn = i * numberBins + j;
+      build.setColumnBounds(iColumn, 0.0, 1.0);
+      build.setColumnIsInteger(iColumn, true);
+    }
+  }
+  for (int j = 0; j < numberBins; j++) {
+    int iColumn = numberItems * numberBins + j;
+    build.setColumnBounds(iColumn, 0.0, 1.0);
+    build.setColumnIsInteger(iColumn, true);
+    build.setColumnObjective(iColumn, 1.0);
+  }
+  int iRow = 0;
+  // each item in one bin
+  for (int i = 0; i < numberItems; i++) {
+    for (int j = 0; j < numberBins; j++)
+      build.setElement(iRow, i * numberBins + j, 1.0);
+    build.setRowBounds(iRow, 1.0, 1.0);
+    iRow++;
+  }
+  // capacity if bin used
+  for (int j = 0; j < numberBins; j++) {
+    for (int i = 0; i < numberItems; i++)
+      build.setElement(iRow, i * numberBins + j, weight[i]);
+    build.setElement(iRow, numberItems * numberBins + j, -capacity);
+    build.setRowBounds(iRow, -COIN_DBL_MAX, 0.0);
+    iRow++;
+  }
+  solver.loadFromCoinModel(build);
+}
+
+// returns false if no sudoku_sample.csv
+static bool sudoku(OsiClpSolverInterface &solver)
+{
+  FILE *fp = fopen("sudoku_sample.csv", "r");
+  if (!fp)
+    fp = fopen("../../examples/sudoku_sample.csv", "r");
+  if (!fp)
+    return false;
+  int given[9][9];
+  memset(given, 0, sizeof(given));
+  char line[80];
+  for (int iRow = 0; iRow < 9 && fgets(line, sizeof(line), fp); iRow++) {
+    char *where = line;
+    for (int iColumn = 0; iColumn < 9; iColumn++) {
+      if (*where >= '1' && *where <= '9')
+        given[iRow][iColumn] = *where - '0';
+      while (*where && *where != ',')
+        where++;
+      if (*where)
+        where++;
+    }
+  }
+  fclose(fp);
+  CoinModel build;
+  // x(row,column,value) - value in 0..8
+  for (int i = 0; i < 729; i++) {
+    build.setColumnBounds(i, 0.0, 1.0);
+    build.setColumnIsInteger(i, true);
+  }
+  for (int iRow = 0; iRow < 9; iRow++) {
+    for (int iColumn = 0; iColumn < 9; iColumn++) {
+      if (given[iRow][iColumn])
+        build.setColumnBounds(iRow * 81 + iColumn * 9 + given[iRow][iColumn] - 1,
+          1.0, 1.0);
+    }
+  }
+  int row = 0;
+  // cell, row, column and box constraints
+  for (int type = 0; type < 4; type++) {
+    for (int a = 0; a < 9; a++) {
+      for (int b = 0; b < 9; b++) {
+        for (int c = 0; c < 9; c++) {
+          int iRow, iColumn, value;
+          if (type == 0) {
+            iRow = a;
+            iColumn = b;
+            value = c;
+          } else if (type == 1) {
+            iRow = a;
+            value = b;
+            iColumn = c;
+          } else if (type == 2) {
+            iColumn = a;
+            value = b;
+            iRow = c;
+          } else {
+            value = b;
+            iRow = 3 * (a / 3) + c / 3;
+            iColumn = 3 * (a % 3) + c % 3;
+          }
+          build.setElement(row, iRow * 81 + iColumn * 9 + value, 1.0);
+        }
+        build.setRowBounds(row, 1.0, 1.0);
+        row++;
+      }
+    }
+  }
+  solver.loadFromCoinModel(build);
+  return true;
+}
+
+static void solve(const char *name, const OsiClpSolverInterface &solver)
+{
+  const char *settings[] = { "off", "on", "strong", "orbitope" };
+  for (int i = 0; i < 4; i++) {
+    OsiClpSolverInterface copy(solver);
+    CbcModel model(copy);
+    CbcParameters parameters;
+    CbcMain0(model, parameters);
+    parameters.disableWelcomePrinting();
+    std::deque< std::string > inputQueue;
+    inputQueue.push_back("-log");
+    inputQueue.push_back("1");
+    inputQueue.push_back("-orbit");
+    inputQueue.push_back(settings[i]);
+    inputQueue.push_back("-solve");
+    inputQueue.push_back("-quit");
+    double time1 = CoinGetTimeOfDay();
+    CbcMain1(inputQueue, model, parameters);
+    double time2 = CoinGetTimeOfDay();
+    printf("%-12s orbit %-6s objective %12g nodes %8d seconds %8.2f %s\n",
+      name, settings[i], model.getObjValue(), model.getNodeCount(),
+      time2 - time1, model.isProvenOptimal() ? "optimal" : "not optimal");
+  }
+}
+
+int main(int argc, const char *argv[])
+{
+  if (argc > 1) {
+    for (int i = 1; i < argc; i++) {
+      OsiClpSolverInterface solver;
+      if (solver.readMps(argv[i], "") < 0) {
+        printf("Unable to read %s\n", argv[i]);
+        continue;
+      }
+      solve(argv[i], solver);
+    }
+    return 0;
+  }
+  {
+    OsiClpSolverInterface solver;
+    binPacking(solver);
+    solve("binpack", solver);
+  }
+  {
+    OsiClpSolverInterface solver;
+    if (sudoku(solver))
+      solve("sudoku", solver);
+    else
+      printf("sudoku_sample.csv not found - skipping sudoku\n");
+  }
+  return 0;
+}
@@ -0,0 +1,110 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "CoinPragma.hpp"
+#include "CoinTime.hpp"
+#include "CbcNode.hpp"
+#include "CbcTree.hpp"
+#include "CbcCompareActual.hpp"
+
+/************************************************************************
+
+Measures push/pop throughput of CbcTree on a synthetic tree, with nodes
+ordered by the comparison object (a virtual call per heap comparison) and
+by precomputed keys.
+
+Usage: treeBench [numberNodes]
+
+numberNodes (default 10000000) nodes with random objective, depth and
+number unsatisfied are created.  For each comparison (objective, default
+with a weight and default before a solution) and each ordering the nodes
+are all pushed and then all popped, and then a tree of a tenth of the size
+is kept while nodes are popped and pushed again.  Millions of operations
+per second are printed and the order of popped nodes is checked to be the
+same with and without keys.
+
+************************************************************************/
+
+static void run(const char *name, CbcCompareBase &compare,
+  std::vector< CbcNode > &nodes)
+{
+  int numberNodes = static_cast< int >(nodes.size());
+  std::vector< CbcNode * > order[2];
+  for (int useKeys = 0; useKeys < 2; useKeys++) {
+    CbcTree tree;
+    tree.setUseKeys(useKeys != 0);
+    tree.setComparison(compare);
+    double time1 = CoinCpuTime();
+    for (int i = 0; i < numberNodes; i++)
+      tree.push(&nodes[i]);
+    double time2 = CoinCpuTime();
+    order[useKeys].reserve(numberNodes);
+    while (!tree.empty()) {
+      order[useKeys].push_back(tree.top());
+      tree.pop();
+    }
+    double time3 = CoinCpuTime();
+    // steady state
+    int keep = numberNodes / 10;
+    for (int i = 0; i < keep; i++)
+      tree.push(&nodes[i]);
+    for (int i = keep; i < numberNodes; i++) {
+      tree.pop();
+      tree.push(&nodes[i]);
+    }
+    double time4 = CoinCpuTime();
+    while (!tree.empty())
+      tree.pop();
+    printf("%-10s %-5s push %7.2f pop %7.2f push+pop %7.2f Mops/s\n",
+      name, useKeys ? "keys" : "test",
+      1.0e-6 * numberNodes / CoinMax(time2 - time1, 1.0e-6),
+      1.0e-6 * numberNodes / CoinMax(time3 - time2, 1.0e-6),
+      2.0e-6 * (numberNodes - keep) / CoinMax(time4 - time3, 1.0e-6));
+    if (useKeys && !tree.usingKeys())
+      printf("%-10s comparison does not give keys\n", name);
+  }
+  bool same = true;
+  for (int i = 0; i < numberNodes; i++) {
+    if (order[0][i] != order[1][i]) {
+      same = false;
+      break;
+    }
+  }
+  if (!same)
+    printf("%-10s order differs with keys!\n", name);
+}
+
+int main(int argc, const char *argv[])
+{
+  int numberNodes = argc > 1 ? atoi(argv[1]) : 10000000;
+  std::vector< CbcNode > nodes(numberNodes);
+  srand(1234567);
+  for (int i = 0; i < numberNodes; i++) {
+    nodes[i].setObjectiveValue(100.0 + 0.01 * (rand() % 10000));
+    nodes[i].setDepth(rand() % 60);
+    nodes[i].setNumberUnsatisfied(rand() % 100);
+  }
+  // no node info so break ties on node number
+  {
+    CbcCompareObjective compare;
+    compare.sayThreaded();
+    run("objective", compare, nodes);
+  }
+  {
+    CbcCompareDefault compare(0.1);
+    compare.sayThreaded();
+    run("weighted", compare, nodes);
+  }
+  {
+    CbcCompareDefault compare(-1.0);
+    compare.sayThreaded();
+    run("unsat", compare, nodes);
+  }
+  return 0;
+}
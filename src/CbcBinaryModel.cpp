@@ -0,0 +1,836 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#pragma warning(disable : 4786)
+#endif
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+#define CBC_BINARY_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "CoinPragma.hpp"
+#include "CoinFinite.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "OsiSolverInterface.hpp"
+#include "CbcBinaryModel.hpp"
+
+#ifdef CBC_HAS_CLP
+#include "OsiClpSolverInterface.hpp"
+#endif
+
+namespace {
+
+const char binaryMagic[8] = { 'C', 'B', 'C', 'B', 'I', 'N', 'M', 0 };
+// Bump if layout changes - only the current version is read.
+// Version 2 includes the header in the checksum and keeps semicontinuous types
+const int binaryVersion = 2;
+const CoinUInt64 binaryByteOrder = 0x0102030405060708ULL;
+
+enum BinarySection {
+  secColumnStart = 0,
+  secRow,
+  secElement,
+  secColumnLower,
+  secColumnUpper,
+  secObjective,
+  secRowLower,
+  secRowUpper,
+  secIntegerType,
+  secSosStart,
+  secSosType,
+  secSosIndices,
+  secSosWeights,
+  secColumnNameStart,
+  secRowNameStart,
+  secNames,
+  secMipStart,
+  secPriorities,
+  numberBinarySections
+};
+
+/* Header - all fields fixed width so layout is the same for
+   32 and 64 bit builds.  Size is a multiple of 8. */
+struct BinaryHeader {
+  char magic[8];
+  int version;
+  int flags;
+  CoinUInt64 byteOrder;
+  int numberRows;
+  int numberColumns;
+  CoinInt64 numberElements;
+  int numberSOS;
+  int spare;
+  CoinInt64 numberSOSElements;
+  CoinInt64 nameBytes;
+  double objectiveSense;
+  double objectiveOffset;
+  CoinUInt64 offset[numberBinarySections];
+  CoinUInt64 size[numberBinarySections];
+  CoinUInt64 totalLength;
+  CoinUInt64 checksum;
+};
+
+/* Checksum of 64 bit words - a Fletcher style sum so one pass
+   over memory is all that is needed. */
+class BinaryChecksum {
+public:
+  BinaryChecksum()
+    : a_(0x9e3779b97f4a7c15ULL)
+    , b_(0)
+  {
+  }
+  // length must be a multiple of 8
+  void add(const char *data, size_t length)
+  {
+    assert(!(length & 7));
+    size_t n = length >> 3;
+    CoinUInt64 a = a_;
+    CoinUInt64 b = b_;
+    for (size_t i = 0; i < n; i++) {
+      CoinUInt64 word;
+      memcpy(&word, data + 8 * i, sizeof(word));
+      a += word;
+      b += a;
+    }
+    a_ = a;
+    b_ = b;
+  }
+  CoinUInt64 value() const
+  {
+    return a_ ^ (b_ * 0xff51afd7ed558ccdULL);
+  }
+
+private:
+  CoinUInt64 a_;
+  CoinUInt64 b_;
+};
+
+inline CoinUInt64 roundUp8(CoinUInt64 value)
+{
+  return (value + 7) & ~static_cast< CoinUInt64 >(7);
+}
+
+/* Buffered writer which keeps the checksum up to date and pads
+   each section to an 8 byte boundary. */
+class BinaryWriter {
+public:
+  BinaryWriter(FILE *fp)
+    : fp_(fp)
+    , used_(0)
+    , written_(0)
+    , bad_(false)
+  {
+  }
+  void append(const void *data, size_t length)
+  {
+    const char *put = reinterpret_cast< const char * >(data);
+    while (length) {
+      size_t n = CoinMin(length, sizeof(buffer_) - used_);
+      memcpy(buffer_ + used_, put, n);
+      used_ += n;
+      put += n;
+      length -= n;
+      if (used_ == sizeof(buffer_))
+        flush();
+    }
+  }
+  void pad()
+  {
+    static const char zero[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    size_t extra = static_cast< size_t >(roundUp8(written_ + used_) - (written_ + used_));
+    if (extra)
+      append(zero, extra);
+  }
+  void flush()
+  {
+    // only ever called with whole words (buffer size or after pad)
+    checksum_.add(buffer_, used_);
+    if (used_ && fwrite(buffer_, 1, used_, fp_) != used_)
+      bad_ = true;
+    written_ += used_;
+    used_ = 0;
+  }
+  CoinUInt64 position() const
+  {
+    return written_ + used_;
+  }
+  // adds header (with zero checksum) which is written separately
+  void addHeader(const BinaryHeader &header)
+  {
+    checksum_.add(reinterpret_cast< const char * >(&header), sizeof(header));
+  }
+  CoinUInt64 checksum() const
+  {
+    return checksum_.value();
+  }
+  bool bad() const
+  {
+    return bad_;
+  }
+
+private:
+  FILE *fp_;
+  char buffer_[1 << 16];
+  size_t used_;
+  CoinUInt64 written_;
+  BinaryChecksum checksum_;
+  bool bad_;
+};
+
+// Section sizes must be exactly what the counts in the header say
+bool sizesValid(const BinaryHeader *header, CoinUInt64 length)
+{
+  CoinInt64 numberRows = header->numberRows;
+  CoinInt64 numberColumns = header->numberColumns;
+  CoinInt64 numberSOS = header->numberSOS;
+  if (numberRows < 0 || numberColumns < 0 || numberSOS < 0
+    || header->numberElements < 0 || header->numberSOSElements < 0
+    || header->nameBytes < 0)
+    return false;
+  // stops multiplications below overflowing
+  if (static_cast< CoinUInt64 >(header->numberElements) > length
+    || static_cast< CoinUInt64 >(header->numberSOSElements) > length
+    || static_cast< CoinUInt64 >(header->nameBytes) > length)
+    return false;
+  const CoinUInt64 *size = header->size;
+  CoinUInt64 numberElements = header->numberElements;
+  CoinUInt64 numberSOSElements = header->numberSOSElements;
+  if (size[secColumnStart] != (numberColumns + 1) * sizeof(CoinInt64)
+    || size[secRow] != numberElements * sizeof(int)
+    || size[secElement] != numberElements * sizeof(double)
+    || size[secColumnLower] != numberColumns * sizeof(double)
+    || size[secColumnUpper] != numberColumns * sizeof(double)
+    || size[secObjective] != numberColumns * sizeof(double)
+    || size[secRowLower] != numberRows * sizeof(double)
+    || size[secRowUpper] != numberRows * sizeof(double)
+    || size[secIntegerType] != numberColumns * sizeof(char))
+    return false;
+  if (size[secSosStart] != (numberSOS ? (numberSOS + 1) * sizeof(int) : 0)
+    || size[secSosType] != numberSOS * sizeof(char)
+    || size[secSosIndices] != numberSOSElements * sizeof(int)
+    || size[secSosWeights] != numberSOSElements * sizeof(double))
+    return false;
+  if (header->nameBytes) {
+    if (size[secColumnNameStart] != numberColumns * sizeof(CoinInt64)
+      || size[secRowNameStart] != numberRows * sizeof(CoinInt64)
+      || size[secNames] != static_cast< CoinUInt64 >(header->nameBytes))
+      return false;
+  } else if (size[secColumnNameStart] || size[secRowNameStart] || size[secNames]) {
+    return false;
+  }
+  if (size[secMipStart] && size[secMipStart] != numberColumns * sizeof(double))
+    return false;
+  if (size[secPriorities] && size[secPriorities] != numberColumns * sizeof(int))
+    return false;
+  return true;
+}
+
+// Starts must run from 0 to end without going backwards
+template < class T >
+bool startsValid(const T *start, CoinInt64 number, CoinInt64 end)
+{
+  if (start[0])
+    return false;
+  for (CoinInt64 i = 0; i < number; i++) {
+    if (start[i + 1] < start[i])
+      return false;
+  }
+  return start[number] == end;
+}
+
+// Indices must be in range [0,number)
+bool indicesValid(const int *index, CoinInt64 n, int number)
+{
+  for (CoinInt64 i = 0; i < n; i++) {
+    if (index[i] < 0 || index[i] >= number)
+      return false;
+  }
+  return true;
+}
+}
+
+// Default Constructor
+CbcBinaryModel::CbcBinaryModel()
+  : base_(NULL)
+  , length_(0)
+  , header_(NULL)
+  , mapped_(false)
+{
+}
+
+// Destructor
+CbcBinaryModel::~CbcBinaryModel()
+{
+  close();
+}
+
+void CbcBinaryModel::close()
+{
+  if (base_) {
+#ifdef CBC_BINARY_MMAP
+    if (mapped_)
+      munmap(const_cast< char * >(base_), length_);
+    else
+#endif
+      free(const_cast< char * >(base_));
+  }
+  base_ = NULL;
+  header_ = NULL;
+  length_ = 0;
+  mapped_ = false;
+}
+
+int CbcBinaryModel::open(const char *fileName, bool checkSum)
+{
+  close();
+#ifdef CBC_BINARY_MMAP
+  int fd = ::open(fileName, O_RDONLY);
+  if (fd < 0)
+    return BinaryCannotOpen;
+  struct stat statBuffer;
+  if (fstat(fd, &statBuffer) || statBuffer.st_size < static_cast< off_t >(sizeof(BinaryHeader))) {
+    ::close(fd);
+    return BinaryTruncated;
+  }
+  length_ = static_cast< size_t >(statBuffer.st_size);
+  void *address = mmap(NULL, length_, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (address == MAP_FAILED) {
+    length_ = 0;
+    return BinaryCannotOpen;
+  }
+  base_ = reinterpret_cast< const char * >(address);
+  mapped_ = true;
+#else
+  FILE *fp = fopen(fileName, "rb");
+  if (!fp)
+    return BinaryCannotOpen;
+  fseek(fp, 0, SEEK_END);
+  long size = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  if (size < static_cast< long >(sizeof(BinaryHeader))) {
+    fclose(fp);
+    return BinaryTruncated;
+  }
+  length_ = static_cast< size_t >(size);
+  char *buffer = reinterpret_cast< char * >(malloc(length_));
+  if (!buffer || fread(buffer, 1, length_, fp) != length_) {
+    free(buffer);
+    fclose(fp);
+    length_ = 0;
+    return BinaryTruncated;
+  }
+  fclose(fp);
+  base_ = buffer;
+  mapped_ = false;
+#endif
+  const BinaryHeader *header = reinterpret_cast< const BinaryHeader * >(base_);
+  int returnCode = BinaryOk;
+  if (memcmp(header->magic, binaryMagic, sizeof(binaryMagic))) {
+    returnCode = BinaryBadMagic;
+  } else if (header->byteOrder != binaryByteOrder) {
+    returnCode = BinaryBadByteOrder;
+  } else if (header->version != binaryVersion) {
+    returnCode = BinaryBadVersion;
+  } else if (header->totalLength != length_) {
+    returnCode = BinaryTruncated;
+  } else {
+    for (int i = 0; i < numberBinarySections; i++) {
+      if (header->offset[i] < sizeof(BinaryHeader) || (header->offset[i] & 7)
+        || header->offset[i] > length_ || header->size[i] > length_ - header->offset[i]) {
+        returnCode = BinaryTruncated;
+        break;
+      }
+    }
+    if (returnCode == BinaryOk && !sizesValid(header, length_))
+      returnCode = BinaryBadData;
+  }
+  if (returnCode == BinaryOk && checkSum) {
+    BinaryChecksum checksum;
+    // header is covered as well - with checksum field zero
+    BinaryHeader copy = *header;
+    copy.checksum = 0;
+    checksum.add(reinterpret_cast< const char * >(&copy), sizeof(copy));
+    checksum.add(base_ + sizeof(BinaryHeader), length_ - sizeof(BinaryHeader));
+    if (checksum.value() != header->checksum)
+      returnCode = BinaryBadChecksum;
+  }
+  if (returnCode != BinaryOk) {
+    close();
+    return returnCode;
+  }
+  header_ = header;
+  // contents must be safe to hand to a solver even if checksum not wanted
+  if (!contentsValid()) {
+    close();
+    return BinaryBadData;
+  }
+#ifdef CBC_BINARY_MMAP
+  // matrix will be read sequentially
+  madvise(const_cast< char * >(base_), length_, MADV_SEQUENTIAL);
+#endif
+  return BinaryOk;
+}
+
+const char *CbcBinaryModel::section(int which) const
+{
+  const BinaryHeader *header = reinterpret_cast< const BinaryHeader * >(header_);
+  if (!header || !header->size[which])
+    return NULL;
+  return base_ + header->offset[which];
+}
+
+bool CbcBinaryModel::contentsValid() const
+{
+  const BinaryHeader *header = reinterpret_cast< const BinaryHeader * >(header_);
+  int numberRows = header->numberRows;
+  int numberColumns = header->numberColumns;
+  if (!startsValid(columnStart(), numberColumns, header->numberElements))
+    return false;
+  if (!indicesValid(row(), header->numberElements, numberRows))
+    return false;
+  const char *integerType = this->integerType();
+  for (int i = 0; i < numberColumns; i++) {
+    if (integerType[i] < 0 || integerType[i] > 4 || integerType[i] == 2)
+      return false;
+  }
+  int numberSOS = header->numberSOS;
+  if (numberSOS) {
+    if (!startsValid(sosStart(), numberSOS, header->numberSOSElements))
+      return false;
+    const char *sosType = this->sosType();
+    for (int i = 0; i < numberSOS; i++) {
+      if (sosType[i] != 1 && sosType[i] != 2)
+        return false;
+    }
+    if (!indicesValid(sosIndices(), header->numberSOSElements, numberColumns))
+      return false;
+  } else if (header->numberSOSElements) {
+    return false;
+  }
+  CoinInt64 nameBytes = header->nameBytes;
+  if (nameBytes) {
+    // last name terminated so no name can run off the end
+    if (section(secNames)[nameBytes - 1])
+      return false;
+    const CoinInt64 *columnNameStart = reinterpret_cast< const CoinInt64 * >(section(secColumnNameStart));
+    const CoinInt64 *rowNameStart = reinterpret_cast< const CoinInt64 * >(section(secRowNameStart));
+    for (int i = 0; i < numberColumns; i++) {
+      if (columnNameStart[i] < 0 || columnNameStart[i] >= nameBytes)
+        return false;
+    }
+    for (int i = 0; i < numberRows; i++) {
+      if (rowNameStart[i] < 0 || rowNameStart[i] >= nameBytes)
+        return false;
+    }
+  }
+  return true;
+}
+
+#define CBC_BINARY_HEADER reinterpret_cast< const BinaryHeader * >(header_)
+int CbcBinaryModel::version() const
+{
+  return header_ ? CBC_BINARY_HEADER->version : 0;
+}
+int CbcBinaryModel::numberRows() const
+{
+  return header_ ? CBC_BINARY_HEADER->numberRows : 0;
+}
+int CbcBinaryModel::numberColumns() const
+{
+  return header_ ? CBC_BINARY_HEADER->numberColumns : 0;
+}
+CoinInt64 CbcBinaryModel::numberElements() const
+{
+  return header_ ? CBC_BINARY_HEADER->numberElements : 0;
+}
+double CbcBinaryModel::objectiveSense() const
+{
+  return header_ ? CBC_BINARY_HEADER->objectiveSense : 1.0;
+}
+double CbcBinaryModel::objectiveOffset() const
+{
+  return header_ ? CBC_BINARY_HEADER->objectiveOffset : 0.0;
+}
+int CbcBinaryModel::numberSOS() const
+{
+  return header_ ? CBC_BINARY_HEADER->numberSOS : 0;
+}
+bool CbcBinaryModel::hasNames() const
+{
+  return header_ && CBC_BINARY_HEADER->nameBytes > 0;
+}
+#undef CBC_BINARY_HEADER
+const CoinInt64 *CbcBinaryModel::columnStart() const
+{
+  return reinterpret_cast< const CoinInt64 * >(section(secColumnStart));
+}
+const int *CbcBinaryModel::row() const
+{
+  return reinterpret_cast< const int * >(section(secRow));
+}
+const double *CbcBinaryModel::element() const
+{
+  return reinterpret_cast< const double * >(section(secElement));
+}
+const double *CbcBinaryModel::columnLower() const
+{
+  return reinterpret_cast< const double * >(section(secColumnLower));
+}
+const double *CbcBinaryModel::columnUpper() const
+{
+  return reinterpret_cast< const double * >(section(secColumnUpper));
+}
+const double *CbcBinaryModel::objective() const
+{
+  return reinterpret_cast< const double * >(section(secObjective));
+}
+const double *CbcBinaryModel::rowLower() const
+{
+  return reinterpret_cast< const double * >(section(secRowLower));
+}
+const double *CbcBinaryModel::rowUpper() const
+{
+  return reinterpret_cast< const double * >(section(secRowUpper));
+}
+const char *CbcBinaryModel::integerType() const
+{
+  return section(secIntegerType);
+}
+const int *CbcBinaryModel::sosStart() const
+{
+  return reinterpret_cast< const int * >(section(secSosStart));
+}
+const char *CbcBinaryModel::sosType() const
+{
+  return section(secSosType);
+}
+const int *CbcBinaryModel::sosIndices() const
+{
+  return reinterpret_cast< const int * >(section(secSosIndices));
+}
+const double *CbcBinaryModel::sosWeights() const
+{
+  return reinterpret_cast< const double * >(section(secSosWeights));
+}
+const double *CbcBinaryModel::mipStart() const
+{
+  return reinterpret_cast< const double * >(section(secMipStart));
+}
+const int *CbcBinaryModel::priorities() const
+{
+  return reinterpret_cast< const int * >(section(secPriorities));
+}
+const char *CbcBinaryModel::columnName(int iColumn) const
+{
+  const CoinInt64 *start = reinterpret_cast< const CoinInt64 * >(section(secColumnNameStart));
+  if (!start || iColumn < 0 || iColumn >= numberColumns())
+    return NULL;
+  return section(secNames) + start[iColumn];
+}
+const char *CbcBinaryModel::rowName(int iRow) const
+{
+  const CoinInt64 *start = reinterpret_cast< const CoinInt64 * >(section(secRowNameStart));
+  if (!start || iRow < 0 || iRow >= numberRows())
+    return NULL;
+  return section(secNames) + start[iRow];
+}
+
+bool CbcBinaryModel::isBinaryFileName(const char *fileName)
+{
+  size_t length = strlen(fileName);
+  return length > 5 && !strcmp(fileName + length - 5, ".cbcb");
+}
+
+int CbcBinaryModel::loadInto(OsiSolverInterface *solver, bool useNames) const
+{
+  if (!header_)
+    return 1;
+  int numberRows = this->numberRows();
+  int numberColumns = this->numberColumns();
+  CoinInt64 numberElements = this->numberElements();
+  const CoinInt64 *start64 = columnStart();
+  const CoinBigIndex *start;
+  std::vector< CoinBigIndex > startCopy;
+  if (sizeof(CoinBigIndex) == sizeof(CoinInt64)) {
+    start = reinterpret_cast< const CoinBigIndex * >(start64);
+  } else {
+    // narrow starts - only copy made of matrix data
+    if (numberElements > COIN_INT_MAX)
+      return 1;
+    startCopy.resize(numberColumns + 1);
+    for (int i = 0; i <= numberColumns; i++)
+      startCopy[i] = static_cast< CoinBigIndex >(start64[i]);
+    start = &startCopy[0];
+  }
+  solver->loadProblem(numberColumns, numberRows, start, row(), element(),
+    columnLower(), columnUpper(), objective(), rowLower(), rowUpper());
+  solver->setObjSense(objectiveSense());
+  solver->setDblParam(OsiObjOffset, objectiveOffset());
+#ifdef CBC_HAS_CLP
+  OsiClpSolverInterface *clpSolver = dynamic_cast< OsiClpSolverInterface * >(solver);
+#endif
+  const char *integerType = this->integerType();
+  if (integerType) {
+    std::vector< int > which;
+    for (int i = 0; i < numberColumns; i++) {
+      if (integerType[i] == 1)
+        which.push_back(i);
+    }
+    if (which.size())
+      solver->setInteger(&which[0], static_cast< int >(which.size()));
+    // semicontinuous (3) and semi-integer (4) as on MPS import
+    for (int i = 0; i < numberColumns; i++) {
+      if (integerType[i] == 4)
+        solver->setInteger(i);
+#ifdef CBC_HAS_CLP
+      if (clpSolver && integerType[i] > 2)
+        clpSolver->setColumnType(i, integerType[i]);
+#endif
+    }
+  }
+  if (useNames && hasNames()) {
+    std::vector< std::string > rowNames;
+    std::vector< std::string > columnNames;
+    rowNames.reserve(numberRows);
+    columnNames.reserve(numberColumns);
+    for (int i = 0; i < numberRows; i++)
+      rowNames.push_back(rowName(i));
+    for (int i = 0; i < numberColumns; i++)
+      columnNames.push_back(columnName(i));
+#ifdef CBC_HAS_CLP
+    if (clpSolver) {
+      clpSolver->getModelPtr()->copyNames(rowNames, columnNames);
+    } else
+#endif
+    {
+      solver->setRowNames(rowNames, 0, numberRows, 0);
+      solver->setColNames(columnNames, 0, numberColumns, 0);
+    }
+  }
+#ifdef CBC_HAS_CLP
+  if (clpSolver && numberSOS())
+    clpSolver->setSOSData(numberSOS(), sosType(), sosStart(), sosIndices(), sosWeights());
+#endif
+  return 0;
+}
+
+int CbcBinaryModel::write(const OsiSolverInterface *solver, const char *fileName,
+  const double *mipStart, const int *priorities, bool writeNames)
+{
+  FILE *fp = fopen(fileName, "wb");
+  if (!fp)
+    return 1;
+  int numberRows = solver->getNumRows();
+  int numberColumns = solver->getNumCols();
+  const CoinPackedMatrix *matrix = solver->getMatrixByCol();
+  const CoinBigIndex *columnStart = matrix->getVectorStarts();
+  const int *columnLength = matrix->getVectorLengths();
+  const int *row = matrix->getIndices();
+  const double *element = matrix->getElements();
+  CoinInt64 numberElements = matrix->getNumElements();
+  // matrix may have gaps
+  bool packed = !numberColumns || (columnStart[0] == 0 && columnStart[numberColumns] == numberElements);
+  // SOS
+  int numberSOS = 0;
+  CoinInt64 numberSOSElements = 0;
+#ifdef CBC_HAS_CLP
+  const OsiClpSolverInterface *clpSolver = dynamic_cast< const OsiClpSolverInterface * >(solver);
+  const CoinSet *setInfo = NULL;
+  if (clpSolver) {
+    numberSOS = clpSolver->numberSOS();
+    setInfo = clpSolver->setInfo();
+    for (int i = 0; i < numberSOS; i++)
+      numberSOSElements += setInfo[i].numberEntries();
+  }
+#endif
+  // names
+  std::vector< CoinInt64 > columnNameStart;
+  std::vector< CoinInt64 > rowNameStart;
+  CoinInt64 nameBytes = 0;
+  if (writeNames) {
+    columnNameStart.reserve(numberColumns);
+    rowNameStart.reserve(numberRows);
+    for (int i = 0; i < numberColumns; i++) {
+      columnNameStart.push_back(nameBytes);
+      nameBytes += solver->getColName(i).size() + 1;
+    }
+    for (int i = 0; i < numberRows; i++) {
+      rowNameStart.push_back(nameBytes);
+      nameBytes += solver->getRowName(i).size() + 1;
+    }
+  }
+  BinaryHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, binaryMagic, sizeof(binaryMagic));
+  header.version = binaryVersion;
+  header.byteOrder = binaryByteOrder;
+  header.numberRows = numberRows;
+  header.numberColumns = numberColumns;
+  header.numberElements = numberElements;
+  header.numberSOS = numberSOS;
+  header.numberSOSElements = numberSOSElements;
+  header.nameBytes = nameBytes;
+  header.objectiveSense = solver->getObjSense();
+  double offset = 0.0;
+  solver->getDblParam(OsiObjOffset, offset);
+  header.objectiveOffset = offset;
+  // lay out sections
+  CoinUInt64 sizes[numberBinarySections];
+  sizes[secColumnStart] = (numberColumns + 1) * sizeof(CoinInt64);
+  sizes[secRow] = numberElements * sizeof(int);
+  sizes[secElement] = numberElements * sizeof(double);
+  sizes[secColumnLower] = numberColumns * sizeof(double);
+  sizes[secColumnUpper] = numberColumns * sizeof(double);
+  sizes[secObjective] = numberColumns * sizeof(double);
+  sizes[secRowLower] = numberRows * sizeof(double);
+  sizes[secRowUpper] = numberRows * sizeof(double);
+  sizes[secIntegerType] = numberColumns * sizeof(char);
+  sizes[secSosStart] = numberSOS ? (numberSOS + 1) * sizeof(int) : 0;
+  sizes[secSosType] = numberSOS * sizeof(char);
+  sizes[secSosIndices] = numberSOSElements * sizeof(int);
+  sizes[secSosWeights] = numberSOSElements * sizeof(double);
+  sizes[secColumnNameStart] = writeNames ? numberColumns * sizeof(CoinInt64) : 0;
+  sizes[secRowNameStart] = writeNames ? numberRows * sizeof(CoinInt64) : 0;
+  sizes[secNames] = nameBytes;
+  sizes[secMipStart] = mipStart ? numberColumns * sizeof(double) : 0;
+  sizes[secPriorities] = priorities ? numberColumns * sizeof(int) : 0;
+  CoinUInt64 position = sizeof(BinaryHeader);
+  for (int i = 0; i < numberBinarySections; i++) {
+    header.offset[i] = position;
+    header.size[i] = sizes[i];
+    position = roundUp8(position + sizes[i]);
+  }
+  header.totalLength = position;
+  // header is rewritten at end with checksum
+  bool bad = fwrite(&header, sizeof(header), 1, fp) != 1;
+  BinaryWriter writer(fp);
+  writer.addHeader(header);
+  // matrix
+  {
+    CoinInt64 start = 0;
+    writer.append(&start, sizeof(start));
+    for (int i = 0; i < numberColumns; i++) {
+      start += columnLength[i];
+      writer.append(&start, sizeof(start));
+    }
+    writer.pad();
+    if (packed) {
+      writer.append(row, numberElements * sizeof(int));
+      writer.pad();
+      writer.append(element, numberElements * sizeof(double));
+    } else {
+      for (int i = 0; i < numberColumns; i++)
+        writer.append(row + columnStart[i], columnLength[i] * sizeof(int));
+      writer.pad();
+      for (int i = 0; i < numberColumns; i++)
+        writer.append(element + columnStart[i], columnLength[i] * sizeof(double));
+    }
+    writer.pad();
+  }
+  writer.append(solver->getColLower(), numberColumns * sizeof(double));
+  writer.pad();
+  writer.append(solver->getColUpper(), numberColumns * sizeof(double));
+  writer.pad();
+  writer.append(solver->getObjCoefficients(), numberColumns * sizeof(double));
+  writer.pad();
+  writer.append(solver->getRowLower(), numberRows * sizeof(double));
+  writer.pad();
+  writer.append(solver->getRowUpper(), numberRows * sizeof(double));
+  writer.pad();
+  for (int i = 0; i < numberColumns; i++) {
+    char type = solver->isInteger(i) ? 1 : 0;
+#ifdef CBC_HAS_CLP
+    // keep semicontinuous and semi-integer
+    if (clpSolver && clpSolver->integerType(i) > 2)
+      type = static_cast< char >(clpSolver->integerType(i));
+#endif
+    writer.append(&type, 1);
+  }
+  writer.pad();
+#ifdef CBC_HAS_CLP
+  if (numberSOS) {
+    int start = 0;
+    writer.append(&start, sizeof(int));
+    for (int i = 0; i < numberSOS; i++) {
+      start += setInfo[i].numberEntries();
+      writer.append(&start, sizeof(int));
+    }
+    writer.pad();
+    for (int i = 0; i < numberSOS; i++) {
+      char type = static_cast< char >(setInfo[i].setType());
+      writer.append(&type, 1);
+    }
+    writer.pad();
+    for (int i = 0; i < numberSOS; i++)
+      writer.append(setInfo[i].which(), setInfo[i].numberEntries() * sizeof(int));
+    writer.pad();
+    for (int i = 0; i < numberSOS; i++) {
+      int n = setInfo[i].numberEntries();
+      const double *weights = setInfo[i].weights();
+      for (int j = 0; j < n; j++) {
+        double weight = weights ? weights[j] : static_cast< double >(j);
+        writer.append(&weight, sizeof(double));
+      }
+    }
+    writer.pad();
+  }
+#endif
+  if (writeNames) {
+    if (numberColumns)
+      writer.append(&columnNameStart[0], numberColumns * sizeof(CoinInt64));
+    writer.pad();
+    if (numberRows)
+      writer.append(&rowNameStart[0], numberRows * sizeof(CoinInt64));
+    writer.pad();
+    for (int i = 0; i < numberColumns; i++) {
+      std::string name = solver->getColName(i);
+      writer.append(name.c_str(), name.size() + 1);
+    }
+    for (int i = 0; i < numberRows; i++) {
+      std::string name = solver->getRowName(i);
+      writer.append(name.c_str(), name.size() + 1);
+    }
+    writer.pad();
+  }
+  if (mipStart) {
+    writer.append(mipStart, numberColumns * sizeof(double));
+    writer.pad();
+  }
+  if (priorities) {
+    writer.append(priorities, numberColumns * sizeof(int));
+    writer.pad();
+  }
+  writer.flush();
+  assert(writer.position() + sizeof(BinaryHeader) == header.totalLength);
+  header.checksum = writer.checksum();
+  bad = bad || writer.bad();
+  if (!bad) {
+    fseek(fp, 0, SEEK_SET);
+    bad = fwrite(&header, sizeof(header), 1, fp) != 1;
+  }
+  if (fclose(fp))
+    bad = true;
+  if (bad) {
+    remove(fileName);
+    return 1;
+  }
+  return 0;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,166 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CbcBinaryModel_H
+#define CbcBinaryModel_H
+
+#include <cstddef>
+
+#include "CbcConfig.h"
+#include "CoinTypes.h"
+
+class OsiSolverInterface;
+
+/** Native binary model file
+
+    A model is stored as a fixed header followed by 8-byte aligned
+    sections in native byte order, so a file can be mapped into memory
+    and used without any parsing.  Sections are
+
+    - matrix in column ordered (CSC) form - 64 bit starts, rows, elements
+    - column bounds, objective and integrality (one char per column)
+    - row bounds
+    - SOS sets (start, type, members, weights)
+    - optional string table of column and row names
+    - optional MIP start (one value per column) and priorities
+
+    The header holds a format version, a byte order tag and a checksum
+    of the whole file (header included).  Files written by any other format
+    version or on a machine with different byte order are rejected.
+*/
+
+class CBCLIB_EXPORT CbcBinaryModel {
+
+public:
+  /// Return codes from open
+  enum OpenStatus {
+    BinaryOk = 0,
+    BinaryCannotOpen,
+    BinaryBadMagic,
+    BinaryBadVersion,
+    BinaryBadByteOrder,
+    BinaryTruncated,
+    BinaryBadChecksum,
+    BinaryBadData
+  };
+
+  /// Default Constructor
+  CbcBinaryModel();
+
+  /// Destructor - unmaps file
+  ~CbcBinaryModel();
+
+  /** Maps fileName into memory and validates header (and checksum
+      if checkSum true).  Section sizes, matrix and SOS starts, indices
+      and name offsets are always checked against the header.
+      Returns an OpenStatus.
+  */
+  int open(const char *fileName, bool checkSum = true);
+
+  /// Unmaps file
+  void close();
+
+  /** Loads mapped model into solver.
+      Arrays are handed straight from the mapping to the solver.
+      If useNames then names are copied if present.
+      Returns 0 if OK, 1 if no model is open or it cannot be represented
+      (e.g. more than COIN_INT_MAX elements with 32 bit CoinBigIndex).
+  */
+  int loadInto(OsiSolverInterface *solver, bool useNames = true) const;
+
+  /** Writes model in solver to fileName.
+      mipStart and priorities are optional arrays of length number of
+      columns.  If writeNames then column and row names are stored.
+      Returns 0 if OK, 1 if file could not be written.
+  */
+  static int write(const OsiSolverInterface *solver, const char *fileName,
+    const double *mipStart = NULL, const int *priorities = NULL,
+    bool writeNames = true);
+
+  /// Returns true if fileName ends in binary model extension (.cbcb)
+  static bool isBinaryFileName(const char *fileName);
+
+  /**@name Access to mapped data */
+  //@{
+  /// True if a model is open
+  inline bool isOpen() const
+  {
+    return header_ != NULL;
+  }
+  /// Format version of open file
+  int version() const;
+  /// Number of rows
+  int numberRows() const;
+  /// Number of columns
+  int numberColumns() const;
+  /// Number of elements
+  CoinInt64 numberElements() const;
+  /// Objective sense (1 minimize, -1 maximize)
+  double objectiveSense() const;
+  /// Objective offset
+  double objectiveOffset() const;
+  /// Column starts (numberColumns+1)
+  const CoinInt64 *columnStart() const;
+  /// Row indices
+  const int *row() const;
+  /// Elements
+  const double *element() const;
+  /// Column lower bounds
+  const double *columnLower() const;
+  /// Column upper bounds
+  const double *columnUpper() const;
+  /// Objective
+  const double *objective() const;
+  /// Row lower bounds
+  const double *rowLower() const;
+  /// Row upper bounds
+  const double *rowUpper() const;
+  /** Integrality - 0 continuous, 1 integer,
+      3 semicontinuous, 4 semicontinuous integer */
+  const char *integerType() const;
+  /// Number of SOS sets
+  int numberSOS() const;
+  /// SOS starts (numberSOS+1)
+  const int *sosStart() const;
+  /// SOS types
+  const char *sosType() const;
+  /// SOS members
+  const int *sosIndices() const;
+  /// SOS weights
+  const double *sosWeights() const;
+  /// True if names stored
+  bool hasNames() const;
+  /// Column name (NULL if no names)
+  const char *columnName(int iColumn) const;
+  /// Row name (NULL if no names)
+  const char *rowName(int iRow) const;
+  /// MIP start values or NULL
+  const double *mipStart() const;
+  /// Priorities or NULL
+  const int *priorities() const;
+  //@}
+
+private:
+  /// Not implemented
+  CbcBinaryModel(const CbcBinaryModel &);
+  CbcBinaryModel &operator=(const CbcBinaryModel &);
+  /// Pointer to section or NULL if empty
+  const char *section(int which) const;
+  /// True if starts, indices and names are consistent with header
+  bool contentsValid() const;
+
+  /// Start of file in memory
+  const char *base_;
+  /// Length of file
+  size_t length_;
+  /// Header (same as base_ when open)
+  const void *header_;
+  /// True if mmap'ed, false if read into malloc'ed memory
+  bool mapped_;
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
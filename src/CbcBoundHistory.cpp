@@ -0,0 +1,133 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#pragma warning(disable : 4786)
+#endif
+
+#include "CbcConfig.h"
+
+#include <cmath>
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinTime.hpp"
+#include "CbcBoundHistory.hpp"
+
+namespace {
+// Gap between two values - 1.0 if either not known or signs differ
+double boundGap(double a, double b)
+{
+  if (fabs(a) >= 1.0e50 || fabs(b) >= 1.0e50)
+    return 1.0;
+  double largest = CoinMax(fabs(a), fabs(b));
+  if (fabs(a - b) <= 1.0e-9 * CoinMax(1.0, largest))
+    return 0.0;
+  if (a * b < 0.0)
+    return 1.0;
+  return CoinMin(1.0, fabs(a - b) / largest);
+}
+}
+
+CbcBoundHistory::CbcBoundHistory()
+  : startTime_(0.0)
+  , primalIntegral_(0.0)
+  , dualIntegral_(0.0)
+  , primalDualIntegral_(0.0)
+  , timeToFirst_(-1.0)
+  , timeToOnePercent_(-1.0)
+  , searchTime_(0.0)
+{
+}
+
+void CbcBoundHistory::start(double primal, double dual)
+{
+  primalTime_.clear();
+  primalValue_.clear();
+  dualTime_.clear();
+  dualValue_.clear();
+  primalIntegral_ = 0.0;
+  dualIntegral_ = 0.0;
+  primalDualIntegral_ = 0.0;
+  timeToFirst_ = -1.0;
+  timeToOnePercent_ = -1.0;
+  searchTime_ = 0.0;
+  startTime_ = CoinGetTimeOfDay();
+  addPrimal(primal);
+  addDual(dual);
+}
+
+double CbcBoundHistory::elapsed() const
+{
+  return CoinGetTimeOfDay() - startTime_;
+}
+
+void CbcBoundHistory::addPrimal(double value)
+{
+  if (value >= 1.0e50)
+    return;
+  if (primalValue_.size() && value >= primalValue_.back())
+    return;
+  primalTime_.push_back(elapsed());
+  primalValue_.push_back(value);
+}
+
+void CbcBoundHistory::addDual(double value)
+{
+  if (value <= -1.0e50 || value >= 1.0e50)
+    return;
+  if (dualValue_.size() && value <= dualValue_.back())
+    return;
+  dualTime_.push_back(elapsed());
+  dualValue_.push_back(value);
+}
+
+void CbcBoundHistory::finish(double primal, double dual)
+{
+  addPrimal(primal);
+  addDual(CoinMin(dual, primal));
+  searchTime_ = CoinMax(elapsed(), 1.0e-9);
+  int numberPrimal = static_cast< int >(primalTime_.size());
+  int numberDual = static_cast< int >(dualTime_.size());
+  double reference = numberPrimal ? primalValue_.back() : (numberDual ? dualValue_.back() : COIN_DBL_MAX);
+  primalIntegral_ = 0.0;
+  dualIntegral_ = 0.0;
+  primalDualIntegral_ = 0.0;
+  // walk both step functions
+  double currentPrimal = COIN_DBL_MAX;
+  double currentDual = -COIN_DBL_MAX;
+  double lastTime = 0.0;
+  int iPrimal = 0;
+  int iDual = 0;
+  while (true) {
+    double nextTime = searchTime_;
+    if (iPrimal < numberPrimal)
+      nextTime = CoinMin(nextTime, primalTime_[iPrimal]);
+    if (iDual < numberDual)
+      nextTime = CoinMin(nextTime, dualTime_[iDual]);
+    double interval = CoinMax(nextTime - lastTime, 0.0);
+    primalIntegral_ += interval * boundGap(currentPrimal, reference);
+    dualIntegral_ += interval * boundGap(currentDual, reference);
+    primalDualIntegral_ += interval * boundGap(currentPrimal, currentDual);
+    lastTime = CoinMax(lastTime, nextTime);
+    if (iPrimal == numberPrimal && iDual == numberDual)
+      break;
+    while (iPrimal < numberPrimal && primalTime_[iPrimal] <= nextTime)
+      currentPrimal = primalValue_[iPrimal++];
+    while (iDual < numberDual && dualTime_[iDual] <= nextTime)
+      currentDual = dualValue_[iDual++];
+  }
+  if (numberPrimal) {
+    timeToFirst_ = primalTime_[0];
+    for (int i = 0; i < numberPrimal; i++) {
+      if (boundGap(primalValue_[i], reference) <= 0.01) {
+        timeToOnePercent_ = primalTime_[i];
+        break;
+      }
+    }
+  }
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,141 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+/*! \file CbcBoundHistory.hpp
+    \brief Primal and dual bound over time and the integrals derived from them.
+*/
+
+#ifndef CbcBoundHistory_H
+#define CbcBoundHistory_H
+
+#include <vector>
+
+#include "CbcConfig.h"
+
+/** Bound history.
+
+    CbcModel records (wall clock seconds, value) each time the incumbent
+    improves and each time the best possible objective improves.  As
+    finding the tree bound means looking at every node it is only taken
+    when CbcModel already finds it for its status line (every
+    printFrequency nodes and at most every secsPrintFrequency seconds)
+    so the history costs nothing extra during search.  Values are as
+    CbcModel holds them, i.e. for minimization.
+
+    When search finishes the following are computed, with the gap between
+    two values a and b being |a - b| / max(|a|, |b|), or 1 if either is not
+    known or they differ in sign -
+      - primal integral - integral over time of the gap between incumbent
+        and final incumbent (or final bound if no solution)
+      - dual integral - the same for best possible and final incumbent
+      - primal-dual integral - integral of gap between incumbent and best
+        possible
+      - time to first solution and time until incumbent was within 1% of
+        the final incumbent (-1.0 if no solution)
+
+    Integrals are in gap seconds so a search that found the optimum and
+    proved it at once would have all of them 0.0 and one that never found
+    anything would have them equal to the search time.
+*/
+
+class CBCLIB_EXPORT CbcBoundHistory {
+public:
+  /// Default Constructor
+  CbcBoundHistory();
+
+  /** Clears and starts clock.  primal and dual are incumbent and best
+      possible already known (COIN_DBL_MAX and -COIN_DBL_MAX if none). */
+  void start(double primal, double dual);
+  /// Seconds since start
+  double elapsed() const;
+  /// Adds incumbent now if better
+  void addPrimal(double value);
+  /// Adds best possible now if better
+  void addDual(double value);
+  /// Adds final values and computes integrals
+  void finish(double primal, double dual);
+
+  /// Primal integral (gap seconds)
+  inline double primalIntegral() const
+  {
+    return primalIntegral_;
+  }
+  /// Dual integral (gap seconds)
+  inline double dualIntegral() const
+  {
+    return dualIntegral_;
+  }
+  /// Primal-dual integral (gap seconds)
+  inline double primalDualIntegral() const
+  {
+    return primalDualIntegral_;
+  }
+  /// Seconds to first solution (-1.0 if none)
+  inline double timeToFirstSolution() const
+  {
+    return timeToFirst_;
+  }
+  /// Seconds until within 1% of final incumbent (-1.0 if no solution)
+  inline double timeToOnePercent() const
+  {
+    return timeToOnePercent_;
+  }
+  /// Seconds from start to finish (0.0 if not finished)
+  inline double searchTime() const
+  {
+    return searchTime_;
+  }
+  /// Number of incumbents recorded
+  inline int numberPrimal() const
+  {
+    return static_cast< int >(primalTime_.size());
+  }
+  /// Time and value of i'th incumbent
+  inline double primalTime(int i) const
+  {
+    return primalTime_[i];
+  }
+  inline double primalValue(int i) const
+  {
+    return primalValue_[i];
+  }
+  /// Number of best possible values recorded
+  inline int numberDual() const
+  {
+    return static_cast< int >(dualTime_.size());
+  }
+  /// Time and value of i'th best possible
+  inline double dualTime(int i) const
+  {
+    return dualTime_[i];
+  }
+  inline double dualValue(int i) const
+  {
+    return dualValue_[i];
+  }
+
+private:
+  /// Wall clock at start
+  double startTime_;
+  /// Incumbent times
+  std::vector< double > primalTime_;
+  /// Incumbent values
+  std::vector< double > primalValue_;
+  /// Best possible times
+  std::vector< double > dualTime_;
+  /// Best possible values
+  std::vector< double > dualValue_;
+  /// Results
+  double primalIntegral_;
+  double dualIntegral_;
+  double primalDualIntegral_;
+  double timeToFirst_;
+  double timeToOnePercent_;
+  double searchTime_;
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -22,6 +22,14 @@
 
 class CbcModel;
 class CbcTree;
+/** Precomputed ordering key of a node.  Smaller is better - compared
+    on value[0], then value[1] and then tie (as equalityTest).
+*/
+typedef struct {
+  double value[2];
+  int tie;
+} CbcNodeKey;
+
 class CBCLIB_EXPORT CbcCompareBase {
 public:
   // Default Constructor
@@ -107,6 +115,41 @@ public:
     return true;
   }
 
+  /** Returns true if ordering given by test (with current settings)
+        can be got by comparing keys from nodeKey.  The tree then
+        computes a key once per node and orders on that.  The
+        built-in comparisons only return true when they are the most
+        derived class, so a class derived from one of them which just
+        changes test is still ordered by test.  It can return true here
+        if it also supplies a matching nodeKey.
+    */
+  virtual bool keyed() const
+  {
+    return false;
+  }
+  /// Fills key[0] and key[1] for node (only used if keyed())
+  virtual void nodeKey(const CbcNode *, double *key) const
+  {
+    key[0] = 0.0;
+    key[1] = 0.0;
+  }
+  /// Full key for node with ties broken as in equalityTest
+  inline void fillKey(const CbcNode *node, CbcNodeKey &key) const
+  {
+    nodeKey(node, key.value);
+    key.tie = threaded_ ? node->nodeNumber() : node->nodeInfo()->nodeNumber();
+  }
+  /// Returns true if key y better than key x
+  static inline bool keyTest(const CbcNodeKey &x, const CbcNodeKey &y)
+  {
+    if (x.value[0] != y.value[0])
+      return x.value[0] > y.value[0];
+    else if (x.value[1] != y.value[1])
+      return x.value[1] > y.value[1];
+    else
+      return x.tie > y.tie;
+  }
+
   /// This is alternate test function
   virtual bool alternateTest(CbcNode *x, CbcNode *y)
   {
@@ -12,6 +12,7 @@
 #include <cstdlib>
 #include <cmath>
 #include <cfloat>
+#include <typeinfo>
 //#define CBC_DEBUG
 
 #include "CbcMessage.hpp"
@@ -217,6 +218,57 @@ bool CbcCompareDefault::test(CbcNode *x, CbcNode *y)
       return equalityTest(x, y); // so ties will be broken in consistent manner
   }
 }
+/*
+  Keys which give same order as test.  With weight -3.0 nodes whose number
+  of unsatisfied differ by at most 10000 are compared on depth which is not
+  a consistent order so there is no key.  A derived class may have
+  changed test so only this class says it is keyed.
+*/
+bool CbcCompareDefault::keyed() const
+{
+#if TRY_THIS == 0
+  return weight_ != -3.0 && typeid(*this) == typeid(CbcCompareDefault);
+#else
+  return false;
+#endif
+}
+void CbcCompareDefault::nodeKey(const CbcNode *node, double *key) const
+{
+  int depth = node->depth();
+  if (startNodeNumber_ >= 0) {
+    // Diving - start node, then nodes since dive started, then depth first
+    int n = node->nodeNumber();
+    double type = 2.0;
+    if (n == startNodeNumber_)
+      type = 0.0;
+    else if (n >= afterNodeNumber_)
+      type = 1.0;
+    double weight = CoinMax(weight_, 1.0e-9);
+    key[0] = type * 1.0e9 - depth;
+    key[1] = node->objectiveValue() + weight * node->numberUnsatisfied();
+  } else if (!weight_) {
+    key[0] = node->objectiveValue() + 1.0e-9 * node->numberUnsatisfied();
+    key[1] = 0.0;
+  } else if (weight_ == -2.0) {
+    // fewest unsatisfied then deepest
+    key[0] = node->numberUnsatisfied();
+    key[1] = -depth;
+  } else if (weight_ == -1.0) {
+    // deeper than breadthDepth_ on unsatisfied, rest deepest first
+    key[0] = (depth > breadthDepth_) ? node->numberUnsatisfied() : COIN_INT_MAX;
+    key[1] = -depth;
+  } else {
+    // deeper than breadthDepth_ on weighted objective, rest deepest first
+    double weight = CoinMax(weight_, 1.0e-9);
+    if (depth > breadthDepth_) {
+      key[0] = 0.0;
+      key[1] = node->objectiveValue() + weight * node->numberUnsatisfied();
+    } else {
+      key[0] = 1.0;
+      key[1] = -depth;
+    }
+  }
+}
 /*
   Change the weight attached to unsatisfied integer variables, unless it's
   fairly early on in the search and all solutions to date are heuristic.
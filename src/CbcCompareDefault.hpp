@@ -48,6 +48,10 @@ public:
   /* This returns true if weighted value of node y is less than
        weighted value of node x */
   virtual bool test(CbcNode *x, CbcNode *y);
+  /// Order can be got from key unless weight is -3.0 (false for derived classes)
+  virtual bool keyed() const;
+  /// Key for node giving same order as test
+  virtual void nodeKey(const CbcNode *node, double *key) const;
 
   using CbcCompareBase::newSolution;
   /// This allows method to change behavior as it is called
@@ -12,6 +12,7 @@
 #include <cstdlib>
 #include <cmath>
 #include <cfloat>
+#include <typeinfo>
 //#define CBC_DEBUG
 
 #include "CbcMessage.hpp"
@@ -68,6 +69,17 @@ bool CbcCompareDepth::test(CbcNode *x, CbcNode *y)
   else
     return equalityTest(x, y); // so ties will be broken in consistent manner
 }
+// Order can be got from key (not if derived class may have changed test)
+bool CbcCompareDepth::keyed() const
+{
+  return typeid(*this) == typeid(CbcCompareDepth);
+}
+// Key for node
+void CbcCompareDepth::nodeKey(const CbcNode *node, double *key) const
+{
+  key[0] = -static_cast< double >(node->depth());
+  key[1] = 0.0;
+}
 // Create C++ lines to get to current state
 void CbcCompareDepth::generateCpp(FILE *fp)
 {
@@ -39,6 +39,10 @@ public:
 
   // This returns true if the depth of node y is greater than depth of node x
   virtual bool test(CbcNode *x, CbcNode *y);
+  /// Order can be got from key (false for derived classes)
+  virtual bool keyed() const;
+  /// Key for node - deepest first
+  virtual void nodeKey(const CbcNode *node, double *key) const;
 };
 
 #endif
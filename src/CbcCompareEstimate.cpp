@@ -12,6 +12,7 @@
 #include <cstdlib>
 #include <cmath>
 #include <cfloat>
+#include <typeinfo>
 //#define CBC_DEBUG
 
 #include "CbcMessage.hpp"
@@ -69,6 +70,17 @@ bool CbcCompareEstimate::test(CbcNode *x, CbcNode *y)
     return equalityTest(x, y); // so ties will be broken in consistent manner
 }
 
+// Order can be got from key (not if derived class may have changed test)
+bool CbcCompareEstimate::keyed() const
+{
+  return typeid(*this) == typeid(CbcCompareEstimate);
+}
+// Key for node
+void CbcCompareEstimate::nodeKey(const CbcNode *node, double *key) const
+{
+  key[0] = node->guessedObjectiveValue();
+  key[1] = 0.0;
+}
 // Create C++ lines to get to current state
 void CbcCompareEstimate::generateCpp(FILE *fp)
 {
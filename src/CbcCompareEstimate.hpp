@@ -39,6 +39,10 @@ public:
   virtual void generateCpp(FILE *fp);
 
   virtual bool test(CbcNode *x, CbcNode *y);
+  /// Order can be got from key (false for derived classes)
+  virtual bool keyed() const;
+  /// Key for node - smallest estimate first
+  virtual void nodeKey(const CbcNode *node, double *key) const;
 };
 
 #endif //CbcCompareEstimate_H
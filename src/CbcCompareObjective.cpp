@@ -12,6 +12,7 @@
 #include <cstdlib>
 #include <cmath>
 #include <cfloat>
+#include <typeinfo>
 //#define CBC_DEBUG
 
 #include "CbcMessage.hpp"
@@ -68,6 +69,17 @@ bool CbcCompareObjective::test(CbcNode *x, CbcNode *y)
   else
     return equalityTest(x, y); // so ties will be broken in consistent manner
 }
+// Order can be got from key (not if derived class may have changed test)
+bool CbcCompareObjective::keyed() const
+{
+  return typeid(*this) == typeid(CbcCompareObjective);
+}
+// Key for node
+void CbcCompareObjective::nodeKey(const CbcNode *node, double *key) const
+{
+  key[0] = node->objectiveValue();
+  key[1] = 0.0;
+}
 // Create C++ lines to get to current state
 void CbcCompareObjective::generateCpp(FILE *fp)
 {
@@ -41,6 +41,10 @@ public:
   /* This returns true if objective value of node y is less than
        objective value of node x */
   virtual bool test(CbcNode *x, CbcNode *y);
+  /// Order can be got from key (false for derived classes)
+  virtual bool keyed() const;
+  /// Key for node - smallest objective first
+  virtual void nodeKey(const CbcNode *node, double *key) const;
 };
 
 #endif //CbcCompareObjective_H
@@ -55,6 +55,14 @@
 
 #endif /* HAVE_CONFIG_H */
 
+/* Symmetry handling (orbital fixing and branching) is always built.  If
+ * nauty was not found CbcSymmetry.cpp uses its own search instead.
+ */
+#ifndef CBC_HAS_NAUTY
+#define CBC_HAS_NAUTY 1
+#define CBC_NAUTY_BUILTIN 1
+#endif
+
 #endif /*__CBCCONFIG_H__*/
 
 /* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
@@ -24,6 +24,7 @@
 #include "CbcModel.hpp"
 #include "CbcMessage.hpp"
 #include "CbcCutGenerator.hpp"
+#include "CbcTrace.hpp"
 #include "CbcBranchDynamic.hpp"
 #include "CglProbing.hpp"
 #include "CglCliqueStrengthening.hpp"
@@ -56,6 +57,16 @@ CbcCutGenerator::CbcCutGenerator()
   , numberCutsAtRoot_(0)
   , numberActiveCutsAtRoot_(0)
   , numberShortCutsAtRoot_(0)
+  , numberParallelCuts_(0)
+  , numberWeakCuts_(0)
+  , numberCutsOverLimit_(0)
+  , roundEfficacy_(0.0)
+  , gainAtRoot_(0.0)
+  , gainInTree_(0.0)
+  , timeAtRoot_(-1.0)
+  , numberTimesAtRoot_(0)
+  , scheduleReason_(0)
+  , numberScheduleChanges_(0)
   , switches_(1)
   , maximumTries_(-1)
 {
@@ -79,6 +90,16 @@ CbcCutGenerator::CbcCutGenerator(CbcModel *model, CglCutGenerator *generator,
   , numberCutsAtRoot_(0)
   , numberActiveCutsAtRoot_(0)
   , numberShortCutsAtRoot_(0)
+  , numberParallelCuts_(0)
+  , numberWeakCuts_(0)
+  , numberCutsOverLimit_(0)
+  , roundEfficacy_(0.0)
+  , gainAtRoot_(0.0)
+  , gainInTree_(0.0)
+  , timeAtRoot_(-1.0)
+  , numberTimesAtRoot_(0)
+  , scheduleReason_(0)
+  , numberScheduleChanges_(0)
   , switches_(1)
   , maximumTries_(-1)
 {
@@ -130,6 +151,16 @@ CbcCutGenerator::CbcCutGenerator(const CbcCutGenerator &rhs)
   numberCutsAtRoot_ = rhs.numberCutsAtRoot_;
   numberActiveCutsAtRoot_ = rhs.numberActiveCutsAtRoot_;
   numberShortCutsAtRoot_ = rhs.numberShortCutsAtRoot_;
+  numberParallelCuts_ = rhs.numberParallelCuts_;
+  numberWeakCuts_ = rhs.numberWeakCuts_;
+  numberCutsOverLimit_ = rhs.numberCutsOverLimit_;
+  roundEfficacy_ = rhs.roundEfficacy_;
+  gainAtRoot_ = rhs.gainAtRoot_;
+  gainInTree_ = rhs.gainInTree_;
+  timeAtRoot_ = rhs.timeAtRoot_;
+  numberTimesAtRoot_ = rhs.numberTimesAtRoot_;
+  scheduleReason_ = rhs.scheduleReason_;
+  numberScheduleChanges_ = rhs.numberScheduleChanges_;
 }
 
 // Assignment operator
@@ -161,6 +192,16 @@ CbcCutGenerator::operator=(const CbcCutGenerator &rhs)
     numberCutsAtRoot_ = rhs.numberCutsAtRoot_;
     numberActiveCutsAtRoot_ = rhs.numberActiveCutsAtRoot_;
     numberShortCutsAtRoot_ = rhs.numberShortCutsAtRoot_;
+    numberParallelCuts_ = rhs.numberParallelCuts_;
+    numberWeakCuts_ = rhs.numberWeakCuts_;
+    numberCutsOverLimit_ = rhs.numberCutsOverLimit_;
+    roundEfficacy_ = rhs.roundEfficacy_;
+    gainAtRoot_ = rhs.gainAtRoot_;
+    gainInTree_ = rhs.gainInTree_;
+    timeAtRoot_ = rhs.timeAtRoot_;
+    numberTimesAtRoot_ = rhs.numberTimesAtRoot_;
+    scheduleReason_ = rhs.scheduleReason_;
+    numberScheduleChanges_ = rhs.numberScheduleChanges_;
   }
   return *this;
 }
@@ -264,6 +305,7 @@ bool CbcCutGenerator::generateCuts(OsiCuts &cs, int fullScan, OsiSolverInterface
     doThis = false;
   }
   if (fullScan || doThis) {
+    CbcTraceSpan traceSpan(CBC_TRACE_CUTS, generatorName_);
     CoinThreadRandom *randomNumberGenerator = NULL;
 #ifdef CBC_HAS_CLP
     {
@@ -1818,6 +1860,120 @@ void CbcCutGenerator::setWhatDepthInSub(int value)
 {
   depthCutGeneratorInSub_ = value;
 }
+namespace {
+// Reasons for automatic schedule
+const char *scheduleReasons[] = {
+  "not scheduled",
+  "no cuts - occasional tries",
+  "no bound gain at root - root only",
+  "productive at root - every node",
+  "fairly productive at root - every few nodes",
+  "poor at root - top of tree only",
+  "no bound gain in tree - occasional tries",
+  "productive in tree - more often",
+  "poor in tree - less often",
+  "average in tree - unchanged"
+};
+}
+// Automatic scheduling - returns new howOften
+int CbcCutGenerator::schedule(bool atRoot, double averageRate, double rowDensity)
+{
+  int howOften = whenCutGenerator_;
+  int depth = depthCutGenerator_;
+  double gain;
+  double seconds;
+  if (atRoot) {
+    timeAtRoot_ = timeInCutGenerator_;
+    numberTimesAtRoot_ = numberTimes_;
+    gain = gainAtRoot_;
+    seconds = timeInCutGenerator_;
+  } else {
+    gain = gainInTree_;
+    seconds = timeInTree();
+  }
+  double rate = gain / CoinMax(seconds, 1.0e-3);
+  // long cuts make every resolve slower
+  if (numberCuts_ && rowDensity > 0.0) {
+    double averageLength = static_cast< double >(numberElements_) / numberCuts_;
+    if (averageLength > 2.0 * rowDensity)
+      rate *= 2.0 * rowDensity / averageLength;
+  }
+  double ratio = averageRate > 0.0 ? rate / averageRate : 0.0;
+  if (atRoot) {
+    if (!numberCuts_ && !numberColumnCuts_) {
+      howOften = 1000000 + SCANCUTS;
+      depth = -1;
+      scheduleReason_ = 1;
+    } else if (gain <= 1.0e-9) {
+      howOften = -99;
+      depth = -1;
+      scheduleReason_ = 2;
+    } else if (ratio >= 1.0) {
+      howOften = 1000000 + 1;
+      depth = -1;
+      scheduleReason_ = 3;
+    } else if (ratio >= 0.25) {
+      howOften = 1000000 + static_cast< int >(ceil(1.0 / ratio));
+      depth = -1;
+      scheduleReason_ = 4;
+    } else {
+      howOften = 1000000 + 1;
+      depth = 110;
+      scheduleReason_ = 5;
+    }
+  } else {
+    // wait until enough tries in tree
+    if (numberTimes_ - numberTimesAtRoot_ < 20)
+      return howOften;
+    int k = howOften >= 1000000 ? howOften % 1000000 : 1;
+    if (gain <= 1.0e-9) {
+      k = SCANCUTS;
+      depth = -1;
+      scheduleReason_ = 6;
+    } else if (ratio >= 1.0) {
+      // loosen
+      if (depth > 100) {
+        depth += 5;
+        if (depth % 100 < 5)
+          depth = -1;
+      } else {
+        k = CoinMax(1, k / 2);
+      }
+      scheduleReason_ = 7;
+    } else if (ratio < 0.25) {
+      // tighten
+      if (depth > 100) {
+        int limit = (depth % 100) / 2;
+        if (limit >= 2) {
+          depth = 100 + limit;
+        } else {
+          depth = -1;
+          k = SCANCUTS;
+        }
+      } else if (k == 1) {
+        depth = 110;
+      } else {
+        k = CoinMin(2 * k, SCANCUTS);
+      }
+      scheduleReason_ = 8;
+    } else {
+      scheduleReason_ = 9;
+    }
+    // 100 means off
+    if (k == 100)
+      k = 101;
+    howOften = 1000000 + k;
+  }
+  if (howOften != whenCutGenerator_ || depth != depthCutGenerator_)
+    numberScheduleChanges_++;
+  depthCutGenerator_ = depth;
+  return howOften;
+}
+// Why last automatic schedule was chosen
+const char *CbcCutGenerator::scheduleReason() const
+{
+  return scheduleReasons[scheduleReason_];
+}
 // Add in statistics from other
 void CbcCutGenerator::addStatistics(const CbcCutGenerator *other)
 {
@@ -1839,11 +1995,18 @@ void CbcCutGenerator::addStatistics(const CbcCutGenerator *other)
   numberActiveCutsAtRoot_ += other->numberActiveCutsAtRoot_;
   // Number of short cuts at root
   numberShortCutsAtRoot_ += other->numberShortCutsAtRoot_;
+  // Number of cuts rejected by cut selection
+  numberParallelCuts_ += other->numberParallelCuts_;
+  numberWeakCuts_ += other->numberWeakCuts_;
+  numberCutsOverLimit_ += other->numberCutsOverLimit_;
+  // Bound gain
+  gainAtRoot_ += other->gainAtRoot_;
+  gainInTree_ += other->gainInTree_;
 }
 // Scale back statistics by factor
 void CbcCutGenerator::scaleBackStatistics(int factor)
 {
-  // leave time
+  // leave time and bound gain
   // Number times cut generator entered
   numberTimes_ = (numberTimes_ + factor - 1) / factor;
   // Total number of cuts added
@@ -1860,6 +2023,10 @@ void CbcCutGenerator::scaleBackStatistics(int factor)
   numberActiveCutsAtRoot_ = (numberActiveCutsAtRoot_ + factor - 1) / factor;
   // Number of short cuts at root
   numberShortCutsAtRoot_ = (numberShortCutsAtRoot_ + factor - 1) / factor;
+  // Number of cuts rejected by cut selection
+  numberParallelCuts_ = (numberParallelCuts_ + factor - 1) / factor;
+  numberWeakCuts_ = (numberWeakCuts_ + factor - 1) / factor;
+  numberCutsOverLimit_ = (numberCutsOverLimit_ + factor - 1) / factor;
 }
 #ifdef CBC_LAGRANGEAN_SOLVERS
 #include "CglLandP.hpp"
@@ -362,6 +362,33 @@ public:
   {
     numberCutsActive_ += value;
   }
+  /// Number of cuts not added as too parallel to a better cut
+  inline int numberParallelCuts() const
+  {
+    return numberParallelCuts_;
+  }
+  inline void incrementNumberParallelCuts(int value = 1)
+  {
+    numberParallelCuts_ += value;
+  }
+  /// Number of cuts not added as efficacy too small
+  inline int numberWeakCuts() const
+  {
+    return numberWeakCuts_;
+  }
+  inline void incrementNumberWeakCuts(int value = 1)
+  {
+    numberWeakCuts_ += value;
+  }
+  /// Number of cuts not added as round had enough
+  inline int numberCutsOverLimit() const
+  {
+    return numberCutsOverLimit_;
+  }
+  inline void incrementNumberCutsOverLimit(int value = 1)
+  {
+    numberCutsOverLimit_ += value;
+  }
   inline void setSwitchOffIfLessThan(int value)
   {
     switchOffIfLessThan_ = value;
@@ -512,6 +539,73 @@ public:
     switches_ &= ~256;
     switches_ |= yesNo ? 256 : 0;
   }
+  /// Whether frequency and depth are set automatically
+  inline bool automatic() const
+  {
+    return (switches_ & 524288) != 0;
+  }
+  /// Set whether frequency and depth are set automatically
+  inline void setAutomatic(bool yesNo)
+  {
+    switches_ &= ~524288;
+    switches_ |= yesNo ? 524288 : 0;
+  }
+  /// Sum of efficacy of row cuts added in this round (for sharing bound gain)
+  inline double roundEfficacy() const
+  {
+    return roundEfficacy_;
+  }
+  inline void setRoundEfficacy(double value)
+  {
+    roundEfficacy_ = value;
+  }
+  /// Adds share of bound gain of round and clears round efficacy
+  inline void creditRound(double gain, bool atRoot)
+  {
+    if (atRoot)
+      gainAtRoot_ += gain;
+    else
+      gainInTree_ += gain;
+    roundEfficacy_ = 0.0;
+  }
+  /// Bound gain credited at root
+  inline double gainAtRoot() const
+  {
+    return gainAtRoot_;
+  }
+  /// Bound gain credited in tree
+  inline double gainInTree() const
+  {
+    return gainInTree_;
+  }
+  inline void incrementGainInTree(double value)
+  {
+    gainInTree_ += value;
+  }
+  /// Seconds in generator in tree (if timing)
+  inline double timeInTree() const
+  {
+    return timeAtRoot_ >= 0.0 ? timeInCutGenerator_ - timeAtRoot_ : 0.0;
+  }
+  /** Automatic scheduling.
+
+      Bound gain per second of this generator is compared with averageRate
+      (all generators at root or in tree).  Generators producing long cuts
+      (more than twice rowDensity elements) are treated as less productive
+      as every resolve gets slower.  At root the generator gets every node,
+      every few nodes, top of tree only, root only or an occasional try.
+      In the tree the frequency or depth is loosened or tightened.
+      Returns new howOften (the caller sets it), depth is set here and the
+      reason kept for scheduleReason.
+  */
+  int schedule(bool atRoot, double averageRate, double rowDensity);
+  /// Why last automatic schedule was chosen
+  const char *scheduleReason() const;
+  /// Number of times automatic schedule changed frequency or depth
+  inline int numberScheduleChanges() const
+  {
+    return numberScheduleChanges_;
+  }
   /// Add in statistics from other
   void addStatistics(const CbcCutGenerator *other);
   /// Scale back statistics by factor
@@ -576,6 +670,26 @@ private:
   int numberActiveCutsAtRoot_;
   /// Number of short cuts at root
   int numberShortCutsAtRoot_;
+  /// Number of cuts rejected by cut selection as parallel
+  int numberParallelCuts_;
+  /// Number of cuts rejected by cut selection as weak
+  int numberWeakCuts_;
+  /// Number of cuts rejected by cut selection as over limit
+  int numberCutsOverLimit_;
+  /// Efficacy of row cuts in current round
+  double roundEfficacy_;
+  /// Bound gain credited at root
+  double gainAtRoot_;
+  /// Bound gain credited in tree
+  double gainInTree_;
+  /// Time in generator at end of root (-1.0 before)
+  double timeAtRoot_;
+  /// Times entered at end of root
+  int numberTimesAtRoot_;
+  /// Why last automatic schedule was chosen
+  int scheduleReason_;
+  /// Number of times automatic schedule changed something
+  int numberScheduleChanges_;
   /// Switches - see gets and sets
   int switches_;
   /// Maximum number of times to enter
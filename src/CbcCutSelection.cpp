@@ -0,0 +1,253 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#pragma warning(disable : 4786)
+#endif
+
+#include "CbcConfig.h"
+
+#include <cmath>
+#include <cstring>
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinSort.hpp"
+#include "OsiCuts.hpp"
+#include "OsiSolverInterface.hpp"
+#include "CbcModel.hpp"
+#include "CbcCutGenerator.hpp"
+#include "CbcCutSelection.hpp"
+
+// Signatures per cut and bits in each
+#define CBC_CUT_TABLES 4
+#define CBC_CUT_BITS 12
+
+namespace {
+// Pseudo-random hyperplane coefficient in [-1,1] for column and bit
+double hyperplane(int iColumn, int iBit)
+{
+  unsigned int hash = static_cast< unsigned int >(iColumn) * 2654435761u
+    + static_cast< unsigned int >(iBit) * 40503u;
+  hash ^= hash >> 15;
+  hash *= 2246822519u;
+  hash ^= hash >> 13;
+  hash *= 3266489917u;
+  hash ^= hash >> 16;
+  return static_cast< double >(hash) * (2.0 / 4294967295.0) - 1.0;
+}
+}
+
+CbcCutSelection::CbcCutSelection()
+  : maximumCutsAtRoot_(0)
+  , maximumCutsInTree_(0)
+  , maximumParallelism_(0.98)
+  , minimumEfficacy_(1.0e-6)
+  , efficacyWeight_(1.0)
+  , objectiveWeight_(0.1)
+  , integerWeight_(0.1)
+  , sparsityWeight_(0.1)
+{
+}
+
+int CbcCutSelection::select(CbcModel *model, const OsiCuts &cuts,
+  int numberGenerators, const int *generatorStart,
+  const double *solution, char *reject)
+{
+  int numberCuts = cuts.sizeRowCuts();
+  memset(reject, 0, numberCuts);
+  int firstCut = generatorStart[0];
+  int lastCut = generatorStart[numberGenerators];
+  int numberCandidates = lastCut - firstCut;
+  if (!maximumCutsAtRoot_ || numberCandidates <= 0)
+    return 0;
+  int maximumCuts = model->getNodeCount() ? maximumCutsInTree_ : maximumCutsAtRoot_;
+  OsiSolverInterface *solver = model->solver();
+  int numberColumns = solver->getNumCols();
+  const double *objective = solver->getObjCoefficients();
+  double objectiveNorm = 0.0;
+  for (int i = 0; i < numberColumns; i++)
+    objectiveNorm += objective[i] * objective[i];
+  objectiveNorm = sqrt(objectiveNorm);
+  int *which = new int[2 * numberCandidates];
+  int *generator = which + numberCandidates;
+  double *score = new double[4 * numberCandidates];
+  double *efficacy = score + numberCandidates;
+  double *norm = efficacy + numberCandidates;
+  double *other = norm + numberCandidates;
+  int numberScored = 0;
+  double bestEfficacy = 0.0;
+  int iGenerator = 0;
+  for (int k = firstCut; k < lastCut; k++) {
+    while (k >= generatorStart[iGenerator + 1])
+      iGenerator++;
+    const OsiRowCut *thisCut = cuts.rowCutPtr(k);
+    int n = thisCut->row().getNumElements();
+    // always keep lazy, infeasible and empty
+    if (!n || thisCut->lb() > thisCut->ub() || model->cutGenerator(iGenerator)->mustCallAgain())
+      continue;
+    const int *column = thisCut->row().getIndices();
+    const double *element = thisCut->row().getElements();
+    double sumSquares = 0.0;
+    double activity = 0.0;
+    double objectiveProduct = 0.0;
+    int numberInteger = 0;
+    for (int i = 0; i < n; i++) {
+      int iColumn = column[i];
+      double value = element[i];
+      sumSquares += value * value;
+      activity += value * solution[iColumn];
+      objectiveProduct += value * objective[iColumn];
+      if (solver->isInteger(iColumn))
+        numberInteger++;
+    }
+    double rowNorm = sqrt(sumSquares);
+    if (rowNorm < 1.0e-12)
+      continue;
+    // sign of norm says which side cut is
+    double violation;
+    if (activity > thisCut->ub()) {
+      violation = activity - thisCut->ub();
+    } else if (activity < thisCut->lb()) {
+      violation = thisCut->lb() - activity;
+      rowNorm = -rowNorm;
+    } else {
+      violation = 0.0;
+      if (thisCut->ub() > 1.0e30)
+        rowNorm = -rowNorm;
+    }
+    double thisEfficacy = violation / fabs(rowNorm);
+    which[numberScored] = k;
+    generator[numberScored] = iGenerator;
+    efficacy[numberScored] = thisEfficacy;
+    norm[numberScored] = rowNorm;
+    other[numberScored] = integerWeight_ * numberInteger / n
+      + sparsityWeight_ * (1.0 - static_cast< double >(n) / numberColumns);
+    if (objectiveNorm)
+      other[numberScored] += objectiveWeight_ * fabs(objectiveProduct) / (fabs(rowNorm) * objectiveNorm);
+    bestEfficacy = CoinMax(bestEfficacy, thisEfficacy);
+    numberScored++;
+  }
+  int numberRejected = 0;
+  // weak ones out - others sorted best first
+  int *order = new int[numberScored];
+  int numberOrdered = 0;
+  for (int j = 0; j < numberScored; j++) {
+    if (efficacy[j] < minimumEfficacy_) {
+      reject[which[j]] = 2;
+      model->cutGenerator(generator[j])->incrementNumberWeakCuts();
+      numberRejected++;
+    } else {
+      double thisScore = other[j];
+      if (bestEfficacy > 0.0)
+        thisScore += efficacyWeight_ * efficacy[j] / bestEfficacy;
+      score[numberOrdered] = -thisScore;
+      order[numberOrdered++] = j;
+    }
+  }
+  CoinSort_2(score, score + numberOrdered, order);
+  bool checkParallel = maximumParallelism_ < 1.0 && numberOrdered > 1;
+  int *first = NULL;
+  int *next = NULL;
+  int *taken = NULL;
+  int *checked = NULL;
+  double *work = NULL;
+  if (checkParallel) {
+    int sizeTable = CBC_CUT_TABLES << CBC_CUT_BITS;
+    first = new int[sizeTable];
+    for (int i = 0; i < sizeTable; i++)
+      first[i] = -1;
+    next = new int[CBC_CUT_TABLES * numberOrdered];
+    taken = new int[2 * numberOrdered];
+    checked = taken + numberOrdered;
+    work = new double[numberColumns];
+    memset(work, 0, numberColumns * sizeof(double));
+  }
+  int numberTaken = 0;
+  for (int iOrder = 0; iOrder < numberOrdered; iOrder++) {
+    int j = order[iOrder];
+    int k = which[j];
+    if (numberTaken >= maximumCuts) {
+      reject[k] = 3;
+      model->cutGenerator(generator[j])->incrementNumberCutsOverLimit();
+      numberRejected++;
+      continue;
+    }
+    if (!checkParallel) {
+      numberTaken++;
+      continue;
+    }
+    const OsiRowCut *thisCut = cuts.rowCutPtr(k);
+    int n = thisCut->row().getNumElements();
+    const int *column = thisCut->row().getIndices();
+    const double *element = thisCut->row().getElements();
+    double rowNorm = norm[j];
+    int signature[CBC_CUT_TABLES];
+    for (int iTable = 0; iTable < CBC_CUT_TABLES; iTable++)
+      signature[iTable] = 0;
+    for (int i = 0; i < n; i++)
+      work[column[i]] += element[i] / rowNorm;
+    for (int iTable = 0; iTable < CBC_CUT_TABLES; iTable++) {
+      for (int iBit = 0; iBit < CBC_CUT_BITS; iBit++) {
+        int kBit = iTable * CBC_CUT_BITS + iBit;
+        double product = 0.0;
+        for (int i = 0; i < n; i++)
+          product += element[i] * hyperplane(column[i], kBit);
+        if (product * rowNorm > 0.0)
+          signature[iTable] |= 1 << iBit;
+      }
+      signature[iTable] += iTable << CBC_CUT_BITS;
+    }
+    // compare with taken cuts sharing a signature
+    bool parallel = false;
+    for (int iTable = 0; iTable < CBC_CUT_TABLES && !parallel; iTable++) {
+      for (int m = first[signature[iTable]]; m >= 0; m = next[m]) {
+        int iTaken = m / CBC_CUT_TABLES;
+        if (checked[iTaken] == iOrder)
+          continue;
+        checked[iTaken] = iOrder;
+        int jTaken = taken[iTaken];
+        const OsiRowCut *otherCut = cuts.rowCutPtr(which[jTaken]);
+        int nOther = otherCut->row().getNumElements();
+        const int *columnOther = otherCut->row().getIndices();
+        const double *elementOther = otherCut->row().getElements();
+        double cosine = 0.0;
+        for (int i = 0; i < nOther; i++)
+          cosine += work[columnOther[i]] * elementOther[i];
+        cosine /= norm[jTaken];
+        if (cosine > maximumParallelism_) {
+          parallel = true;
+          break;
+        }
+      }
+    }
+    for (int i = 0; i < n; i++)
+      work[column[i]] = 0.0;
+    if (parallel) {
+      reject[k] = 1;
+      model->cutGenerator(generator[j])->incrementNumberParallelCuts();
+      numberRejected++;
+    } else {
+      taken[numberTaken] = j;
+      checked[numberTaken] = iOrder;
+      for (int iTable = 0; iTable < CBC_CUT_TABLES; iTable++) {
+        int m = numberTaken * CBC_CUT_TABLES + iTable;
+        next[m] = first[signature[iTable]];
+        first[signature[iTable]] = m;
+      }
+      numberTaken++;
+    }
+  }
+  delete[] first;
+  delete[] next;
+  delete[] taken;
+  delete[] work;
+  delete[] order;
+  delete[] which;
+  delete[] score;
+  return numberRejected;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,130 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+/*! \file CbcCutSelection.hpp
+    \brief Choosing which generated row cuts go into the LP.
+*/
+
+#ifndef CbcCutSelection_H
+#define CbcCutSelection_H
+
+#include "CbcConfig.h"
+
+class OsiCuts;
+class CbcModel;
+
+/** Cut selection.
+
+    Generators can return thousands of cuts in a round, many of them nearly
+    parallel.  Before a round of row cuts goes into the LP each candidate
+    is scored on
+      - efficacy - distance cut moves off the LP solution (violation over
+        norm), relative to the best in the round
+      - objective parallelism - |cosine| of angle with objective
+      - integer support - fraction of elements on integer variables
+      - sparsity - one minus fraction of columns in cut
+    and cuts are taken best first.  A cut is rejected if its efficacy is
+    below minimumEfficacy, if it is within maximumParallelism (cosine) of a
+    cut already taken or if the round already has its maximum number.
+
+    Parallel cuts are found by hashing not by comparing every pair.  Each
+    cut's direction is given a few short signatures from the signs of its
+    dot products with pseudo-random hyperplanes (as in SimHash) and a new
+    cut is only compared with taken cuts which share a signature.  Nearly
+    parallel cuts almost always share one so very few dot products are
+    needed.
+
+    Cuts from generators which must be called again (lazy constraints) are
+    never rejected.  Rejected cuts which are globally valid stay in the
+    global cut pool.
+
+    Selection is off until setMaximumCuts is called with a nonzero
+    maximum at root.  The cbc driver does this from maxCutsRound.
+*/
+
+class CBCLIB_EXPORT CbcCutSelection {
+public:
+  /// Default Constructor (selection off)
+  CbcCutSelection();
+
+  /** Marks cuts to reject.
+
+      Cuts first to generatorStart[numberGenerators]-1 in cuts are
+      candidates, with generatorStart[i] the first from generator i.  Cuts
+      before generatorStart[0] are always kept.  reject (size of cuts) is
+      set to 0 (keep), 1 (parallel), 2 (weak) or 3 (over limit).
+      Statistics of generators in model are updated.  Returns number
+      rejected.
+  */
+  int select(CbcModel *model, const OsiCuts &cuts,
+    int numberGenerators, const int *generatorStart,
+    const double *solution, char *reject);
+
+  /** Set maximum cuts taken in a round at root and in tree
+      (0 at root switches selection off) */
+  inline void setMaximumCuts(int atRoot, int inTree)
+  {
+    maximumCutsAtRoot_ = atRoot;
+    maximumCutsInTree_ = inTree;
+  }
+  /// Maximum cuts in a round at root (0 off)
+  inline int maximumCutsAtRoot() const
+  {
+    return maximumCutsAtRoot_;
+  }
+  /// Maximum cuts in a round in tree
+  inline int maximumCutsInTree() const
+  {
+    return maximumCutsInTree_;
+  }
+  /// Set maximum cosine between two cuts taken (1.0 no check)
+  inline void setMaximumParallelism(double value)
+  {
+    maximumParallelism_ = value;
+  }
+  /// Maximum cosine between two cuts taken
+  inline double maximumParallelism() const
+  {
+    return maximumParallelism_;
+  }
+  /// Set minimum efficacy of a cut to be taken
+  inline void setMinimumEfficacy(double value)
+  {
+    minimumEfficacy_ = value;
+  }
+  /// Minimum efficacy of a cut to be taken
+  inline double minimumEfficacy() const
+  {
+    return minimumEfficacy_;
+  }
+  /// Set weights of efficacy, objective parallelism, integer support and sparsity in score
+  inline void setWeights(double efficacy, double objective,
+    double integer, double sparsity)
+  {
+    efficacyWeight_ = efficacy;
+    objectiveWeight_ = objective;
+    integerWeight_ = integer;
+    sparsityWeight_ = sparsity;
+  }
+
+private:
+  /// Maximum cuts in a round at root (0 off)
+  int maximumCutsAtRoot_;
+  /// Maximum cuts in a round in tree
+  int maximumCutsInTree_;
+  /// Maximum cosine between two cuts taken
+  double maximumParallelism_;
+  /// Minimum efficacy
+  double minimumEfficacy_;
+  /// Weights in score
+  double efficacyWeight_;
+  double objectiveWeight_;
+  double integerWeight_;
+  double sparsityWeight_;
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
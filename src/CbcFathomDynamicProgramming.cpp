@@ -20,6 +20,32 @@
 #include "CoinHelperFunctions.hpp"
 #include "CoinPackedMatrix.hpp"
 #include "CoinSort.hpp"
+#ifdef CBC_THREAD
+#include <pthread.h>
+#endif
+// Do not split sweeps over threads below this many states
+#define CBC_DP_THREAD_SIZE 65536
+#define CBC_DP_MAX_THREADS 64
+// What one thread does in a sweep
+typedef struct {
+  CbcFathomDynamicProgramming *fathom;
+  /// 0,1,2 as addOneColumn - 3 sparse candidates
+  int type;
+  int numberElements;
+  const int *rows;
+  const int *coefficients;
+  double cost;
+  /// States (dense) or hash slots (sparse) to look at
+  int first;
+  int last;
+  const double *costIn;
+  /// Sparse output
+  int *nextState;
+  double *nextCost;
+  int *oldState;
+  int numberCandidates;
+  bool touched;
+} CbcDPSweepInfo;
 // Default Constructor
 CbcFathomDynamicProgramming::CbcFathomDynamicProgramming()
   : CbcFathom()
@@ -39,6 +65,19 @@ CbcFathomDynamicProgramming::CbcFathomDynamicProgramming()
   , numberNonOne_(0)
   , bitPattern_(0)
   , algorithm_(-1)
+  , stateMode_(0)
+  , numberThreads_(1)
+  , sparse_(false)
+  , hashSize_(0)
+  , numberStates_(0)
+  , hashState_(NULL)
+  , hashCost_(NULL)
+  , hashBack_(NULL)
+  , costWork_(NULL)
+  , candidateSize_(0)
+  , candidateState_(NULL)
+  , candidateCost_(NULL)
+  , candidateBack_(NULL)
 {
 }
 
@@ -59,6 +98,19 @@ CbcFathomDynamicProgramming::CbcFathomDynamicProgramming(CbcModel &model)
   , numberNonOne_(0)
   , bitPattern_(0)
   , algorithm_(-1)
+  , stateMode_(0)
+  , numberThreads_(1)
+  , sparse_(false)
+  , hashSize_(0)
+  , numberStates_(0)
+  , hashState_(NULL)
+  , hashCost_(NULL)
+  , hashBack_(NULL)
+  , costWork_(NULL)
+  , candidateSize_(0)
+  , candidateState_(NULL)
+  , candidateCost_(NULL)
+  , candidateBack_(NULL)
 {
   type_ = checkPossible();
 }
@@ -79,6 +131,13 @@ void CbcFathomDynamicProgramming::gutsOfDelete()
   delete[] numberBits_;
   delete[] rhs_;
   delete[] coefficients_;
+  delete[] hashState_;
+  delete[] hashCost_;
+  delete[] hashBack_;
+  delete[] costWork_;
+  delete[] candidateState_;
+  delete[] candidateCost_;
+  delete[] candidateBack_;
   cost_ = NULL;
   back_ = NULL;
   lookup_ = NULL;
@@ -87,6 +146,15 @@ void CbcFathomDynamicProgramming::gutsOfDelete()
   numberBits_ = NULL;
   rhs_ = NULL;
   coefficients_ = NULL;
+  hashState_ = NULL;
+  hashCost_ = NULL;
+  hashBack_ = NULL;
+  costWork_ = NULL;
+  candidateState_ = NULL;
+  candidateCost_ = NULL;
+  candidateBack_ = NULL;
+  candidateSize_ = 0;
+  hashSize_ = 0;
 }
 // Clone
 CbcFathom *
@@ -114,10 +182,26 @@ CbcFathomDynamicProgramming::CbcFathomDynamicProgramming(const CbcFathomDynamicP
   , numberNonOne_(rhs.numberNonOne_)
   , bitPattern_(rhs.bitPattern_)
   , algorithm_(rhs.algorithm_)
+  , stateMode_(rhs.stateMode_)
+  , numberThreads_(rhs.numberThreads_)
+  , sparse_(rhs.sparse_)
+  , hashSize_(rhs.hashSize_)
+  , numberStates_(rhs.numberStates_)
+  , hashState_(NULL)
+  , hashCost_(NULL)
+  , hashBack_(NULL)
+  , costWork_(NULL)
+  , candidateSize_(0)
+  , candidateState_(NULL)
+  , candidateCost_(NULL)
+  , candidateBack_(NULL)
 {
-  if (size_) {
+  if (size_ && (rhs.cost_ || rhs.hashState_)) {
     cost_ = CoinCopyOfArray(rhs.cost_, size_);
     back_ = CoinCopyOfArray(rhs.back_, size_);
+    hashState_ = CoinCopyOfArray(rhs.hashState_, hashSize_);
+    hashCost_ = CoinCopyOfArray(rhs.hashCost_, hashSize_);
+    hashBack_ = CoinCopyOfArray(rhs.hashBack_, hashSize_);
     int numberRows = model_->getNumRows();
     lookup_ = CoinCopyOfArray(rhs.lookup_, numberRows);
     startBit_ = CoinCopyOfArray(rhs.startBit_, numberActive_);
@@ -196,9 +280,11 @@ int CbcFathomDynamicProgramming::checkPossible(int allowableSize)
   // check size of array needed
   double size = 1.0;
   double check = COIN_INT_MAX;
+  int maxRhs = 0;
   for (i = 0; i < numberRows; i++) {
     int n = static_cast< int >(floor(rhs[i] + 0.5));
     if (n) {
+      maxRhs = CoinMax(maxRhs, n);
       n++; // allow for 0,1... n
       if (numberActive != 1) {
         // power of 2
@@ -250,21 +336,61 @@ int CbcFathomDynamicProgramming::checkPossible(int allowableSize)
     if (gap <= 1.0)
       n01++;
   }
-  if (allowableSize && size_ <= allowableSize) {
-    if (n01 == numberColumns && !nbadcoeff)
+  // dense or sparse storage
+  sparse_ = false;
+  bool doIt = false;
+  if (allowableSize && size_ < COIN_INT_MAX) {
+    if (stateMode_ == 2) {
+      sparse_ = true;
+    } else if (!stateMode_) {
+      /* bound on states which can be reached - each row can only get
+         to level of sum of what its columns can give */
+      double *rowSum = new double[numberRows];
+      CoinZeroN(rowSum, numberRows);
+      for (i = 0; i < numberColumns; i++) {
+        double gap = upper[i] - lower[i];
+        for (CoinBigIndex j = columnStart[i];
+             j < columnStart[i] + columnLength[i]; j++)
+          rowSum[row[j]] += gap * element[j];
+      }
+      double reachable = 1.0;
+      for (i = 0; i < numberRows; i++) {
+        double n = floor(rhs[i] + 0.5);
+        if (n)
+          reachable *= CoinMin(n, floor(rowSum[i] + 1.0e-7)) + 1.0;
+      }
+      delete[] rowSum;
+      // hash table costs about four times as much per state
+      if (size_ > allowableSize || 4.0 * reachable < size_)
+        sparse_ = true;
+    }
+    doIt = sparse_ || size_ <= allowableSize;
+  }
+  if (doIt) {
+    if (n01 == numberColumns && !nbadcoeff && maxRhs == 1)
       algorithm_ = 0; // easiest
     else
       algorithm_ = 1;
   }
-  if (allowableSize && size_ <= allowableSize) {
+  if (doIt) {
     numberActive_ = numberActive;
     indices_ = new int[numberActive_];
-    cost_ = new double[size_];
-    CoinFillN(cost_, size_, COIN_DBL_MAX);
-    // but do nothing is okay
-    cost_[0] = 0.0;
-    back_ = new int[size_];
-    CoinFillN(back_, size_, -1);
+    if (!sparse_) {
+      cost_ = new double[size_];
+      CoinFillN(cost_, size_, COIN_DBL_MAX);
+      // but do nothing is okay
+      cost_[0] = 0.0;
+      back_ = new int[size_];
+      CoinFillN(back_, size_, -1);
+    } else {
+      // just do nothing state
+      createHash(1024);
+      int iPosition = hashPosition(0);
+      hashState_[iPosition] = 0;
+      hashCost_[iPosition] = 0.0;
+      hashBack_[iPosition] = -1;
+      numberStates_ = 1;
+    }
     startBit_ = new int[numberActive_];
     numberBits_ = new int[numberActive_];
     lookup_ = new int[numberRows];
@@ -291,14 +417,6 @@ int CbcFathomDynamicProgramming::checkPossible(int allowableSize)
           // round up to next power of 2
           iBit++;
         }
-        if (numberActive != 1) {
-          n = 1 << iBit;
-          size *= n;
-          if (size >= check)
-            break;
-        } else {
-          size = n; // just one constraint
-        }
         numberBits_[numberActive++] = iBit;
         kBit += iBit;
       } else {
@@ -311,20 +429,23 @@ int CbcFathomDynamicProgramming::checkPossible(int allowableSize)
       // Get first possible solution for printing
       target_ = -1;
       int needed = 0;
-      int numberActive = 0;
       for (i = 0; i < numberRows; i++) {
         int newRow = lookup_[i];
         if (newRow >= 0) {
-          if (rowLower[i] == rowUpper[i]) {
-            needed += 1 << numberActive;
-            numberActive++;
-          }
+          // bit for row is its active row number
+          if (rowLower[i] == rowUpper[i])
+            needed |= 1 << newRow;
         }
       }
-      for (i = 0; i < size_; i++) {
-        if ((i & needed) == needed) {
-          break;
+      if (!sparse_) {
+        for (i = 0; i < size_; i++) {
+          if ((i & needed) == needed) {
+            break;
+          }
         }
+      } else {
+        // smallest such pattern
+        i = needed;
       }
       target_ = i;
     } else {
@@ -350,8 +471,8 @@ int CbcFathomDynamicProgramming::checkPossible(int allowableSize)
         }
         // adjust so k points to last
         k -= 2;
-        // and now rest
-        int k1 = 1;
+        // and now rest (from start if all rhs one)
+        int k1 = k < 0 ? 0 : 1;
         for (i = 0; i < numberRows; i++) {
           int newRow = lookup_[i];
           if (newRow >= 0 && rhs_[newRow] == 1) {
@@ -402,25 +523,34 @@ int CbcFathomDynamicProgramming::checkPossible(int allowableSize)
           }
         }
       }
-      for (i = 0; i < size_; i++) {
-        if ((i & needed) == needed) {
-          // this one may do
-          bool good = true;
-          for (int kk = 0; kk < numberActive_; kk++) {
-            int numberBits = numberBits_[kk];
-            int startBit = startBit_[kk];
-            int size = 1 << numberBits;
-            int start = 1 << startBit;
-            int mask = start * (size - 1);
-            int level = (i & mask) >> startBit;
-            if (level < lower2[kk]) {
-              good = false;
+      if (!sparse_) {
+        for (i = 0; i < size_; i++) {
+          if ((i & needed) == needed) {
+            // this one may do
+            bool good = true;
+            for (int kk = 0; kk < numberActive_; kk++) {
+              int numberBits = numberBits_[kk];
+              int startBit = startBit_[kk];
+              int size = 1 << numberBits;
+              int start = 1 << startBit;
+              int mask = start * (size - 1);
+              int level = (i & mask) >> startBit;
+              if (level < lower2[kk]) {
+                good = false;
+                break;
+              }
+            }
+            if (good) {
               break;
             }
           }
-          if (good) {
-            break;
-          }
+        }
+      } else {
+        // smallest pattern with every level high enough
+        i = needed;
+        for (int kk = 0; kk < numberActive_; kk++) {
+          if (lower2[kk] > 0)
+            i |= lower2[kk] << startBit_[kk];
         }
       }
       delete[] lower2;
@@ -428,7 +558,7 @@ int CbcFathomDynamicProgramming::checkPossible(int allowableSize)
     }
   }
   delete[] rhs;
-  if (allowableSize && size_ > allowableSize) {
+  if (allowableSize && !doIt) {
     COIN_DETAIL_PRINT(printf("Too large - need %d entries x 8 bytes\n", size_));
     return -1; // too big
   } else {
@@ -446,7 +576,8 @@ int CbcFathomDynamicProgramming::fathom(double *&betterSolution)
 {
   int returnCode = 0;
   int type = checkPossible(maximumSizeAllowed_);
-  assert(type != -1);
+  if (type == -1)
+    return 0; // too big
   if (type == -2) {
     // infeasible (so complete search done)
     return 1;
@@ -484,32 +615,42 @@ int CbcFathomDynamicProgramming::fathom(double *&betterSolution)
       int gap = static_cast< int >(upper[i] - lowerValue);
       CoinBigIndex start = columnStart[i];
       tryColumn(columnLength[i], row + start, element + start, cost, gap);
-      if (cost_[target_] < bestAtTarget) {
+      if (sparse_ && numberStates_ > maximumSizeAllowed_)
+        break;
+      double costAtTarget = stateCost(target_);
+      if (costAtTarget < bestAtTarget) {
         if (model_->messageHandler()->logLevel() > 1)
-          printf("At column %d new best objective of %g\n", i, cost_[target_]);
-        bestAtTarget = cost_[target_];
+          printf("At column %d new best objective of %g\n", i, costAtTarget);
+        bestAtTarget = costAtTarget;
       }
     }
+    if (sparse_ && numberStates_ > maximumSizeAllowed_) {
+      // too many states reached - give up
+      COIN_DETAIL_PRINT(printf("Too many states - more than %d\n", maximumSizeAllowed_));
+      gutsOfDelete();
+      return 0;
+    }
     returnCode = 1;
+    // states to look at
+    int numberLook = sparse_ ? hashSize_ : size_;
     int needed = 0;
     double bestValue = COIN_DBL_MAX;
     int iBest = -1;
     if (algorithm_ == 0) {
-      int numberActive = 0;
       for (i = 0; i < numberRows; i++) {
         int newRow = lookup_[i];
         if (newRow >= 0) {
-          if (rowLower[i] == rowUpper[i]) {
-            needed += 1 << numberActive;
-            numberActive++;
-          }
+          if (rowLower[i] == rowUpper[i])
+            needed |= 1 << newRow;
         }
       }
-      for (i = 0; i < size_; i++) {
-        if ((i & needed) == needed) {
+      for (int k = 0; k < numberLook; k++) {
+        i = sparse_ ? hashState_[k] : k;
+        if (i >= 0 && (i & needed) == needed) {
           // this one will do
-          if (cost_[i] < bestValue) {
-            bestValue = cost_[i];
+          double thisCost = sparse_ ? hashCost_[k] : cost_[i];
+          if (thisCost < bestValue) {
+            bestValue = thisCost;
             iBest = i;
           }
         }
@@ -528,8 +669,9 @@ int CbcFathomDynamicProgramming::fathom(double *&betterSolution)
           }
         }
       }
-      for (i = 0; i < size_; i++) {
-        if ((i & needed) == needed) {
+      for (int k = 0; k < numberLook; k++) {
+        i = sparse_ ? hashState_[k] : k;
+        if (i >= 0 && (i & needed) == needed) {
           // this one may do
           bool good = true;
           for (int kk = 0; kk < numberActive_; kk++) {
@@ -544,8 +686,9 @@ int CbcFathomDynamicProgramming::fathom(double *&betterSolution)
               break;
             }
           }
-          if (good && cost_[i] < bestValue) {
-            bestValue = cost_[i];
+          double thisCost = sparse_ ? hashCost_[k] : cost_[i];
+          if (good && thisCost < bestValue) {
+            bestValue = thisCost;
             iBest = i;
           }
         }
@@ -561,7 +704,8 @@ int CbcFathomDynamicProgramming::fathom(double *&betterSolution)
         betterSolution = new double[numberColumns];
         memcpy(betterSolution, lower, numberColumns * sizeof(double));
         while (iBest > 0) {
-          int n = decodeBitPattern(iBest - back_[iBest], indices_, numberRows);
+          int iBack = stateBack(iBest);
+          int n = decodeBitPattern(iBest - iBack, indices_, numberRows);
           // Search for cheapest
           double bestCost = COIN_DBL_MAX;
           int iColumn = -1;
@@ -587,7 +731,7 @@ int CbcFathomDynamicProgramming::fathom(double *&betterSolution)
           assert(iColumn >= 0);
           betterSolution[iColumn]++;
           assert(betterSolution[iColumn] <= upper[iColumn]);
-          iBest = back_[iBest];
+          iBest = iBack;
         }
       }
       // paranoid check
@@ -647,7 +791,7 @@ bool CbcFathomDynamicProgramming::tryColumn(int numberElements, const int *rows,
       }
     }
     if (n && upper) {
-      touched = addOneColumn0(n, indices_, cost);
+      touched = addOneColumn(0, n, indices_, NULL, cost);
     }
   } else {
     for (int j = 0; j < numberElements; j++) {
@@ -669,14 +813,14 @@ bool CbcFathomDynamicProgramming::tryColumn(int numberElements, const int *rows,
     if (n) {
       if (algorithm_ == 1) {
         for (int k = 1; k <= upper; k++) {
-          bool t = addOneColumn1(n, indices_, coefficients_, cost);
+          bool t = addOneColumn(1, n, indices_, coefficients_, cost);
           if (t)
             touched = true;
         }
       } else {
         CoinSort_2(indices_, indices_ + n, coefficients_);
         for (int k = 1; k <= upper; k++) {
-          bool t = addOneColumn1A(n, indices_, coefficients_, cost);
+          bool t = addOneColumn(2, n, indices_, coefficients_, cost);
           if (t)
             touched = true;
         }
@@ -689,7 +833,7 @@ bool CbcFathomDynamicProgramming::tryColumn(int numberElements, const int *rows,
    returns true if was used in making any changes
 */
 bool CbcFathomDynamicProgramming::addOneColumn0(int numberElements, const int *rows,
-  double cost)
+  double cost, int first, int last, const double *costIn)
 {
   // build up mask
   int mask = 0;
@@ -698,13 +842,14 @@ bool CbcFathomDynamicProgramming::addOneColumn0(int numberElements, const int *r
     int iRow = rows[i];
     mask |= 1 << iRow;
   }
-  bitPattern_ = mask;
-  i = size_ - 1 - mask;
+  if (!first)
+    bitPattern_ = mask;
+  i = CoinMin(size_ - 1 - mask, last);
   bool touched = false;
-  while (i >= 0) {
+  while (i >= first) {
     int kMask = i & mask;
     if (kMask == 0) {
-      double thisCost = cost_[i];
+      double thisCost = costIn[i];
       if (thisCost != COIN_DBL_MAX) {
         // possible
         double newCost = thisCost + cost;
@@ -735,7 +880,8 @@ bool CbcFathomDynamicProgramming::addOneColumn0(int numberElements, const int *r
    At present the user has to call it once for each possible value
 */
 bool CbcFathomDynamicProgramming::addOneColumn1(int numberElements, const int *rows,
-  const int *coefficients, double cost)
+  const int *coefficients, double cost, int first, int last,
+  const double *costIn)
 {
   /* build up masks.
        a) mask for 1 rhs
@@ -765,8 +911,9 @@ bool CbcFathomDynamicProgramming::addOneColumn1(int numberElements, const int *r
       int start = 1 << startBit;
       assert(value < size);
       maskAdd |= start * value;
-      int gap = size - rhs_[iRow] - 1;
-      assert(gap >= 0);
+      // overflows if level + value > rhs
+      int gap = size - rhs_[iRow] + value - 1;
+      assert(gap > 0 && gap <= size - 1);
       int hi2 = rhs_[iRow] - value;
       if (hi2 < size - 1)
         hi2++;
@@ -775,10 +922,11 @@ bool CbcFathomDynamicProgramming::addOneColumn1(int numberElements, const int *r
       mask[n2++] = start * (size - 1);
     }
   }
-  bitPattern_ = maskAdd;
-  i = size_ - 1 - maskAdd;
+  if (!first)
+    bitPattern_ = maskAdd;
+  i = CoinMin(size_ - 1 - maskAdd, last);
   bool touched = false;
-  while (i >= 0) {
+  while (i >= first) {
     int kMask = i & mask1;
     if (kMask == 0) {
       bool good = true;
@@ -816,7 +964,7 @@ bool CbcFathomDynamicProgramming::addOneColumn1(int numberElements, const int *r
         }
       }
       if (good) {
-        double thisCost = cost_[i];
+        double thisCost = costIn[i];
         if (thisCost != COIN_DBL_MAX) {
           // possible
           double newCost = thisCost + cost;
@@ -850,7 +998,8 @@ bool CbcFathomDynamicProgramming::addOneColumn1(int numberElements, const int *r
    This version is when there are enough 1 rhs to do faster
 */
 bool CbcFathomDynamicProgramming::addOneColumn1A(int numberElements, const int *rows,
-  const int *coefficients, double cost)
+  const int *coefficients, double cost, int first, int last,
+  const double *costIn)
 {
   /* build up masks.
        a) mask for 1 rhs
@@ -882,16 +1031,17 @@ bool CbcFathomDynamicProgramming::addOneColumn1A(int numberElements, const int *
       maskD |= start * (size - 1);
     }
   }
-  bitPattern_ = maskAdd;
+  if (!first)
+    bitPattern_ = maskAdd;
   int maskDiff = maskD - maskC;
-  i = size_ - 1 - maskAdd;
+  i = CoinMin(size_ - 1 - maskAdd, last);
   bool touched = false;
   if (!maskD) {
     // Just ones
-    while (i >= 0) {
+    while (i >= first) {
       int kMask = i & maskA;
       if (kMask == 0) {
-        double thisCost = cost_[i];
+        double thisCost = costIn[i];
         if (thisCost != COIN_DBL_MAX) {
           // possible
           double newCost = thisCost + cost;
@@ -911,14 +1061,14 @@ bool CbcFathomDynamicProgramming::addOneColumn1A(int numberElements, const int *
     }
   } else {
     // More general
-    while (i >= 0) {
+    while (i >= first) {
       int kMask = i & maskA;
       if (kMask == 0) {
         int added = i & maskD; // just bits belonging to non 1 rhs
         added += maskC; // will overflow mask if bad
         added &= (~maskD);
         if (added == 0) {
-          double thisCost = cost_[i];
+          double thisCost = costIn[i];
           if (thisCost != COIN_DBL_MAX) {
             // possible
             double newCost = thisCost + cost;
@@ -959,6 +1109,262 @@ bool CbcFathomDynamicProgramming::addOneColumn1A(int numberElements, const int *
   }
   return touched;
 }
+/* Adds one attempt of one column using addOneColumn0 (type 0),
+   addOneColumn1 (1) or addOneColumn1A (2) - or sparse version.
+   With threads each takes a range of states.  In type 0 states looked at
+   have no bits of column and states changed have all so no state is both
+   but otherwise costs are read from a copy.
+*/
+bool CbcFathomDynamicProgramming::addOneColumn(int type, int numberElements,
+  const int *rows, const int *coefficients, double cost)
+{
+  if (sparse_)
+    return addOneColumnSparse(numberElements, rows, type ? coefficients : NULL,
+      cost);
+  int numberThreads = 1;
+#ifdef CBC_THREAD
+  if (numberThreads_ > 1 && size_ >= CBC_DP_THREAD_SIZE)
+    numberThreads = CoinMin(numberThreads_, CBC_DP_MAX_THREADS);
+#endif
+  const double *costIn = cost_;
+  if (numberThreads > 1 && type) {
+    if (!costWork_)
+      costWork_ = new double[size_];
+    memcpy(costWork_, cost_, size_ * sizeof(double));
+    costIn = costWork_;
+  }
+  CbcDPSweepInfo info[CBC_DP_MAX_THREADS];
+  int chunk = (size_ + numberThreads - 1) / numberThreads;
+  for (int i = 0; i < numberThreads; i++) {
+    info[i].fathom = this;
+    info[i].type = type;
+    info[i].numberElements = numberElements;
+    info[i].rows = rows;
+    info[i].coefficients = coefficients;
+    info[i].cost = cost;
+    info[i].first = i * chunk;
+    info[i].last = CoinMin(size_, (i + 1) * chunk) - 1;
+    info[i].costIn = costIn;
+    info[i].touched = false;
+  }
+  runSweeps(info, numberThreads);
+  bool touched = false;
+  for (int i = 0; i < numberThreads; i++) {
+    if (info[i].touched)
+      touched = true;
+  }
+  return touched;
+}
+/* Runs sweeps in info[0..numberThreads-1] - on threads if more than one.
+   A sweep whose thread can not be started is done here.
+*/
+void CbcFathomDynamicProgramming::runSweeps(void *voidInfo, int numberThreads)
+{
+  CbcDPSweepInfo *info = reinterpret_cast< CbcDPSweepInfo * >(voidInfo);
+#ifdef CBC_THREAD
+  if (numberThreads > 1) {
+    pthread_t threadId[CBC_DP_MAX_THREADS];
+    bool started[CBC_DP_MAX_THREADS];
+    for (int i = 0; i < numberThreads; i++) {
+      started[i] = !pthread_create(&threadId[i], NULL, doSweep, info + i);
+      if (!started[i])
+        doSweep(info + i);
+    }
+    for (int i = 0; i < numberThreads; i++) {
+      if (started[i])
+        pthread_join(threadId[i], NULL);
+    }
+    return;
+  }
+#endif
+  for (int i = 0; i < numberThreads; i++)
+    doSweep(info + i);
+}
+// Runs sweep described by info (for threads)
+void *CbcFathomDynamicProgramming::doSweep(void *voidInfo)
+{
+  CbcDPSweepInfo *info = reinterpret_cast< CbcDPSweepInfo * >(voidInfo);
+  CbcFathomDynamicProgramming *fathom = info->fathom;
+  switch (info->type) {
+  case 0:
+    info->touched = fathom->addOneColumn0(info->numberElements, info->rows,
+      info->cost, info->first, info->last, info->costIn);
+    break;
+  case 1:
+    info->touched = fathom->addOneColumn1(info->numberElements, info->rows,
+      info->coefficients, info->cost, info->first, info->last, info->costIn);
+    break;
+  case 2:
+    info->touched = fathom->addOneColumn1A(info->numberElements, info->rows,
+      info->coefficients, info->cost, info->first, info->last, info->costIn);
+    break;
+  default:
+    info->numberCandidates = fathom->sparseCandidates(info->numberElements,
+      info->rows, info->coefficients, info->cost, info->first, info->last,
+      info->nextState, info->nextCost, info->oldState);
+    break;
+  }
+  return NULL;
+}
+/* Adds one attempt of one column when states are in hash table.
+   First all states which can take column are found (split over threads)
+   and then new states are added or costs reduced.
+*/
+bool CbcFathomDynamicProgramming::addOneColumnSparse(int numberElements,
+  const int *rows, const int *coefficients, double cost)
+{
+  if (numberStates_ > maximumSizeAllowed_)
+    return false; // given up
+  int numberThreads = 1;
+#ifdef CBC_THREAD
+  if (numberThreads_ > 1 && numberStates_ >= CBC_DP_THREAD_SIZE)
+    numberThreads = CoinMin(numberThreads_, CBC_DP_MAX_THREADS);
+#endif
+  // each thread puts candidates for its slots in same positions
+  if (candidateSize_ < hashSize_) {
+    delete[] candidateState_;
+    delete[] candidateCost_;
+    delete[] candidateBack_;
+    candidateSize_ = hashSize_;
+    candidateState_ = new int[candidateSize_];
+    candidateCost_ = new double[candidateSize_];
+    candidateBack_ = new int[candidateSize_];
+  }
+  int *nextState = candidateState_;
+  double *nextCost = candidateCost_;
+  int *oldState = candidateBack_;
+  CbcDPSweepInfo info[CBC_DP_MAX_THREADS];
+  int chunk = (hashSize_ + numberThreads - 1) / numberThreads;
+  for (int i = 0; i < numberThreads; i++) {
+    info[i].fathom = this;
+    info[i].type = 3;
+    info[i].numberElements = numberElements;
+    info[i].rows = rows;
+    info[i].coefficients = coefficients;
+    info[i].cost = cost;
+    info[i].first = i * chunk;
+    info[i].last = CoinMin(hashSize_, (i + 1) * chunk);
+    info[i].nextState = nextState + info[i].first;
+    info[i].nextCost = nextCost + info[i].first;
+    info[i].oldState = oldState + info[i].first;
+    info[i].numberCandidates = 0;
+  }
+  runSweeps(info, numberThreads);
+  bool touched = false;
+  for (int i = 0; i < numberThreads; i++) {
+    for (int k = 0; k < info[i].numberCandidates; k++) {
+      int state = info[i].nextState[k];
+      double newCost = info[i].nextCost[k];
+      int iPosition = hashPosition(state);
+      if (hashState_[iPosition] < 0) {
+        if (2 * (numberStates_ + 1) > hashSize_) {
+          createHash(2 * (numberStates_ + 1));
+          iPosition = hashPosition(state);
+        }
+        hashState_[iPosition] = state;
+        hashCost_[iPosition] = newCost;
+        hashBack_[iPosition] = info[i].oldState[k];
+        numberStates_++;
+        touched = true;
+      } else if (hashCost_[iPosition] > newCost) {
+        hashCost_[iPosition] = newCost;
+        hashBack_[iPosition] = info[i].oldState[k];
+        touched = true;
+      }
+    }
+  }
+  return touched;
+}
+/* Looks at hash table entries first..last-1 and saves possible
+   new states (next state, cost, old state) - returns number saved
+*/
+int CbcFathomDynamicProgramming::sparseCandidates(int numberElements,
+  const int *rows, const int *coefficients, double cost, int first, int last,
+  int *nextState, double *nextCost, int *oldState) const
+{
+  int n = 0;
+  for (int i = first; i < last; i++) {
+    int state = hashState_[i];
+    if (state < 0)
+      continue;
+    int newState = state;
+    bool good = true;
+    for (int k = 0; k < numberElements; k++) {
+      int iRow = rows[k];
+      int value = coefficients ? coefficients[k] : 1;
+      int startBit = startBit_[iRow];
+      int level = (state >> startBit) & ((1 << numberBits_[iRow]) - 1);
+      if (level + value > rhs_[iRow]) {
+        good = false;
+        break;
+      }
+      newState += value << startBit;
+    }
+    if (good) {
+      nextState[n] = newState;
+      nextCost[n] = hashCost_[i] + cost;
+      oldState[n++] = state;
+    }
+  }
+  return n;
+}
+// Position of state in hash table (or empty slot where it would go)
+int CbcFathomDynamicProgramming::hashPosition(int state) const
+{
+  unsigned int hash = static_cast< unsigned int >(state) * 2654435761U;
+  int mask = hashSize_ - 1;
+  int iPosition = static_cast< int >(hash ^ (hash >> 16)) & mask;
+  while (hashState_[iPosition] >= 0 && hashState_[iPosition] != state)
+    iPosition = (iPosition + 1) & mask;
+  return iPosition;
+}
+// Sets up hash table with room for about numberStates (keeping any states)
+void CbcFathomDynamicProgramming::createHash(int numberStates)
+{
+  int *oldState = hashState_;
+  double *oldCost = hashCost_;
+  int *oldBack = hashBack_;
+  int oldSize = hashSize_;
+  hashSize_ = 16;
+  while (hashSize_ < 2 * numberStates)
+    hashSize_ *= 2;
+  hashState_ = new int[hashSize_];
+  hashCost_ = new double[hashSize_];
+  hashBack_ = new int[hashSize_];
+  CoinFillN(hashState_, hashSize_, -1);
+  for (int i = 0; i < oldSize; i++) {
+    int state = oldState[i];
+    if (state >= 0) {
+      int iPosition = hashPosition(state);
+      hashState_[iPosition] = state;
+      hashCost_[iPosition] = oldCost[i];
+      hashBack_[iPosition] = oldBack[i];
+    }
+  }
+  delete[] oldState;
+  delete[] oldCost;
+  delete[] oldBack;
+}
+// Cost of state (COIN_DBL_MAX if not reached)
+double CbcFathomDynamicProgramming::stateCost(int state) const
+{
+  if (state < 0 || state >= size_)
+    return COIN_DBL_MAX;
+  if (!sparse_)
+    return cost_[state];
+  int iPosition = hashPosition(state);
+  return hashState_[iPosition] >= 0 ? hashCost_[iPosition] : COIN_DBL_MAX;
+}
+// State which produced this one (-1 if none)
+int CbcFathomDynamicProgramming::stateBack(int state) const
+{
+  if (state < 0 || state >= size_)
+    return -1;
+  if (!sparse_)
+    return back_[state];
+  int iPosition = hashPosition(state);
+  return hashState_[iPosition] >= 0 ? hashBack_[iPosition] : -1;
+}
 // update model
 void CbcFathomDynamicProgramming::setModel(CbcModel *model)
 {
@@ -22,6 +22,16 @@
 
     The main limiting factor is size of state space.  Each 1 rhs doubles the size of the problem.
     2 or 3 rhs quadruples, 4,5,6,7 by 8 etc.
+
+    States can be held densely (cost and back arrays indexed by bit pattern)
+    or sparsely in a hash table holding only states reached.  By default
+    checkPossible uses sparse storage if the dense arrays would be too
+    large or if a bound on the number of reachable states is well below
+    the size of the bit pattern space.  In sparse mode the search gives up
+    (fathom returns 0) if more than maximumSize states are reached.
+
+    With more than one thread each column sweep is split over disjoint
+    ranges of states (needs CBC_THREAD and a large enough state space).
  */
 
 class CBCLIB_EXPORT CbcFathomDynamicProgramming : public CbcFathom {
@@ -64,6 +74,35 @@ public:
   {
     maximumSizeAllowed_ = value;
   }
+  /** State storage - 0 choose automatically, 1 always dense,
+      2 always sparse (hash table) */
+  inline int stateMode() const
+  {
+    return stateMode_;
+  }
+  inline void setStateMode(int value)
+  {
+    stateMode_ = value;
+  }
+  /// Number of threads used in column sweeps
+  inline int numberThreads() const
+  {
+    return numberThreads_;
+  }
+  inline void setNumberThreads(int value)
+  {
+    numberThreads_ = value;
+  }
+  /// True if states are held in hash table (after checkPossible)
+  inline bool isSparse() const
+  {
+    return sparse_;
+  }
+  /// Number of states reached (sparse) or size of state space (dense)
+  inline int numberStates() const
+  {
+    return sparse_ ? numberStates_ : size_;
+  }
   /// Returns type of algorithm and sets up arrays
   int checkPossible(int allowableSize = 0);
   // set algorithm
@@ -77,16 +116,20 @@ public:
   bool tryColumn(int numberElements, const int *rows,
     const double *coefficients, double cost,
     int upper = COIN_INT_MAX);
-  /// Returns cost array
+  /// Returns cost array (NULL if sparse - see stateCost)
   inline const double *cost() const
   {
     return cost_;
   }
-  /// Returns back array
+  /// Returns back array (NULL if sparse - see stateBack)
   inline const int *back() const
   {
     return back_;
   }
+  /// Cost of state (COIN_DBL_MAX if not reached)
+  double stateCost(int state) const;
+  /// State which produced this one (-1 if none)
+  int stateBack(int state) const;
   /// Gets bit pattern for target result
   inline int target() const
   {
@@ -102,24 +145,54 @@ private:
   /// Does deleteions
   void gutsOfDelete();
 
-  /** Adds one attempt of one column of type 0,
+  /** Adds one attempt of one column using addOneColumn0 (type 0),
+        addOneColumn1 (1) or addOneColumn1A (2) - or sparse version.
+        Splits states over threads if worthwhile.
         returns true if was used in making any changes
     */
+  bool addOneColumn(int type, int numberElements, const int *rows,
+    const int *coefficients, double cost);
+  /** Adds one attempt of one column of type 0,
+        returns true if was used in making any changes.
+        Only states first..last are looked at and costs of old
+        states are taken from costIn.
+    */
   bool addOneColumn0(int numberElements, const int *rows,
-    double cost);
+    double cost, int first, int last, const double *costIn);
   /** Adds one attempt of one column of type 1,
         returns true if was used in making any changes.
         At present the user has to call it once for each possible value
     */
   bool addOneColumn1(int numberElements, const int *rows,
-    const int *coefficients, double cost);
+    const int *coefficients, double cost,
+    int first, int last, const double *costIn);
   /** Adds one attempt of one column of type 1,
         returns true if was used in making any changes.
         At present the user has to call it once for each possible value.
         This version is when there are enough 1 rhs to do faster
     */
   bool addOneColumn1A(int numberElements, const int *rows,
+    const int *coefficients, double cost,
+    int first, int last, const double *costIn);
+  /** Adds one attempt of one column when states are in hash table.
+        coefficients NULL means all 1.
+        returns true if was used in making any changes
+    */
+  bool addOneColumnSparse(int numberElements, const int *rows,
     const int *coefficients, double cost);
+  /** Looks at hash table entries first..last-1 and saves possible
+        new states (next state, cost, old state) - returns number saved */
+  int sparseCandidates(int numberElements, const int *rows,
+    const int *coefficients, double cost, int first, int last,
+    int *nextState, double *nextCost, int *oldState) const;
+  /// Position of state in hash table (or empty slot where it would go)
+  int hashPosition(int state) const;
+  /// Sets up hash table with room for about numberStates (keeps states)
+  void createHash(int numberStates);
+  /// Runs sweep described by info (for threads)
+  static void *doSweep(void *info);
+  /// Runs numberThreads sweeps in info (threads if more than one)
+  static void runSweeps(void *info, int numberThreads);
   /// Gets bit pattern from original column
   int bitPattern(int numberElements, const int *rows,
     const int *coefficients);
@@ -164,6 +237,32 @@ protected:
   int bitPattern_;
   /// Current algorithm
   int algorithm_;
+  /// State storage - 0 automatic, 1 dense, 2 sparse
+  int stateMode_;
+  /// Number of threads for sweeps
+  int numberThreads_;
+  /// True if states are in hash table
+  bool sparse_;
+  /// Hash table size (power of 2, 0 if dense)
+  int hashSize_;
+  /// Number of states in hash table
+  int numberStates_;
+  /// States in hash table (-1 if slot empty)
+  int *hashState_;
+  /// Cost of states in hash table
+  double *hashCost_;
+  /// Back pointers of states in hash table
+  int *hashBack_;
+  /// Copy of costs for threaded sweeps
+  double *costWork_;
+  /// Size of candidate arrays for sparse sweeps (kept between columns)
+  int candidateSize_;
+  /// New states found by sparse sweeps
+  int *candidateState_;
+  /// Costs of new states found by sparse sweeps
+  double *candidateCost_;
+  /// States new states came from in sparse sweeps
+  int *candidateBack_;
 
 private:
   /// Illegal Assignment operator
@@ -381,6 +381,8 @@ CbcGeneralDepth::createCbcBranch(OsiSolverInterface *solver, const OsiBranchingI
       }
     }
     assert(iProb == numberDo);
+    // for statistics - these go back to tree as CbcSubProblems
+    model_->incrementFastNodeInfo(0, numberDo);
     CoinSort_2(weight, weight + numberDo, whichNode);
     for (iProb = 0; iProb < numberDo; iProb++) {
       iNode = whichNode[iProb];
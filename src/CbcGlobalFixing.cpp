@@ -0,0 +1,336 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#pragma warning(disable : 4786)
+#endif
+
+#include "CbcConfig.h"
+
+#include <cmath>
+
+#include "CoinFinite.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "OsiSolverInterface.hpp"
+#include "CbcGlobalFixing.hpp"
+
+CbcGlobalFixing::CbcGlobalFixing()
+  : lastCutoff_(COIN_DBL_MAX)
+  , maximumRecords_(0)
+  , nextRecord_(1)
+  , infeasible_(false)
+  , numberRecorded_(0)
+  , numberTightened_(0)
+  , numberFixed_(0)
+  , numberNodesChanged_(0)
+  , numberNodesPruned_(0)
+{
+}
+
+CbcGlobalFixing::CbcGlobalFixing(const CbcGlobalFixing &rhs)
+  : record_(rhs.record_)
+  , lower_(rhs.lower_)
+  , upper_(rhs.upper_)
+  , changed_(rhs.changed_)
+  , isChanged_(rhs.isChanged_)
+  , lastCutoff_(rhs.lastCutoff_)
+  , maximumRecords_(rhs.maximumRecords_)
+  , nextRecord_(rhs.nextRecord_)
+  , infeasible_(rhs.infeasible_)
+  , numberRecorded_(rhs.numberRecorded_)
+  , numberTightened_(rhs.numberTightened_)
+  , numberFixed_(rhs.numberFixed_)
+  , numberNodesChanged_(rhs.numberNodesChanged_)
+  , numberNodesPruned_(rhs.numberNodesPruned_)
+{
+}
+
+CbcGlobalFixing &
+CbcGlobalFixing::operator=(const CbcGlobalFixing &rhs)
+{
+  if (this != &rhs) {
+    record_ = rhs.record_;
+    lower_ = rhs.lower_;
+    upper_ = rhs.upper_;
+    changed_ = rhs.changed_;
+    isChanged_ = rhs.isChanged_;
+    lastCutoff_ = rhs.lastCutoff_;
+    maximumRecords_ = rhs.maximumRecords_;
+    nextRecord_ = rhs.nextRecord_;
+    infeasible_ = rhs.infeasible_;
+    numberRecorded_ = rhs.numberRecorded_;
+    numberTightened_ = rhs.numberTightened_;
+    numberFixed_ = rhs.numberFixed_;
+    numberNodesChanged_ = rhs.numberNodesChanged_;
+    numberNodesPruned_ = rhs.numberNodesPruned_;
+  }
+  return *this;
+}
+
+CbcGlobalFixing::~CbcGlobalFixing()
+{
+}
+
+void CbcGlobalFixing::setMaximumRecords(int value)
+{
+  maximumRecords_ = CoinMax(value, 0);
+  clear();
+}
+
+void CbcGlobalFixing::clear()
+{
+  record_.clear();
+  lower_.clear();
+  upper_.clear();
+  changed_.clear();
+  isChanged_.clear();
+  lastCutoff_ = COIN_DBL_MAX;
+  nextRecord_ = 1;
+  infeasible_ = false;
+  zeroStatistics();
+}
+
+void CbcGlobalFixing::zeroStatistics()
+{
+  numberRecorded_ = 0;
+  numberTightened_ = 0;
+  numberFixed_ = 0;
+  numberNodesChanged_ = 0;
+  numberNodesPruned_ = 0;
+}
+
+void CbcGlobalFixing::addStatistics(const CbcGlobalFixing &rhs)
+{
+  numberRecorded_ += rhs.numberRecorded_;
+  numberTightened_ += rhs.numberTightened_;
+  numberFixed_ += rhs.numberFixed_;
+  numberNodesChanged_ += rhs.numberNodesChanged_;
+  numberNodesPruned_ += rhs.numberNodesPruned_;
+}
+
+void CbcGlobalFixing::markChanged(int iColumn)
+{
+  if (!isChanged_[iColumn]) {
+    isChanged_[iColumn] = 1;
+    changed_.push_back(iColumn);
+  }
+}
+
+void CbcGlobalFixing::record(const OsiSolverInterface *solver, int numberRows,
+  int numberIntegers, const int *integerVariable, bool atRoot,
+  double cutoff)
+{
+  if (!maximumRecords_ || (!atRoot && maximumRecords_ == 1))
+    return;
+  int numberColumns = solver->getNumCols();
+  const double *lower = solver->getColLower();
+  const double *upper = solver->getColUpper();
+  if (atRoot) {
+    // bounds at root are global
+    if (static_cast< int >(lower_.size()) != numberColumns) {
+      lower_.assign(lower, lower + numberColumns);
+      upper_.assign(upper, upper + numberColumns);
+      changed_.clear();
+      isChanged_.assign(numberColumns, 0);
+      record_.assign(maximumRecords_, Record());
+      nextRecord_ = 1;
+    } else {
+      for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+        lower_[iColumn] = CoinMax(lower_[iColumn], lower[iColumn]);
+        upper_[iColumn] = CoinMin(upper_[iColumn], upper[iColumn]);
+      }
+    }
+  } else if (static_cast< int >(lower_.size()) != numberColumns) {
+    return;
+  }
+  double direction = solver->getObjSense();
+  double infinity = solver->getInfinity();
+  const double *objective = solver->getObjCoefficients();
+  const double *solution = solver->getColSolution();
+  const double *rowPrice = solver->getRowPrice();
+  const double *rowLower = solver->getRowLower();
+  const double *rowUpper = solver->getRowUpper();
+  numberRows = CoinMin(numberRows, solver->getNumRows());
+  // y b using side each dual says (zero if that side infinite)
+  std::vector< double > dual(numberRows);
+  double bound = 0.0;
+  double sumAbsolute = 0.0;
+  for (int iRow = 0; iRow < numberRows; iRow++) {
+    double value = direction * rowPrice[iRow];
+    if (value > 0.0 && rowLower[iRow] > -infinity) {
+      dual[iRow] = value;
+      value *= rowLower[iRow];
+    } else if (value < 0.0 && rowUpper[iRow] < infinity) {
+      dual[iRow] = value;
+      value *= rowUpper[iRow];
+    } else {
+      dual[iRow] = 0.0;
+      value = 0.0;
+    }
+    bound += value;
+    sumAbsolute += fabs(value);
+  }
+  // d = c - A'y (so row duals not used are folded back in)
+  const CoinPackedMatrix *matrix = solver->getMatrixByCol();
+  const CoinBigIndex *columnStart = matrix->getVectorStarts();
+  const int *columnLength = matrix->getVectorLengths();
+  const int *row = matrix->getIndices();
+  const double *element = matrix->getElements();
+  std::vector< double > reducedCost(numberColumns);
+  std::vector< double > minimum(numberColumns);
+  double objectiveAtSolution = 0.0;
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    double value = direction * objective[iColumn];
+    objectiveAtSolution += value * solution[iColumn];
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+      int iRow = row[j];
+      if (iRow < numberRows)
+        value -= dual[iRow] * element[j];
+    }
+    reducedCost[iColumn] = value;
+    // minimum of d x over global bounds
+    double smallest = 0.0;
+    if (value > 1.0e-12) {
+      if (lower_[iColumn] <= -infinity)
+        return;
+      smallest = value * lower_[iColumn];
+    } else if (value < -1.0e-12) {
+      if (upper_[iColumn] >= infinity)
+        return;
+      smallest = value * upper_[iColumn];
+    }
+    minimum[iColumn] = smallest;
+    bound += smallest;
+    sumAbsolute += fabs(smallest);
+  }
+  // objective offset as solver sees it
+  bound += direction * solver->getObjValue() - objectiveAtSolution;
+  // allow for rounding error
+  bound -= 1.0e-9 * (sumAbsolute + fabs(bound)) + 1.0e-7;
+  int iRecord;
+  if (atRoot) {
+    iRecord = 0;
+  } else {
+    iRecord = nextRecord_;
+    nextRecord_++;
+    if (nextRecord_ == maximumRecords_)
+      nextRecord_ = 1;
+  }
+  Record &thisRecord = record_[iRecord];
+  thisRecord.column.clear();
+  thisRecord.reducedCost.clear();
+  thisRecord.constant.clear();
+  for (int i = 0; i < numberIntegers; i++) {
+    int iColumn = integerVariable[i];
+    double value = reducedCost[iColumn];
+    if (fabs(value) > 1.0e-9 && upper_[iColumn] > lower_[iColumn]) {
+      thisRecord.column.push_back(iColumn);
+      thisRecord.reducedCost.push_back(value);
+      thisRecord.constant.push_back(bound - minimum[iColumn]);
+    }
+  }
+  numberRecorded_++;
+  tighten(iRecord, cutoff);
+}
+
+void CbcGlobalFixing::tighten(int iRecord, double cutoff)
+{
+  if (cutoff > 1.0e40)
+    return;
+  const Record &thisRecord = record_[iRecord];
+  double tolerance = 1.0e-6 * (1.0 + fabs(cutoff));
+  int n = static_cast< int >(thisRecord.column.size());
+  for (int k = 0; k < n; k++) {
+    int iColumn = thisRecord.column[k];
+    double value = (cutoff + tolerance - thisRecord.constant[k]) / thisRecord.reducedCost[k];
+    if (fabs(value) > 1.0e15)
+      continue;
+    if (thisRecord.reducedCost[k] > 0.0) {
+      double newUpper = floor(value + 1.0e-5);
+      if (newUpper < upper_[iColumn]) {
+        upper_[iColumn] = newUpper;
+        numberTightened_++;
+        markChanged(iColumn);
+        if (newUpper == lower_[iColumn])
+          numberFixed_++;
+      }
+    } else {
+      double newLower = ceil(value - 1.0e-5);
+      if (newLower > lower_[iColumn]) {
+        lower_[iColumn] = newLower;
+        numberTightened_++;
+        markChanged(iColumn);
+        if (newLower == upper_[iColumn])
+          numberFixed_++;
+      }
+    }
+    if (lower_[iColumn] > upper_[iColumn])
+      infeasible_ = true;
+  }
+}
+
+int CbcGlobalFixing::apply(OsiSolverInterface *solver, double cutoff)
+{
+  if (lower_.empty() || solver->getNumCols() != static_cast< int >(lower_.size()))
+    return 0;
+  if (cutoff < lastCutoff_) {
+    lastCutoff_ = cutoff;
+    for (int iRecord = 0; iRecord < static_cast< int >(record_.size()); iRecord++)
+      tighten(iRecord, cutoff);
+  }
+  if (infeasible_) {
+    numberNodesPruned_++;
+    return 1;
+  }
+  const double *lower = solver->getColLower();
+  const double *upper = solver->getColUpper();
+  bool changed = false;
+  for (size_t k = 0; k < changed_.size(); k++) {
+    int iColumn = changed_[k];
+    double newLower = CoinMax(lower[iColumn], lower_[iColumn]);
+    double newUpper = CoinMin(upper[iColumn], upper_[iColumn]);
+    if (newLower > newUpper) {
+      numberNodesPruned_++;
+      return 1;
+    }
+    if (newLower > lower[iColumn]) {
+      solver->setColLower(iColumn, newLower);
+      changed = true;
+    }
+    if (newUpper < upper[iColumn]) {
+      solver->setColUpper(iColumn, newUpper);
+      changed = true;
+    }
+  }
+  if (changed)
+    numberNodesChanged_++;
+  return 0;
+}
+
+void CbcGlobalFixing::mergeBounds(const CbcGlobalFixing &rhs)
+{
+  if (lower_.size() != rhs.lower_.size())
+    return;
+  for (size_t k = 0; k < rhs.changed_.size(); k++) {
+    int iColumn = rhs.changed_[k];
+    if (rhs.lower_[iColumn] > lower_[iColumn]) {
+      lower_[iColumn] = rhs.lower_[iColumn];
+      markChanged(iColumn);
+    }
+    if (rhs.upper_[iColumn] < upper_[iColumn]) {
+      upper_[iColumn] = rhs.upper_[iColumn];
+      markChanged(iColumn);
+    }
+    if (lower_[iColumn] > upper_[iColumn])
+      infeasible_ = true;
+  }
+  if (rhs.infeasible_)
+    infeasible_ = true;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,151 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+/*! \file CbcGlobalFixing.hpp
+    \brief Store of reduced costs giving globally valid bounds.
+*/
+
+#ifndef CbcGlobalFixing_H
+#define CbcGlobalFixing_H
+
+#include <vector>
+
+#include "CbcConfig.h"
+
+class OsiSolverInterface;
+
+/** Global reduced cost fixing.
+
+    CbcModel::reducedCostFix only uses the reduced costs of the current
+    LP and the bounds it finds are only valid in that subtree.  Here the
+    duals of an LP are turned into a bound which is valid everywhere.
+    With row duals y (cut rows dropped at nodes as they may be local) and
+    d = c - A'y,
+
+      c x >= y b + sum d(j) x(j) >= K(j) + d(j) x(j)
+
+    where K(j) is y b plus the minimum of d(k) x(k) over the global bounds
+    for all k other than j.  This holds for any y so local bounds and local
+    cuts do not matter.  For each integer variable with a nonzero d(j) the
+    pair (d(j), K(j)) is kept.
+
+    Whenever the cutoff improves all kept pairs are looked at again and
+    x(j) <= (cutoff - K(j)) / d(j) (or >= if d(j) negative) tightens the
+    global bounds.  The new bounds are not pushed into the tree; a node
+    picks them up when it is next selected (apply) and if they conflict
+    with its own bounds it is pruned.
+
+    The pairs from the last root LP are always kept and those from up to
+    maximumRecords-1 node LPs, a new one replacing the oldest.
+*/
+
+class CBCLIB_EXPORT CbcGlobalFixing {
+public:
+  /// Default Constructor (off)
+  CbcGlobalFixing();
+
+  /// Copy constructor
+  CbcGlobalFixing(const CbcGlobalFixing &rhs);
+
+  /// Assignment
+  CbcGlobalFixing &operator=(const CbcGlobalFixing &rhs);
+
+  /// Destructor
+  ~CbcGlobalFixing();
+
+  /// Set maximum number of LPs kept (0 switches off) - clears store
+  void setMaximumRecords(int value);
+  /// Maximum number of LPs kept (0 off)
+  inline int maximumRecords() const
+  {
+    return maximumRecords_;
+  }
+  /// Empties store and zeroes statistics (e.g. at start of search)
+  void clear();
+
+  /** Keeps reduced cost information from optimal LP in solver.
+      Only the first numberRows rows are used.  At the root the bounds
+      of the solver are taken as global bounds.  Pairs are looked at at
+      once against cutoff. */
+  void record(const OsiSolverInterface *solver, int numberRows,
+    int numberIntegers, const int *integerVariable, bool atRoot,
+    double cutoff);
+  /** Puts any tighter global bounds into solver (after looking at all
+      pairs again if cutoff has improved).  Returns 1 if node infeasible. */
+  int apply(OsiSolverInterface *solver, double cutoff);
+  /// Tightens global bounds using those of another store (e.g. thread)
+  void mergeBounds(const CbcGlobalFixing &rhs);
+
+  /// Add in statistics from another store (e.g. thread)
+  void addStatistics(const CbcGlobalFixing &rhs);
+  /// Zero statistics
+  void zeroStatistics();
+  /// Number of LPs kept
+  inline int numberRecorded() const
+  {
+    return numberRecorded_;
+  }
+  /// Number of global bounds tightened
+  inline int numberTightened() const
+  {
+    return numberTightened_;
+  }
+  /// Number of variables fixed globally
+  inline int numberFixed() const
+  {
+    return numberFixed_;
+  }
+  /// Number of nodes whose bounds were tightened when selected
+  inline int numberNodesChanged() const
+  {
+    return numberNodesChanged_;
+  }
+  /// Number of nodes pruned when selected
+  inline int numberNodesPruned() const
+  {
+    return numberNodesPruned_;
+  }
+
+private:
+  /// Tightens global bounds using one LP
+  void tighten(int iRecord, double cutoff);
+  /// Marks column as having tighter global bound
+  void markChanged(int iColumn);
+
+  /// Reduced cost pairs for one LP
+  struct Record {
+    std::vector< int > column;
+    std::vector< double > reducedCost;
+    std::vector< double > constant;
+  };
+  /// Pairs for each LP kept (0 is root)
+  std::vector< Record > record_;
+  /// Global lower bounds (empty until root LP seen)
+  std::vector< double > lower_;
+  /// Global upper bounds
+  std::vector< double > upper_;
+  /// Columns with tighter global bounds than at root
+  std::vector< int > changed_;
+  /// Whether column in changed_
+  std::vector< char > isChanged_;
+  /// Cutoff used last time all pairs looked at
+  double lastCutoff_;
+  /// Maximum LPs kept
+  int maximumRecords_;
+  /// Next node record to replace
+  int nextRecord_;
+  /// True if global bounds conflict (nothing better than cutoff)
+  bool infeasible_;
+  /// Statistics
+  int numberRecorded_;
+  int numberTightened_;
+  int numberFixed_;
+  int numberNodesChanged_;
+  int numberNodesPruned_;
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -32,6 +32,7 @@
 #include "OsiRowCutDebugger.hpp"
 #include "OsiPresolve.hpp"
 #include "CbcBranchActual.hpp"
+#include "CbcSimpleIntegerDynamicPseudoCost.hpp"
 #include "CbcCutGenerator.hpp"
 #include "CoinMpsIO.hpp"
 //==============================================================================
@@ -684,6 +685,89 @@ static double sizeRatio(int numberRowsNow, int numberColumnsNow,
     return 2.0 * (valueNow / valueStart);
 }
 
+/* Global cuts of model which can be written in terms of columns left by
+   preprocessing (any column dropped must be fixed in solver) */
+static void restartGlobalCuts(CbcModel *model, const OsiSolverInterface *solver,
+  const int *originalColumns, int numberColumns2, CglStored &cuts)
+{
+  CbcRowCuts *globalCuts = model->globalCuts();
+  int numberCuts = globalCuts->sizeRowCuts();
+  if (!numberCuts || !numberColumns2)
+    return;
+  int numberColumns = solver->getNumCols();
+  const double *lower = solver->getColLower();
+  const double *upper = solver->getColUpper();
+  int *newColumn = new int[numberColumns];
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+    newColumn[iColumn] = -1;
+  for (int iColumn = 0; iColumn < numberColumns2; iColumn++)
+    newColumn[originalColumns[iColumn]] = iColumn;
+  int *which = new int[numberColumns2];
+  double *elements = new double[numberColumns2];
+  for (int iCut = 0; iCut < numberCuts; iCut++) {
+    const OsiRowCut *cut = globalCuts->rowCutPtr(iCut);
+    const CoinPackedVector &row = cut->row();
+    int n = row.getNumElements();
+    const int *column = row.getIndices();
+    const double *element = row.getElements();
+    double lb = cut->lb();
+    double ub = cut->ub();
+    int n2 = 0;
+    int j;
+    for (j = 0; j < n; j++) {
+      int iColumn = column[j];
+      int kColumn = newColumn[iColumn];
+      if (kColumn >= 0) {
+        which[n2] = kColumn;
+        elements[n2++] = element[j];
+      } else if (upper[iColumn] == lower[iColumn]) {
+        double value = element[j] * lower[iColumn];
+        if (lb > -1.0e30)
+          lb -= value;
+        if (ub < 1.0e30)
+          ub -= value;
+      } else {
+        break;
+      }
+    }
+    if (j == n && n2)
+      cuts.addCut(lb, ub, n2, which, elements);
+  }
+  delete[] newColumn;
+  delete[] which;
+  delete[] elements;
+}
+/* Pseudocosts of model moved across to integers left by preprocessing
+   (newModel gets its objects now rather than in branchAndBound) */
+static void restartPseudoCosts(CbcModel *model, CbcModel &newModel,
+  const int *originalColumns)
+{
+  int numberColumns = model->solver()->getNumCols();
+  CbcSimpleIntegerDynamicPseudoCost **oldObject = new CbcSimpleIntegerDynamicPseudoCost *[numberColumns];
+  memset(oldObject, 0, numberColumns * sizeof(CbcSimpleIntegerDynamicPseudoCost *));
+  int numberDynamic = 0;
+  for (int i = 0; i < model->numberObjects(); i++) {
+    CbcSimpleIntegerDynamicPseudoCost *obj = dynamic_cast< CbcSimpleIntegerDynamicPseudoCost * >(model->modifiableObject(i));
+    if (obj) {
+      oldObject[obj->columnNumber()] = obj;
+      numberDynamic++;
+    }
+  }
+  if (numberDynamic) {
+    newModel.findIntegers(true);
+    newModel.convertToDynamic();
+    for (int i = 0; i < newModel.numberObjects(); i++) {
+      CbcSimpleIntegerDynamicPseudoCost *obj = dynamic_cast< CbcSimpleIntegerDynamicPseudoCost * >(newModel.modifiableObject(i));
+      if (obj) {
+        int iColumn = originalColumns[obj->columnNumber()];
+        if (oldObject[iColumn])
+          obj->copySome(oldObject[iColumn]);
+      }
+    }
+  }
+  delete[] oldObject;
+}
+
 //static int saveModel=0;
 // Do mini branch and bound (return 1 if solution)
 int CbcHeuristic::smallBranchAndBound(OsiSolverInterface *solver, int numberNodes,
@@ -1207,11 +1291,14 @@ int CbcHeuristic::smallBranchAndBound(OsiSolverInterface *solver, int numberNode
 	  int specialOptions = model.specialOptions();
           // make sure can't do nested search! but allow heuristics
 	  specialOptions |= 1024;
-	  // but allow if 32768
-	  if ((specialOptions&32768)==0)
+	  // but allow if 32768 or more restarts allowed
+	  if ((specialOptions&32768)==0 && model_->maximumRestarts() <= 1)
 	    specialOptions &= ~(512 + 2048);
 	  else
 	    specialOptions &= ~(2048|32768);
+          // this is a restart - count it and allow fewer
+          model.setMaximumRestarts(CoinMax(model_->maximumRestarts() - 1, 0));
+          model.setNumberRestarts(model_->numberRestarts() + 1);
           // but say we are doing full search
           model.setSpecialOptions(specialOptions | 67108864);
           bool takeHint;
@@ -1235,6 +1322,15 @@ int CbcHeuristic::smallBranchAndBound(OsiSolverInterface *solver, int numberNode
             model.addCutGenerator(&cuts, 1, "Stored from first");
             model.cutGenerator(model.numberCutGenerators() - 1)->setGlobalCuts(true);
           }
+          // keep global cuts and pseudocosts found so far
+          CglStored globalCuts(solver2->getNumCols());
+          restartGlobalCuts(model_, solver, process.originalColumns(),
+            solver2->getNumCols(), globalCuts);
+          if (globalCuts.sizeRowCuts()) {
+            model.addCutGenerator(&globalCuts, 1, "Global cuts before restart");
+            model.cutGenerator(model.numberCutGenerators() - 1)->setGlobalCuts(true);
+          }
+          restartPseudoCosts(model_, model, process.originalColumns());
         }
         // Do search
         if (logLevel > 1)
@@ -1504,6 +1600,7 @@ int CbcHeuristic::smallBranchAndBound(OsiSolverInterface *solver, int numberNode
           if (numberNodes < 0) {
             model_->incrementIterationCount(model.getIterationCount());
             model_->incrementNodeCount(model.getNodeCount());
+            model_->setNumberRestarts(model.numberRestarts());
             // update best solution (in case ctrl-c)
             // !!! not a good idea - think a bit harder
             //model_->setMinimizationObjValue(model.getMinimizationObjValue());
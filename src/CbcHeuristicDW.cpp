@@ -20,6 +20,29 @@
 #include "CbcCutGenerator.hpp"
 #include "ClpPresolve.hpp"
 #include "CglProbing.hpp"
+#include "CoinTime.hpp"
+#include "CoinHelperFunctions.hpp"
+#ifdef CBC_THREAD
+#include <pthread.h>
+#endif
+#define CBC_DW_MAX_THREADS 64
+// Shared by threads pricing blocks
+typedef struct {
+  CbcHeuristicDW *heuristic;
+  /// Blocks in order to be done
+  const int *order;
+  int numberBlocks;
+  /// Next in order to be done
+  int next;
+  int logLevel;
+  double *solution;
+  double *objectives;
+#ifdef CBC_THREAD
+  pthread_mutex_t *mutex;
+  /// Held round each block search as CbcModel and CoinDrand48 have globals
+  pthread_mutex_t *searchMutex;
+#endif
+} CbcDWPriceInfo;
 
 static int dummyCallBack(CbcHeuristicDW * /*heuristic*/,
   CbcModel * /*thisModel*/, int /*whereFrom*/)
@@ -93,6 +116,12 @@ void CbcHeuristicDW::setDefaults()
   startColumnBlock_ = NULL;
   intsInBlock_ = NULL;
   fingerPrint_ = NULL;
+  blockSolver_ = NULL;
+  blockTime_ = NULL;
+  blockSolves_ = NULL;
+  blockProposals_ = NULL;
+  pricingTime_ = 0.0;
+  numberThreads_ = 0;
   fullDWEverySoOften_ = 0;
   numberPasses_ = 0;
   numberBadPasses_ = COIN_INT_MAX;
@@ -202,6 +231,21 @@ void CbcHeuristicDW::gutsOfCopy(const CbcHeuristicDW &rhs)
   } else {
     bestSolution_ = NULL;
   }
+  pricingTime_ = rhs.pricingTime_;
+  numberThreads_ = rhs.numberThreads_;
+  if (rhs.blockTime_) {
+    blockSolver_ = new OsiSolverInterface *[numberBlocks_];
+    for (int i = 0; i < numberBlocks_; i++)
+      blockSolver_[i] = rhs.blockSolver_[i] ? rhs.blockSolver_[i]->clone() : NULL;
+    blockTime_ = CoinCopyOfArray(rhs.blockTime_, numberBlocks_);
+    blockSolves_ = CoinCopyOfArray(rhs.blockSolves_, numberBlocks_);
+    blockProposals_ = CoinCopyOfArray(rhs.blockProposals_, numberBlocks_);
+  } else {
+    blockSolver_ = NULL;
+    blockTime_ = NULL;
+    blockSolves_ = NULL;
+    blockProposals_ = NULL;
+  }
   if (rhs.continuousSolution_) {
     int numberColumns = solver_->getNumCols();
     continuousSolution_ = CoinCopyOfArray(rhs.continuousSolution_, numberColumns);
@@ -240,6 +284,14 @@ void CbcHeuristicDW::gutsOfDelete()
   delete[] startColumnBlock_;
   delete[] intsInBlock_;
   delete[] fingerPrint_;
+  if (blockSolver_) {
+    for (int i = 0; i < numberBlocks_; i++)
+      delete blockSolver_[i];
+    delete[] blockSolver_;
+  }
+  delete[] blockTime_;
+  delete[] blockSolves_;
+  delete[] blockProposals_;
   //functionPointer_ = NULL;
   solver_ = NULL;
   dwSolver_ = NULL;
@@ -263,6 +315,10 @@ void CbcHeuristicDW::gutsOfDelete()
   startColumnBlock_ = NULL;
   intsInBlock_ = NULL;
   fingerPrint_ = NULL;
+  blockSolver_ = NULL;
+  blockTime_ = NULL;
+  blockSolves_ = NULL;
+  blockProposals_ = NULL;
   numberBlocks_ = 0;
 }
 
@@ -1288,61 +1344,7 @@ int CbcHeuristicDW::solution(double &solutionValue,
         const double *duals = solver->getRowPrice();
         double *bestSolution2 = CoinCopyOfArray(bestSolution_,
           numberColumns);
-        // Column copy
-        const double *element = solver->getMatrixByCol()->getElements();
-        const int *row = solver->getMatrixByCol()->getIndices();
-        const CoinBigIndex *columnStart = solver->getMatrixByCol()->getVectorStarts();
-        const int *columnLength = solver->getMatrixByCol()->getVectorLengths();
-        int numberUsed = 0;
-        for (int iBlock = 0; iBlock < numberBlocks_; iBlock++) {
-          int start = startColumnBlock_[iBlock];
-          int end = startColumnBlock_[iBlock + 1];
-          ClpSimplex *tempModel = new ClpSimplex(solver->getModelPtr(),
-            startRowBlock_[iBlock + 1] - startRowBlock_[iBlock],
-            rowsInBlock_ + startRowBlock_[iBlock],
-            end - start,
-            columnsInBlock_ + startColumnBlock_[iBlock]);
-          tempModel->setLogLevel(0);
-          tempModel->setDualObjectiveLimit(COIN_DBL_MAX);
-          double *objectiveX = tempModel->objective();
-          double *columnLowerX = tempModel->columnLower();
-          double *columnUpperX = tempModel->columnUpper();
-          for (int i = start; i < end; i++) {
-            int jColumn = i - start;
-            int iColumn = columnsInBlock_[i];
-            columnLowerX[jColumn] = CoinMax(saveLower_[iColumn], -1.0e12);
-            columnUpperX[jColumn] = CoinMin(saveUpper_[iColumn], 1.0e12);
-            if (solver->isInteger(iColumn))
-              tempModel->setInteger(jColumn);
-            double cost = objectiveX[jColumn];
-            for (CoinBigIndex j = columnStart[iColumn];
-                 j < columnStart[iColumn] + columnLength[iColumn]; j++) {
-              int iRow = row[j];
-              double elementValue = element[j];
-              if (backwardRow_[iRow] >= 0) {
-                cost -= elementValue * duals[iRow];
-              }
-            }
-            objectiveX[jColumn] = cost;
-          }
-          OsiClpSolverInterface solverX(tempModel, true);
-          CbcModel modelX(solverX);
-          modelX.setLogLevel(1);
-          modelX.setMoreSpecialOptions2(57);
-          // need to stop after solutions and nodes
-          //modelX.setMaximumNodes(nNodes_);
-          modelX.setMaximumSolutions(1);
-          modelX.branchAndBound();
-          const double *bestSolutionX = modelX.bestSolution();
-          if (bestSolutionX) {
-            whichBlock[numberUsed++] = iBlock;
-            for (int i = start; i < end; i++) {
-              int jColumn = i - start;
-              int iColumn = columnsInBlock_[i];
-              bestSolution2[iColumn] = bestSolutionX[jColumn];
-            }
-          }
-        }
+        int numberUsed = priceBlocks(duals, false, bestSolution2, whichBlock);
         addDW(bestSolution2, numberUsed, whichBlock);
         if (!pass_ && false) {
           // see if gives a solution
@@ -1369,62 +1371,7 @@ int CbcHeuristicDW::solution(double &solutionValue,
         dwSolver_->resolve();
         dwSolver_->setHintParam(OsiDoDualInResolve, takeHint, OsiHintDo);
         duals = dwSolver_->getRowPrice();
-        numberUsed = 0;
-        for (int iBlock = 0; iBlock < numberBlocks_; iBlock++) {
-          int start = startColumnBlock_[iBlock];
-          int end = startColumnBlock_[iBlock + 1];
-          ClpSimplex *tempModel = new ClpSimplex(solver->getModelPtr(),
-            startRowBlock_[iBlock + 1] - startRowBlock_[iBlock],
-            rowsInBlock_ + startRowBlock_[iBlock],
-            end - start,
-            columnsInBlock_ + startColumnBlock_[iBlock]);
-          tempModel->setLogLevel(0);
-          tempModel->setDualObjectiveLimit(COIN_DBL_MAX);
-          double *objectiveX = tempModel->objective();
-          double *columnLowerX = tempModel->columnLower();
-          double *columnUpperX = tempModel->columnUpper();
-          double convexityDual = duals[numberMasterRows_ + iBlock];
-          for (int i = start; i < end; i++) {
-            int jColumn = i - start;
-            int iColumn = columnsInBlock_[i];
-            columnLowerX[jColumn] = CoinMax(saveLower_[iColumn], -1.0e12);
-            columnUpperX[jColumn] = CoinMin(saveUpper_[iColumn], 1.0e12);
-            if (solver->isInteger(iColumn))
-              tempModel->setInteger(jColumn);
-            double cost = objectiveX[jColumn];
-            for (CoinBigIndex j = columnStart[iColumn];
-                 j < columnStart[iColumn] + columnLength[iColumn]; j++) {
-              int iRow = row[j];
-              double elementValue = element[j];
-              if (backwardRow_[iRow] >= 0) {
-                // duals are from dw
-                cost -= elementValue * duals[backwardRow_[iRow]];
-              }
-            }
-            objectiveX[jColumn] = cost;
-          }
-          OsiClpSolverInterface solverX(tempModel, true);
-          solverX.initialSolve();
-          double cObj = solverX.getObjValue();
-          CbcModel modelX(solverX);
-          modelX.setLogLevel(1);
-          modelX.setMoreSpecialOptions2(57);
-          modelX.setMaximumSolutions(1);
-          modelX.branchAndBound();
-          sprintf(dwPrint, "Block %d contobj %g intobj %g convdual %g",
-            iBlock, cObj, modelX.getObjValue(), convexityDual);
-          model_->messageHandler()->message(CBC_FPUMP2, model_->messages())
-            << dwPrint
-            << CoinMessageEol;
-          const double *bestSolutionX = modelX.bestSolution();
-          if (bestSolutionX) {
-            whichBlock[numberUsed++] = iBlock;
-            for (int i = start; i < end; i++) {
-              int iColumn = columnsInBlock_[i];
-              bestSolution2[iColumn] = bestSolutionX[i - start];
-            }
-          }
-        }
+        numberUsed = priceBlocks(duals, true, bestSolution2, whichBlock);
         addDW(bestSolution2, numberUsed, whichBlock);
         if (!pass_ && false) {
           // see if gives a solution
@@ -1953,6 +1900,35 @@ int CbcHeuristicDW::solution(double &solutionValue,
       }
     }
   }
+  if (blockSolves_ && pricingTime_ > 0.0) {
+    // pricing statistics
+    int numberSolves = 0;
+    int numberProposals = 0;
+    double blockTime = 0.0;
+    int slowest = 0;
+    for (int i = 0; i < numberBlocks_; i++) {
+      numberSolves += blockSolves_[i];
+      numberProposals += blockProposals_[i];
+      blockTime += blockTime_[i];
+      if (blockTime_[i] > blockTime_[slowest])
+        slowest = i;
+    }
+    sprintf(dwPrint, "DW pricing %d block solves took %.2f seconds (%.2f in blocks) - %d proposals, slowest block %d (%.2f seconds)",
+      numberSolves, pricingTime_, blockTime, numberProposals,
+      slowest, blockTime_[slowest]);
+    model_->messageHandler()->message(CBC_FPUMP1, model_->messages())
+      << dwPrint
+      << CoinMessageEol;
+    if (logLevel > 1) {
+      for (int i = 0; i < numberBlocks_; i++) {
+        sprintf(dwPrint, "Block %d priced %d times taking %.2f seconds - %d proposals",
+          i, blockSolves_[i], blockTime_[i], blockProposals_[i]);
+        model_->messageHandler()->message(CBC_FPUMP2, model_->messages())
+          << dwPrint
+          << CoinMessageEol;
+      }
+    }
+  }
   delete[] whichBlock;
   delete[] blockSort;
   delete[] whenBetter;
@@ -2626,6 +2602,7 @@ int CbcHeuristicDW::addDW(const double *solution, int numberBlocksUsed,
       rowDW[nEls++] = numberMasterRows_ + iBlock;
       weights_[nAdd + numberDW_] = thisWeightC;
       dwBlock_[nAdd + numberDW_] = iBlock;
+      blockProposals_[iBlock]++;
       newLower[nAdd] = 0.0;
       newUpper[nAdd] = 1.0;
       newCost[nAdd++] = thisCost;
@@ -2814,6 +2791,16 @@ void CbcHeuristicDW::setupDWStructures()
   weights_ = new double[numberBlocks_];
   dwBlock_ = new int[numberBlocks_];
   fingerPrint_ = new unsigned int[numberBlocks_ * sizeFingerPrint_];
+  // pricing solvers are created when first needed
+  blockSolver_ = new OsiSolverInterface *[numberBlocks_];
+  memset(blockSolver_, 0, numberBlocks_ * sizeof(OsiSolverInterface *));
+  blockTime_ = new double[numberBlocks_];
+  memset(blockTime_, 0, numberBlocks_ * sizeof(double));
+  blockSolves_ = new int[numberBlocks_];
+  memset(blockSolves_, 0, numberBlocks_ * sizeof(int));
+  blockProposals_ = new int[numberBlocks_];
+  memset(blockProposals_, 0, numberBlocks_ * sizeof(int));
+  pricingTime_ = 0.0;
   // create dwSolver
   int numberColumns = solver_->getNumCols();
   int numberRows = solver_->getNumRows();
@@ -2858,5 +2845,211 @@ void CbcHeuristicDW::setupDWStructures()
   delete[] tempRow;
 }
 
+// Prices all blocks
+int CbcHeuristicDW::priceBlocks(const double *duals, bool dwDuals,
+  double *solution, int *whichBlocks)
+{
+  char dwPrint[200];
+  double startTime = CoinGetTimeOfDay();
+  OsiClpSolverInterface *solver = dynamic_cast< OsiClpSolverInterface * >(solver_);
+  const double *objective = solver_->getObjCoefficients();
+  // Column copy
+  const double *element = solver_->getMatrixByCol()->getElements();
+  const int *row = solver_->getMatrixByCol()->getIndices();
+  const CoinBigIndex *columnStart = solver_->getMatrixByCol()->getVectorStarts();
+  const int *columnLength = solver_->getMatrixByCol()->getVectorLengths();
+  int logLevel = model_->messageHandler()->logLevel();
+  double *objectives = new double[2 * numberBlocks_];
+  int *order = new int[numberBlocks_];
+  double *sort = new double[numberBlocks_];
+  for (int iBlock = 0; iBlock < numberBlocks_; iBlock++) {
+    int start = startColumnBlock_[iBlock];
+    int end = startColumnBlock_[iBlock + 1];
+    OsiSolverInterface *solverX = blockSolver_[iBlock];
+    if (!solverX) {
+      // first time - create and keep so later passes are warm
+      ClpSimplex *tempModel = new ClpSimplex(solver->getModelPtr(),
+        startRowBlock_[iBlock + 1] - startRowBlock_[iBlock],
+        rowsInBlock_ + startRowBlock_[iBlock],
+        end - start,
+        columnsInBlock_ + startColumnBlock_[iBlock]);
+      tempModel->setLogLevel(0);
+      tempModel->setDualObjectiveLimit(COIN_DBL_MAX);
+      double *columnLowerX = tempModel->columnLower();
+      double *columnUpperX = tempModel->columnUpper();
+      for (int i = start; i < end; i++) {
+        int jColumn = i - start;
+        int iColumn = columnsInBlock_[i];
+        columnLowerX[jColumn] = CoinMax(saveLower_[iColumn], -1.0e12);
+        columnUpperX[jColumn] = CoinMin(saveUpper_[iColumn], 1.0e12);
+        if (solver_->isInteger(iColumn))
+          tempModel->setInteger(jColumn);
+      }
+      solverX = new OsiClpSolverInterface(tempModel, true);
+      blockSolver_[iBlock] = solverX;
+    }
+    // reduced costs against master duals
+    for (int i = start; i < end; i++) {
+      int iColumn = columnsInBlock_[i];
+      double cost = objective[iColumn];
+      for (CoinBigIndex j = columnStart[iColumn];
+           j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+        int iRow = row[j];
+        int jRow = backwardRow_[iRow];
+        if (jRow >= 0)
+          cost -= element[j] * duals[dwDuals ? jRow : iRow];
+      }
+      solverX->setObjCoeff(i - start, cost);
+    }
+    // slowest first so threads finish together
+    order[iBlock] = iBlock;
+    sort[iBlock] = blockSolves_[iBlock] ? -blockTime_[iBlock] / blockSolves_[iBlock] : -static_cast< double >(end - start);
+  }
+  int numberThreads = 1;
+#ifdef CBC_THREAD
+  numberThreads = numberThreads_ ? numberThreads_ : model_->getNumberThreads();
+  numberThreads = CoinMax(1, CoinMin(numberThreads, CoinMin(numberBlocks_, CBC_DW_MAX_THREADS)));
+#endif
+  CbcDWPriceInfo info;
+  info.heuristic = this;
+  info.order = order;
+  info.numberBlocks = numberBlocks_;
+  info.next = 0;
+  info.logLevel = numberThreads > 1 ? 0 : 1;
+  info.solution = solution;
+  info.objectives = objectives;
+#ifdef CBC_THREAD
+  info.mutex = NULL;
+  info.searchMutex = NULL;
+  if (numberThreads > 1) {
+    CoinSort_2(sort, sort + numberBlocks_, order);
+    pthread_mutex_t mutex;
+    pthread_mutex_init(&mutex, NULL);
+    info.mutex = &mutex;
+    pthread_mutex_t searchMutex;
+    pthread_mutex_init(&searchMutex, NULL);
+    info.searchMutex = &searchMutex;
+    pthread_t threadId[CBC_DW_MAX_THREADS];
+    int numberStarted = 0;
+    for (int i = 0; i < numberThreads; i++) {
+      if (pthread_create(&(threadId[numberStarted]), NULL, doBlocks, &info))
+        break;
+      numberStarted++;
+    }
+    // if not all threads could be started do what is left here
+    if (numberStarted < numberThreads)
+      doBlocks(&info);
+    for (int i = 0; i < numberStarted; i++)
+      pthread_join(threadId[i], NULL);
+    pthread_mutex_destroy(&mutex);
+    pthread_mutex_destroy(&searchMutex);
+  } else {
+    doBlocks(&info);
+  }
+#else
+  doBlocks(&info);
+#endif
+  // collect in block order so same answer whatever the threads
+  int numberUsed = 0;
+  for (int iBlock = 0; iBlock < numberBlocks_; iBlock++) {
+    if (dwDuals) {
+      sprintf(dwPrint, "Block %d contobj %g intobj %g convdual %g",
+        iBlock, objectives[2 * iBlock], objectives[2 * iBlock + 1],
+        duals[numberMasterRows_ + iBlock]);
+      model_->messageHandler()->message(CBC_FPUMP2, model_->messages())
+        << dwPrint
+        << CoinMessageEol;
+    }
+    if (objectives[2 * iBlock + 1] < COIN_DBL_MAX)
+      whichBlocks[numberUsed++] = iBlock;
+  }
+  delete[] objectives;
+  delete[] order;
+  delete[] sort;
+  double time = CoinGetTimeOfDay() - startTime;
+  pricingTime_ += time;
+  if (logLevel > 1) {
+    sprintf(dwPrint, "Pricing %d blocks took %.2f seconds (%d threads) - %d with solutions",
+      numberBlocks_, time, numberThreads, numberUsed);
+    model_->messageHandler()->message(CBC_FPUMP2, model_->messages())
+      << dwPrint
+      << CoinMessageEol;
+  }
+  return numberUsed;
+}
+// Solves one block pricing problem
+void CbcHeuristicDW::solveBlock(int iBlock, int logLevel, double *solution,
+  double *objectives, void *searchMutex)
+{
+  double startTime = CoinGetTimeOfDay();
+  OsiSolverInterface *solverX = blockSolver_[iBlock];
+  // only objective changed so primal feasible basis still good
+  solverX->resolve();
+  if (!solverX->isProvenOptimal())
+    solverX->initialSolve();
+  objectives[2 * iBlock] = solverX->getObjValue();
+  objectives[2 * iBlock + 1] = COIN_DBL_MAX;
+  CbcModel modelX(*solverX);
+  modelX.setLogLevel(logLevel);
+  modelX.setMoreSpecialOptions2(57);
+  // need to stop after solutions and nodes
+  //modelX.setMaximumNodes(nNodes_);
+  modelX.setMaximumSolutions(1);
+  /* CbcModel has some static data and CoinDrand48 one seed so only one
+     block search at a time.  Seeding by block gives same answer whatever
+     order blocks are done in. */
+#ifdef CBC_THREAD
+  pthread_mutex_t *mutex = reinterpret_cast< pthread_mutex_t * >(searchMutex);
+  if (mutex)
+    pthread_mutex_lock(mutex);
+#endif
+  CoinDrand48(true, 1234567 + iBlock);
+  modelX.branchAndBound();
+#ifdef CBC_THREAD
+  if (mutex)
+    pthread_mutex_unlock(mutex);
+#endif
+  const double *bestSolutionX = modelX.bestSolution();
+  if (bestSolutionX) {
+    // blocks have disjoint columns so threads can share solution
+    int start = startColumnBlock_[iBlock];
+    int end = startColumnBlock_[iBlock + 1];
+    for (int i = start; i < end; i++) {
+      int iColumn = columnsInBlock_[i];
+      solution[iColumn] = bestSolutionX[i - start];
+    }
+    objectives[2 * iBlock + 1] = modelX.getObjValue();
+  }
+  blockTime_[iBlock] += CoinGetTimeOfDay() - startTime;
+  blockSolves_[iBlock]++;
+}
+// Takes blocks until none left
+void *CbcHeuristicDW::doBlocks(void *voidInfo)
+{
+  CbcDWPriceInfo *info = reinterpret_cast< CbcDWPriceInfo * >(voidInfo);
+  while (true) {
+    int next;
+#ifdef CBC_THREAD
+    if (info->mutex)
+      pthread_mutex_lock(info->mutex);
+#endif
+    next = info->next++;
+#ifdef CBC_THREAD
+    if (info->mutex)
+      pthread_mutex_unlock(info->mutex);
+#endif
+    if (next >= info->numberBlocks)
+      break;
+#ifdef CBC_THREAD
+    void *searchMutex = info->searchMutex;
+#else
+    void *searchMutex = NULL;
+#endif
+    info->heuristic->solveBlock(info->order[next], info->logLevel,
+      info->solution, info->objectives, searchMutex);
+  }
+  return NULL;
+}
+
 /* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
 */
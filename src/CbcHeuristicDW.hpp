@@ -235,6 +235,37 @@ public:
   }
   /// Objective value (could also check validity)
   double objectiveValue(const double *solution);
+  /** Set number of threads for pricing blocks
+      0 - as model, 1 - no threads */
+  inline void setNumberThreads(int value)
+  {
+    numberThreads_ = value;
+  }
+  /// Get number of threads for pricing blocks
+  inline int numberThreads() const
+  {
+    return numberThreads_;
+  }
+  /// Seconds (wall clock) spent pricing each block
+  inline const double *blockTime() const
+  {
+    return blockTime_;
+  }
+  /// Number of times each block has been priced
+  inline const int *blockSolves() const
+  {
+    return blockSolves_;
+  }
+  /// Number of proposals each block has added to DW model
+  inline const int *blockProposals() const
+  {
+    return blockProposals_;
+  }
+  /// Seconds (wall clock) spent pricing all blocks
+  inline double pricingTime() const
+  {
+    return pricingTime_;
+  }
 
 private:
   /// Guts of copy
@@ -250,6 +281,19 @@ private:
   /// Add DW proposals
   int addDW(const double *solution, int numberBlocksUsed,
     const int *whichBlocks);
+  /** Prices all blocks against duals - of solver_ rows if dwDuals false,
+      of dwSolver_ rows if true.  Block solutions go into solution and
+      blocks with a solution into whichBlocks.  Returns number of those. */
+  int priceBlocks(const double *duals, bool dwDuals, double *solution,
+    int *whichBlocks);
+  /** Solves one block pricing problem (may be in a thread).
+      objectives gets continuous and integer objective.
+      If searchMutex (a pthread_mutex_t) is given it is held round
+      the block's branch and bound. */
+  void solveBlock(int iBlock, int logLevel, double *solution,
+    double *objectives, void *searchMutex);
+  /// Thread entry for pricing
+  static void *doBlocks(void *info);
 
 protected:
   typedef int (*heuristicCallBack)(CbcHeuristicDW *, CbcModel *, int);
@@ -365,6 +409,18 @@ protected:
   int numberBadPasses_;
   // 0 - fine, 1 can't be better, 2 max node
   int solveState_;
+  /// Solver for pricing each block (kept between passes so warm)
+  OsiSolverInterface **blockSolver_;
+  /// Seconds (wall clock) pricing each block
+  double *blockTime_;
+  /// Number of times each block priced
+  int *blockSolves_;
+  /// Number of proposals from each block
+  int *blockProposals_;
+  /// Seconds (wall clock) pricing
+  double pricingTime_;
+  /// Number of threads for pricing (0 as model)
+  int numberThreads_;
 };
 
 #endif
@@ -0,0 +1,303 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#pragma warning(disable : 4786)
+#endif
+
+#include "CbcConfig.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "CoinFinite.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "OsiCuts.hpp"
+#include "OsiRowCut.hpp"
+#include "OsiSolverInterface.hpp"
+#include "CbcLazyConstraints.hpp"
+
+CbcLazyConstraints::CbcLazyConstraints()
+  : CglCutGenerator()
+  , requiredViolation_(1.0e-6)
+  , numberRowsChecked_(0.0)
+  , numberColumns_(0)
+  , maximumCutsPerCall_(1000)
+  , haveSolution_(false)
+{
+  rowStart_.push_back(0);
+}
+
+CbcLazyConstraints::CbcLazyConstraints(const CbcLazyConstraints &rhs)
+  : CglCutGenerator(rhs)
+  , rowStart_(rhs.rowStart_)
+  , column_(rhs.column_)
+  , element_(rhs.element_)
+  , lower_(rhs.lower_)
+  , upper_(rhs.upper_)
+  , columnStart_(rhs.columnStart_)
+  , columnRow_(rhs.columnRow_)
+  , lastSolution_(rhs.lastSolution_)
+  , lastViolated_(rhs.lastViolated_)
+  , requiredViolation_(rhs.requiredViolation_)
+  , numberRowsChecked_(rhs.numberRowsChecked_)
+  , numberColumns_(rhs.numberColumns_)
+  , maximumCutsPerCall_(rhs.maximumCutsPerCall_)
+  , haveSolution_(rhs.haveSolution_)
+{
+}
+
+CbcLazyConstraints &
+CbcLazyConstraints::operator=(const CbcLazyConstraints &rhs)
+{
+  if (this != &rhs) {
+    CglCutGenerator::operator=(rhs);
+    rowStart_ = rhs.rowStart_;
+    column_ = rhs.column_;
+    element_ = rhs.element_;
+    lower_ = rhs.lower_;
+    upper_ = rhs.upper_;
+    columnStart_ = rhs.columnStart_;
+    columnRow_ = rhs.columnRow_;
+    lastSolution_ = rhs.lastSolution_;
+    lastViolated_ = rhs.lastViolated_;
+    requiredViolation_ = rhs.requiredViolation_;
+    numberRowsChecked_ = rhs.numberRowsChecked_;
+    numberColumns_ = rhs.numberColumns_;
+    maximumCutsPerCall_ = rhs.maximumCutsPerCall_;
+    haveSolution_ = rhs.haveSolution_;
+  }
+  return *this;
+}
+
+CglCutGenerator *
+CbcLazyConstraints::clone() const
+{
+  return new CbcLazyConstraints(*this);
+}
+
+CbcLazyConstraints::~CbcLazyConstraints()
+{
+}
+
+void CbcLazyConstraints::addRow(int numberElements, const int *columns,
+  const double *elements, double lower, double upper)
+{
+  for (int i = 0; i < numberElements; i++) {
+    column_.push_back(columns[i]);
+    element_.push_back(elements[i]);
+    numberColumns_ = CoinMax(numberColumns_, columns[i] + 1);
+  }
+  rowStart_.push_back(static_cast< int >(column_.size()));
+  lower_.push_back(lower);
+  upper_.push_back(upper);
+  // index must be rebuilt
+  columnStart_.clear();
+  haveSolution_ = false;
+}
+
+// Activity of row - four partial sums so loop can be vectorized
+double
+CbcLazyConstraints::activity(int iRow, const double *solution) const
+{
+  int j = rowStart_[iRow];
+  int end = rowStart_[iRow + 1];
+  if (j == end)
+    return 0.0;
+  const int *column = &column_[0];
+  const double *element = &element_[0];
+  double sum0 = 0.0;
+  double sum1 = 0.0;
+  double sum2 = 0.0;
+  double sum3 = 0.0;
+  for (; j + 3 < end; j += 4) {
+    sum0 += element[j] * solution[column[j]];
+    sum1 += element[j + 1] * solution[column[j + 1]];
+    sum2 += element[j + 2] * solution[column[j + 2]];
+    sum3 += element[j + 3] * solution[column[j + 3]];
+  }
+  for (; j < end; j++)
+    sum0 += element[j] * solution[column[j]];
+  return (sum0 + sum1) + (sum2 + sum3);
+}
+
+// Adds row as globally valid cut
+void CbcLazyConstraints::addCut(int iRow, OsiCuts &cuts) const
+{
+  int start = rowStart_[iRow];
+  int n = rowStart_[iRow + 1] - start;
+  OsiRowCut rc;
+  if (n)
+    rc.setRow(n, &column_[start], &element_[start], false);
+  rc.setLb(lower_[iRow]);
+  rc.setUb(upper_[iRow]);
+  rc.setGloballyValid(true);
+  cuts.insert(rc);
+}
+
+void CbcLazyConstraints::createIndex()
+{
+  int numberRows = this->numberRows();
+  columnStart_.assign(numberColumns_ + 1, 0);
+  columnRow_.resize(column_.size());
+  for (size_t j = 0; j < column_.size(); j++)
+    columnStart_[column_[j] + 1]++;
+  for (int i = 0; i < numberColumns_; i++)
+    columnStart_[i + 1] += columnStart_[i];
+  std::vector< int > put(columnStart_.begin(), columnStart_.end() - 1);
+  for (int iRow = 0; iRow < numberRows; iRow++) {
+    for (int j = rowStart_[iRow]; j < rowStart_[iRow + 1]; j++)
+      columnRow_[put[column_[j]]++] = iRow;
+  }
+  lastSolution_.resize(numberColumns_);
+  lastViolated_.clear();
+  haveSolution_ = false;
+}
+
+void CbcLazyConstraints::generateCuts(const OsiSolverInterface &si,
+  OsiCuts &cs, const CglTreeInfo)
+{
+  int numberRows = this->numberRows();
+  if (!numberRows || si.getNumCols() < numberColumns_)
+    return;
+  if (columnStart_.empty())
+    createIndex();
+  const double *solution = si.getColSolution();
+  // rows to look at (all if checkAll)
+  std::vector< int > check;
+  bool checkAll = !haveSolution_;
+  if (!checkAll) {
+    int numberChanged = 0;
+    for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+      if (solution[iColumn] != lastSolution_[iColumn])
+        numberChanged++;
+    }
+    if (4 * numberChanged > numberColumns_) {
+      checkAll = true;
+    } else {
+      check = lastViolated_;
+      for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+        if (solution[iColumn] != lastSolution_[iColumn]) {
+          for (int j = columnStart_[iColumn]; j < columnStart_[iColumn + 1]; j++)
+            check.push_back(columnRow_[j]);
+        }
+      }
+      std::sort(check.begin(), check.end());
+      check.erase(std::unique(check.begin(), check.end()), check.end());
+      if (2 * static_cast< int >(check.size()) > numberRows)
+        checkAll = true;
+    }
+  }
+  std::vector< std::pair< double, int > > violations;
+  int numberCheck = checkAll ? numberRows : static_cast< int >(check.size());
+  for (int k = 0; k < numberCheck; k++) {
+    int iRow = checkAll ? k : check[k];
+    double value = activity(iRow, solution);
+    double infeasibility = CoinMax(value - upper_[iRow], lower_[iRow] - value);
+    if (infeasibility > requiredViolation_)
+      violations.push_back(std::make_pair(-infeasibility, iRow));
+  }
+  numberRowsChecked_ += numberCheck;
+  if (numberColumns_)
+    CoinCopyN(solution, numberColumns_, &lastSolution_[0]);
+  haveSolution_ = true;
+  // all violated are looked at again next time
+  int numberViolated = static_cast< int >(violations.size());
+  lastViolated_.resize(numberViolated);
+  for (int k = 0; k < numberViolated; k++)
+    lastViolated_[k] = violations[k].second;
+  // most violated first
+  int numberAdd = numberViolated;
+  if (maximumCutsPerCall_ > 0 && numberAdd > maximumCutsPerCall_) {
+    numberAdd = maximumCutsPerCall_;
+    std::nth_element(violations.begin(), violations.begin() + numberAdd,
+      violations.end());
+  }
+  for (int k = 0; k < numberAdd; k++) {
+    int iRow = violations[k].second;
+    addCut(iRow, cs);
+  }
+}
+
+int CbcLazyConstraints::violated(const double *solution, OsiCuts *cuts) const
+{
+  int numberRows = this->numberRows();
+  int numberViolated = 0;
+  for (int iRow = 0; iRow < numberRows; iRow++) {
+    double value = activity(iRow, solution);
+    if (CoinMax(value - upper_[iRow], lower_[iRow] - value) > requiredViolation_) {
+      numberViolated++;
+      if (cuts)
+        addCut(iRow, *cuts);
+    }
+  }
+  return numberViolated;
+}
+
+void CbcLazyConstraints::markColumns(char *marked, int numberColumns) const
+{
+  for (size_t j = 0; j < column_.size(); j++) {
+    if (column_[j] < numberColumns)
+      marked[column_[j]] = 1;
+  }
+}
+
+int CbcLazyConstraints::mapColumns(const int *originalColumns,
+  int numberColumns, const double *fixedValue)
+{
+  std::vector< int > newColumn(numberColumns_, -1);
+  for (int i = 0; i < numberColumns; i++) {
+    int iColumn = originalColumns[i];
+    if (iColumn < numberColumns_)
+      newColumn[iColumn] = i;
+  }
+  int numberRows = this->numberRows();
+  // first see if all rows can be mapped
+  int numberBad = 0;
+  for (int iRow = 0; iRow < numberRows; iRow++) {
+    for (int j = rowStart_[iRow]; j < rowStart_[iRow + 1]; j++) {
+      int iColumn = column_[j];
+      if (newColumn[iColumn] < 0 && (!fixedValue || fixedValue[iColumn] == COIN_DBL_MAX)) {
+        numberBad++;
+        break;
+      }
+    }
+  }
+  if (numberBad)
+    return numberBad;
+  int put = 0;
+  numberColumns_ = 0;
+  // compacted in place so keep start of next row
+  int end = rowStart_[0];
+  for (int iRow = 0; iRow < numberRows; iRow++) {
+    int start = end;
+    end = rowStart_[iRow + 1];
+    // removed columns are fixed so move to bounds
+    double fixedActivity = 0.0;
+    for (int j = start; j < end; j++) {
+      int iColumn = newColumn[column_[j]];
+      if (iColumn >= 0) {
+        column_[put] = iColumn;
+        element_[put++] = element_[j];
+        numberColumns_ = CoinMax(numberColumns_, iColumn + 1);
+      } else {
+        fixedActivity += element_[j] * fixedValue[column_[j]];
+      }
+    }
+    if (lower_[iRow] > -COIN_DBL_MAX)
+      lower_[iRow] -= fixedActivity;
+    if (upper_[iRow] < COIN_DBL_MAX)
+      upper_[iRow] -= fixedActivity;
+    rowStart_[iRow + 1] = put;
+  }
+  column_.resize(put);
+  element_.resize(put);
+  columnStart_.clear();
+  haveSolution_ = false;
+  return 0;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,161 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+/*! \file CbcLazyConstraints.hpp
+    \brief Store of lazy constraints separated by checking rows.
+*/
+
+#ifndef CbcLazyConstraints_H
+#define CbcLazyConstraints_H
+
+#include <vector>
+
+#include "CglCutGenerator.hpp"
+#include "CbcConfig.h"
+
+class OsiCuts;
+
+/** Lazy constraints.
+
+    Rows which are part of the model but are only added to the LP when
+    violated.  They are kept by row and also indexed by column.  On each
+    call only rows with an element in a column whose value has changed
+    since the last call (and rows violated last time) are checked, so when
+    a few variables move the cost is proportional to the elements in those
+    columns rather than to all the rows.  If many columns change, or on the
+    first call, all rows are checked.
+
+    Activities are computed with several partial sums which compilers can
+    turn into vector instructions and which are not sequentially dependent.
+
+    Before preprocessing the columns used can be marked as prohibited so
+    that preprocessing keeps them (unless fixed), and afterwards the rows
+    can be mapped to the preprocessed columns.  So preprocessing and heuristics can stay
+    on (solutions from heuristics are checked as the generator is called at
+    every solution).
+*/
+
+class CBCLIB_EXPORT CbcLazyConstraints : public CglCutGenerator {
+public:
+  /// Default Constructor
+  CbcLazyConstraints();
+
+  /// Copy constructor
+  CbcLazyConstraints(const CbcLazyConstraints &rhs);
+
+  /// Assignment
+  CbcLazyConstraints &operator=(const CbcLazyConstraints &rhs);
+
+  /// Clone
+  virtual CglCutGenerator *clone() const;
+
+  /// Destructor
+  virtual ~CbcLazyConstraints();
+
+  /** Adds violated rows as globally valid cuts (most violated first and
+      at most maximumCutsPerCall).  Only changed part is looked at. */
+  virtual void generateCuts(const OsiSolverInterface &si, OsiCuts &cs,
+    const CglTreeInfo info = CglTreeInfo());
+
+  /// Rows refer to model columns so preprocessing is fine (after mapColumns)
+  virtual bool needsOriginalModel() const
+  {
+    return false;
+  }
+
+  /// Add a row - lower and upper may be infinite
+  void addRow(int numberElements, const int *columns, const double *elements,
+    double lower, double upper);
+
+  /** Checks all rows against solution.  Returns number violated and adds
+      them to cuts if given.  State used by generateCuts is not changed. */
+  int violated(const double *solution, OsiCuts *cuts) const;
+
+  /// Sets marked[i] to 1 for every column i (< numberColumns) in a row
+  void markColumns(char *marked, int numberColumns) const;
+
+  /** Maps rows to preprocessed columns.  originalColumns[i] is original
+      index of new column i.  A column which was removed must have been
+      fixed - fixedValue[i] is value of original column i (COIN_DBL_MAX if
+      not known) and is moved into row bounds.  If any row uses a removed
+      column whose value is not known nothing is changed and the number
+      of such rows is returned (so preprocessed model can not be used),
+      otherwise 0.
+  */
+  int mapColumns(const int *originalColumns, int numberColumns,
+    const double *fixedValue);
+
+  /// Number of rows
+  inline int numberRows() const
+  {
+    return static_cast< int >(lower_.size());
+  }
+  /// Set violation needed to add a row (default 1.0e-6)
+  inline void setRequiredViolation(double value)
+  {
+    requiredViolation_ = value;
+  }
+  /// Violation needed to add a row
+  inline double requiredViolation() const
+  {
+    return requiredViolation_;
+  }
+  /// Set maximum rows added in one call (default 1000)
+  inline void setMaximumCutsPerCall(int value)
+  {
+    maximumCutsPerCall_ = value;
+  }
+  /// Maximum rows added in one call
+  inline int maximumCutsPerCall() const
+  {
+    return maximumCutsPerCall_;
+  }
+  /// Number of rows checked (for statistics)
+  inline double numberRowsChecked() const
+  {
+    return numberRowsChecked_;
+  }
+
+private:
+  /// Activity of row
+  double activity(int iRow, const double *solution) const;
+  /// Add row as globally valid cut
+  void addCut(int iRow, OsiCuts &cuts) const;
+  /// Build column index (and save area for solution)
+  void createIndex();
+
+  /// Start of each row (numberRows+1)
+  std::vector< int > rowStart_;
+  /// Columns
+  std::vector< int > column_;
+  /// Elements
+  std::vector< double > element_;
+  /// Row lower bounds
+  std::vector< double > lower_;
+  /// Row upper bounds
+  std::vector< double > upper_;
+  /// Start of each column in index (empty if not built)
+  std::vector< int > columnStart_;
+  /// Rows in each column
+  std::vector< int > columnRow_;
+  /// Solution at last call
+  std::vector< double > lastSolution_;
+  /// Rows violated at last call
+  std::vector< int > lastViolated_;
+  /// Violation needed
+  double requiredViolation_;
+  /// Rows checked
+  double numberRowsChecked_;
+  /// Number of columns (one more than largest used)
+  int numberColumns_;
+  /// Maximum rows added in one call
+  int maximumCutsPerCall_;
+  /// Whether lastSolution_ is valid
+  bool haveSolution_;
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -5,6 +5,9 @@
 #include "CbcConfig.h"
 
 #include "CoinTime.hpp"
+#ifdef CBC_THREAD
+#include <pthread.h>
+#endif
 
 #include "CoinHelperFunctions.hpp"
 #include "CoinModel.hpp"
@@ -134,12 +137,13 @@ void OsiSolverLink::initialSolve()
   specialOptions_ = 0;
   modelPtr_->setWhatsChanged(0);
   if (numberVariables_) {
-    CoinPackedMatrix *temp = new CoinPackedMatrix(*matrix_);
     // update all bounds before coefficients
     for (int i = 0; i < numberVariables_; i++) {
       info_[i].updateBounds(modelPtr_);
     }
-    int updated = updateCoefficients(modelPtr_, temp);
+    clearLinearization();
+    updateLinearization();
+    CoinPackedMatrix *temp = new CoinPackedMatrix(*matrix_);
     //if (updated || 1) {
       temp->removeGaps(1.0e-14);
       ClpMatrixBase *save = modelPtr_->clpMatrix();
@@ -156,6 +160,7 @@ void OsiSolverLink::initialSolve()
         temp->bottomAppendPackedMatrix(*clpMatrix->matrix());
       }
       modelPtr_->replaceMatrix(temp, true);
+      clpGeneration_ = linearGeneration_;
     //} else {
     //  delete temp;
     //}
@@ -295,7 +300,6 @@ void OsiSolverLink::resolve()
   bool allFixed = numberFix_ > 0;
   bool feasible = true;
   if (numberVariables_) {
-    CoinPackedMatrix *temp = new CoinPackedMatrix(*matrix_);
     //bool best=true;
     const double *lower = modelPtr_->columnLower();
     const double *upper = modelPtr_->columnUpper();
@@ -308,8 +312,10 @@ void OsiSolverLink::resolve()
       if (up < lo)
         feasible = false;
     }
-    int updated = updateCoefficients(modelPtr_, temp);
+    // only bilinear objects whose bounds have changed
+    int updated = updateLinearization();
     if (updated) {
+      CoinPackedMatrix *temp = new CoinPackedMatrix(*matrix_);
       temp->removeGaps(1.0e-14);
       ClpMatrixBase *save = modelPtr_->clpMatrix();
       ClpPackedMatrix *clpMatrix = dynamic_cast< ClpPackedMatrix * >(save);
@@ -331,8 +337,7 @@ void OsiSolverLink::resolve()
       modelPtr_->replaceMatrix(temp, true);
       modelPtr_->setNewRowCopy(NULL);
       modelPtr_->setClpScaledMatrix(NULL);
-    } else {
-      delete temp;
+      clpGeneration_ = linearGeneration_;
     }
   }
 #ifdef WRITE_MATRIX
@@ -1406,6 +1411,7 @@ void OsiSolverLink::load(CoinModel &coinModelOriginal, bool tightenBounds, int l
       delete[] objects;
       // Now do dummy bound stuff
       matrix_ = new CoinPackedMatrix(*getMatrixByCol());
+      clearLinearization();
       info_ = new OsiLinkedBound[numberVariables_];
       for (i = 0; i < numberVariables_; i++) {
         info_[i] = OsiLinkedBound(this, which[i], 0, NULL, NULL, NULL);
@@ -1734,6 +1740,8 @@ void OsiSolverLink::addTighterConstraints()
   delete[] mark;
   delete[] list;
   delete[] objW;
+  // rows added to matrix_
+  clearLinearization();
 }
 // Set all biLinear priorities on x-x variables
 void OsiSolverLink::setBiLinearPriorities(int value, double meshSize)
@@ -3120,6 +3128,8 @@ void OsiSolverLink::gutsOfDestructor(bool justNullify)
     delete[] convex_;
     delete[] whichNonLinear_;
     delete[] fixVariables_;
+    delete[] linearColumns_;
+    delete[] linearBounds_;
   }
   matrix_ = NULL;
   originalRowCopy_ = NULL;
@@ -3142,6 +3152,11 @@ void OsiSolverLink::gutsOfDestructor(bool justNullify)
   integerPriority_ = 1000;
   biLinearPriority_ = 10000;
   numberFix_ = 0;
+  numberLinear_ = 0;
+  linearColumns_ = NULL;
+  linearBounds_ = NULL;
+  linearGeneration_ = 1;
+  clpGeneration_ = 0;
 }
 void OsiSolverLink::gutsOfCopy(const OsiSolverLink &rhs)
 {
@@ -3189,6 +3204,12 @@ void OsiSolverLink::gutsOfCopy(const OsiSolverLink &rhs)
     quadraticModel_ = NULL;
   }
   fixVariables_ = CoinCopyOfArray(rhs.fixVariables_, numberFix_);
+  // cache goes with matrix_ (clp matrix is a copy so remade on first resolve)
+  numberLinear_ = rhs.numberLinear_;
+  linearColumns_ = CoinCopyOfArray(rhs.linearColumns_, 3 * numberLinear_);
+  linearBounds_ = CoinCopyOfArray(rhs.linearBounds_, 4 * numberLinear_);
+  linearGeneration_ = rhs.linearGeneration_ + 1;
+  clpGeneration_ = rhs.clpGeneration_;
 }
 // Add a bound modifier
 void OsiSolverLink::addBoundModifier(bool upperBoundAffected, bool useUpperBound, int whichVariable, int whichVariableAffected,
@@ -3213,6 +3234,13 @@ void OsiSolverLink::addBoundModifier(bool upperBoundAffected, bool useUpperBound
   }
   info_[i].addBoundModifier(upperBoundAffected, useUpperBound, whichVariableAffected, multiplier);
 }
+int OsiSolverLink::numberLinearChecks_ = 0;
+int OsiSolverLink::numberLinearHits_ = 0;
+double OsiSolverLink::linearSeconds_ = 0.0;
+#ifdef CBC_THREAD
+// statistics are shared by solvers in all threads
+static pthread_mutex_t linearMutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
 // Update coefficients
 int OsiSolverLink::updateCoefficients(ClpSimplex *solver, CoinPackedMatrix *matrix)
 {
@@ -3228,6 +3256,88 @@ int OsiSolverLink::updateCoefficients(ClpSimplex *solver, CoinPackedMatrix *matr
   }
   return numberChanged;
 }
+/* Update coefficients in matrix_ using cache.
+   matrix_ keeps whatever was last put in so an object whose bounds are
+   the same as last time (e.g. at nodes where other variables were
+   branched on) needs nothing done and if only one bound has moved only
+   the two corners using it are redone.  Basis is still looked at. */
+int OsiSolverLink::updateLinearization()
+{
+  double time1 = CoinCpuTime();
+  const double *lower = modelPtr_->columnLower();
+  const double *upper = modelPtr_->columnUpper();
+  double *objective = modelPtr_->objective();
+  if (numberLinear_ != numberObjects_) {
+    delete[] linearColumns_;
+    delete[] linearBounds_;
+    numberLinear_ = numberObjects_;
+    linearColumns_ = new int[3 * numberLinear_];
+    linearBounds_ = new double[4 * numberLinear_];
+    for (int iObject = 0; iObject < numberLinear_; iObject++)
+      linearColumns_[3 * iObject] = -1;
+  }
+  // if clp matrix not made from matrix_ (e.g. copy) redo all so it is remade
+  bool sameMatrix = clpGeneration_ == linearGeneration_;
+  int numberChanged = 0;
+  int numberChecks = 0;
+  int numberHits = 0;
+  for (int iObject = 0; iObject < numberObjects_; iObject++) {
+    OsiBiLinear *obj = dynamic_cast< OsiBiLinear * >(object_[iObject]);
+    if (!obj || (obj->branchingStrategy() & 4) != 0)
+      continue;
+    int xColumn = obj->xColumn();
+    int yColumn = obj->yColumn();
+    int *columns = linearColumns_ + 3 * iObject;
+    double *bounds = linearBounds_ + 4 * iObject;
+    bool known = sameMatrix && columns[0] == xColumn && columns[1] == yColumn && columns[2] == obj->firstLambda();
+    int n = obj->updateCoefficients(lower, upper, objective, matrix_, &basis_,
+      known ? bounds : NULL);
+    numberChecks++;
+    if (!n)
+      numberHits++;
+    numberChanged += n;
+    columns[0] = xColumn;
+    columns[1] = yColumn;
+    columns[2] = obj->firstLambda();
+    bounds[0] = lower[xColumn];
+    bounds[1] = upper[xColumn];
+    bounds[2] = lower[yColumn];
+    bounds[3] = upper[yColumn];
+  }
+#ifdef CBC_THREAD
+  pthread_mutex_lock(&linearMutex);
+#endif
+  numberLinearChecks_ += numberChecks;
+  numberLinearHits_ += numberHits;
+  linearSeconds_ += CoinCpuTime() - time1;
+#ifdef CBC_THREAD
+  pthread_mutex_unlock(&linearMutex);
+#endif
+  return numberChanged;
+}
+// Forget bounds last used
+void OsiSolverLink::clearLinearization()
+{
+  delete[] linearColumns_;
+  delete[] linearBounds_;
+  numberLinear_ = 0;
+  linearColumns_ = NULL;
+  linearBounds_ = NULL;
+  linearGeneration_++;
+}
+// Zero linearization statistics
+void OsiSolverLink::zeroLinearizationStatistics()
+{
+#ifdef CBC_THREAD
+  pthread_mutex_lock(&linearMutex);
+#endif
+  numberLinearChecks_ = 0;
+  numberLinearHits_ = 0;
+  linearSeconds_ = 0.0;
+#ifdef CBC_THREAD
+  pthread_mutex_unlock(&linearMutex);
+#endif
+}
 // Set best solution found internally
 void OsiSolverLink::setBestSolution(const double *solution, int numberColumns)
 {
@@ -6396,7 +6506,8 @@ OsiBiLinear::computeLambdas(const double xB[3], const double yB[3], const double
 }
 // Updates coefficients
 int OsiBiLinear::updateCoefficients(const double *lower, const double *upper, double *objective,
-  CoinPackedMatrix *matrix, CoinWarmStartBasis *basis) const
+  CoinPackedMatrix *matrix, CoinWarmStartBasis *basis,
+  const double *lastBounds) const
 {
   // Return if no updates
   if ((branchingStrategy_ & 4) != 0)
@@ -6425,6 +6536,9 @@ int OsiBiLinear::updateCoefficients(const double *lower, const double *upper, do
     double x = xB[iX];
     int iY = j & 1;
     double y = yB[iY];
+    // corner same as last time
+    if (lastBounds && x == lastBounds[iX] && y == lastBounds[2 + iY])
+      continue;
     CoinBigIndex k = columnStart[j + firstLambda_];
     CoinBigIndex last = k + columnLength[j + firstLambda_];
     double value;
@@ -112,6 +112,28 @@ public:
     double multiplier = 1.0);
   /// Update coefficients - returns number updated if in updating mode
   int updateCoefficients(ClpSimplex *solver, CoinPackedMatrix *matrix);
+  /** Update coefficients in clean copy of matrix using cache of bounds
+      last used for each bilinear object - returns number updated */
+  int updateLinearization();
+  /// Forget bounds last used (e.g. if matrix changed)
+  void clearLinearization();
+  /// Zero linearization statistics (for all link solvers)
+  static void zeroLinearizationStatistics();
+  /// Bilinear objects looked at when updating coefficients (all link solvers)
+  static inline int numberLinearizationChecks()
+  {
+    return numberLinearChecks_;
+  }
+  /// Bilinear objects with bounds unchanged (all link solvers)
+  static inline int numberLinearizationHits()
+  {
+    return numberLinearHits_;
+  }
+  /// Seconds updating coefficients (all link solvers)
+  static inline double linearizationSeconds()
+  {
+    return linearSeconds_;
+  }
   /// Analyze constraints to see which are convex (quadratic)
   void analyzeObjects();
   /// Add reformulated bilinear constraints
@@ -305,6 +327,22 @@ protected:
   int numberFix_;
   /// list of fixed variables
   int *fixVariables_;
+  /** Linearization cache.
+      For each object x, y and first lambda columns (x -1 if not known)
+      and bounds (xL,xU,yL,yU) whose coefficients are in matrix_
+  */
+  int numberLinear_;
+  int *linearColumns_;
+  double *linearBounds_;
+  /// Generation of matrix_ and cache (changes when either is rebuilt or copied)
+  int linearGeneration_;
+  /// linearGeneration_ when clp matrix was last made from matrix_
+  int clpGeneration_;
+  /** Statistics for all link solvers (clones update the same counts,
+      under a mutex if threads) */
+  static int numberLinearChecks_;
+  static int numberLinearHits_;
+  static double linearSeconds_;
   //@}
 };
 /**
@@ -944,9 +982,12 @@ public:
   }
   /// Does work of branching
   void newBounds(OsiSolverInterface *solver, int way, short xOrY, double separator) const;
-  /// Updates coefficients - returns number updated
+  /** Updates coefficients - returns number updated.
+      If lastBounds (xL,xU,yL,yU) given then corners with same bounds
+      are assumed to be in matrix already */
   int updateCoefficients(const double *lower, const double *upper, double *objective,
-    CoinPackedMatrix *matrix, CoinWarmStartBasis *basis) const;
+    CoinPackedMatrix *matrix, CoinWarmStartBasis *basis,
+    const double *lastBounds = NULL) const;
   /// Returns true value of single xyRow coefficient
   double xyCoefficient(const double *solution) const;
   /// Get LU coefficients from matrix
@@ -68,6 +68,18 @@ static Cbc_message us_english[] = {
   { CBC_FATHOM_CHANGE, 49, 1, "Complete fathoming at depth >= %d" },
 #endif
   { CBC_MAXITERS, 50, 1, "Exiting on maximum number of iterations" },
+  { CBC_RESTART_FIXED, 51, 1, "Restart %d after %d nodes - %d of %d integers fixed (%d on reduced cost, %d globally in tree)" },
+  { CBC_RESTART_END, 52, 1, "Restart %d took %.2f seconds" },
+  { CBC_RESTART_TOOBIG, 53, 1, "Restart %d abandoned as presolved problem not small enough (%.2f seconds)" },
+  { CBC_CUT_SELECTION, 54, 2, "Cut selection took %d of %d cuts - %d parallel, %d weak, %d over limit" },
+  { CBC_CUT_SCHEDULE, 55, 1, "Cut generator %d (%s) automatic - frequency %d depth %d, bound gain %g at root %g in tree (%.2f seconds), %d changes - %s" },
+  { CBC_HOTSTART_STATS, 56, 1, "Strong branching kept hot start after %d fixings (factorizations saved), %d solves from kept hot start" },
+  { CBC_LOOKAHEAD_STATS, 57, 1, "Strong branching with lookahead %d stopped %d times on lookahead and %d on bound, leaving %d candidates" },
+  { CBC_NODE_CACHE, 58, 1, "Node cache found %d nodes (%d pruned, %d warm started), %d not found" },
+  { CBC_GLOBAL_FIXING, 59, 1, "Global reduced cost fixing from %d LPs tightened %d bounds (%d fixed), changing %d nodes and pruning %d" },
+  { CBC_FAST_NODES, 60, 1, "%d nodes solved in Clp subtrees and %d through CbcNode - %d subtree nodes passed back, %d subtrees dropped as solution not feasible for SOS etc" },
+  { CBC_SAFE_CHECK, 61, 1, "Solution checked in safe arithmetic - %s, maximum violation %g (integers moved %g), objective in [%.12g, %.12g]" },
+  { CBC_SAFE_BOUND, 62, 1, "Safe bound from root LP duals %.12g for solutions better than cutoff %.12g (search bound %.12g), checks took %.3f seconds" },
   { CBC_NOINT, 3007, 1, "No integer variables" },
   { CBC_WARNING_STRONG, 3008, 1, "Strong branching is fixing too many variables, too expensively!" },
   { CBC_GENERAL_WARNING, 3009, 1, "%s" },
@@ -71,6 +71,18 @@ enum CBC_Message {
   CBC_RELAXED1,
   CBC_RELAXED2,
   CBC_RESTART,
+  CBC_RESTART_FIXED,
+  CBC_RESTART_END,
+  CBC_RESTART_TOOBIG,
+  CBC_CUT_SELECTION,
+  CBC_CUT_SCHEDULE,
+  CBC_HOTSTART_STATS,
+  CBC_LOOKAHEAD_STATS,
+  CBC_NODE_CACHE,
+  CBC_GLOBAL_FIXING,
+  CBC_FAST_NODES,
+  CBC_SAFE_CHECK,
+  CBC_SAFE_BOUND,
   CBC_GENERAL,
   CBC_GENERAL_WARNING,
   CBC_ROOT_DETAIL,
@@ -15,6 +15,10 @@
 #include "CbcMipStartIO.hpp"
 #include "CbcSOS.hpp"
 #include "CoinTime.hpp"
+#include "CoinTypes.h"
+#ifdef CBC_HAS_CLP
+#include "OsiClpSolverInterface.hpp"
+#endif
 
 using namespace std;
 
@@ -29,162 +33,407 @@ bool isNumericStr(const char *str)
   return true;
 }
 
+/* Open addressing hash of column names.  Names are referenced, not
+   copied, when the solver keeps them (Clp) - otherwise generated once.
+   Table is only built on first lookup. */
+class CbcMipStartNameHash {
+public:
+  CbcMipStartNameHash(const OsiSolverInterface *solver)
+    : mask_(0)
+  {
+    const int numberColumns = solver->getNumCols();
+    names_.resize(numberColumns);
+#ifdef CBC_HAS_CLP
+    const OsiClpSolverInterface *clpSolver = dynamic_cast< const OsiClpSolverInterface * >(solver);
+    const std::vector< std::string > *clpNames = clpSolver ? clpSolver->getModelPtr()->columnNames() : NULL;
+    if (clpSolver && clpSolver->getModelPtr()->lengthNames() && clpNames && static_cast< int >(clpNames->size()) == numberColumns) {
+      for (int i = 0; i < numberColumns; i++)
+        names_[i] = (*clpNames)[i].c_str();
+      return;
+    }
+#endif
+    generated_.resize(numberColumns);
+    for (int i = 0; i < numberColumns; i++) {
+      generated_[i] = solver->getColName(i);
+      names_[i] = generated_[i].c_str();
+    }
+  }
+  CbcMipStartNameHash(const std::vector< std::string > &colNames)
+    : mask_(0)
+  {
+    names_.resize(colNames.size());
+    for (size_t i = 0; i < colNames.size(); i++)
+      names_[i] = colNames[i].c_str();
+  }
+  /// Column name
+  inline const char *name(int iColumn) const
+  {
+    return names_[iColumn];
+  }
+  /// Column with name or -1
+  int find(const char *name)
+  {
+    if (!mask_)
+      build();
+    size_t length = strlen(name);
+    size_t k = hashValue(name, length) & mask_;
+    while (table_[k] >= 0) {
+      if (!strcmp(names_[table_[k]], name))
+        return table_[k];
+      k = (k + 1) & mask_;
+    }
+    return -1;
+  }
+
+private:
+  static size_t hashValue(const char *name, size_t length)
+  {
+    // FNV-1a
+    CoinUInt64 value = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; i++) {
+      value ^= static_cast< unsigned char >(name[i]);
+      value *= 1099511628211ULL;
+    }
+    return static_cast< size_t >(value ^ (value >> 32));
+  }
+  void build()
+  {
+    size_t size = 16;
+    while (size < 2 * names_.size())
+      size *= 2;
+    mask_ = size - 1;
+    table_.assign(size, -1);
+    // last of any duplicate names wins (as with std::map before)
+    for (int i = 0; i < static_cast< int >(names_.size()); i++) {
+      size_t k = hashValue(names_[i], strlen(names_[i])) & mask_;
+      while (table_[k] >= 0 && strcmp(names_[table_[k]], names_[i]))
+        k = (k + 1) & mask_;
+      table_[k] = i;
+    }
+  }
+  std::vector< std::string > generated_;
+  std::vector< const char * > names_;
+  std::vector< int > table_;
+  size_t mask_;
+};
+
+// Compact binary mipstart - see CbcMipStartIO::writeBinary
+static const char mipStartMagic[8] = { 'C', 'B', 'C', 'M', 'S', 'T', 'B', '1' };
+
+/* Next blank (or separator) delimited token in line - returns NULL at end.
+   Token is terminated in place. */
+static char *nextToken(char *&line, char separator)
+{
+  while (*line == ' ' || *line == '\t')
+    line++;
+  if (*line == '\0' || *line == '\n' || *line == '\r')
+    return NULL;
+  char *token = line;
+  while (*line && *line != '\n' && *line != '\r' && *line != separator
+    && (separator != ' ' || *line != '\t'))
+    line++;
+  if (*line) {
+    *line = '\0';
+    line++;
+  }
+  return token;
+}
+
 int CbcMipStartIO::read(OsiSolverInterface *solver, const char *fileName,
   std::vector< std::pair< std::string, double > > &colValues,
   double &solObj, CoinMessageHandler *messHandler, CoinMessages *pcoinmsgs)
+{
+  std::vector< int > columns;
+  std::vector< double > values;
+  int returnCode = read(solver, fileName, columns, values, solObj,
+    messHandler, pcoinmsgs);
+  colValues.clear();
+  if (!returnCode) {
+    colValues.reserve(columns.size());
+    for (size_t i = 0; i < columns.size(); i++)
+      colValues.push_back(pair< string, double >(solver->getColName(columns[i]), values[i]));
+  }
+  return returnCode;
+}
+
+int CbcMipStartIO::read(OsiSolverInterface *solver, const char *fileName,
+  std::vector< int > &columns, std::vector< double > &values,
+  double &solObj, CoinMessageHandler *messHandler, CoinMessages *pcoinmsgs)
 {
   CoinMessages &messages = *pcoinmsgs;
 #define STR_SIZE 256
   char printLine[STR_SIZE] = "";
-  FILE *f = fopen(fileName, "r");
+  double startTime = CoinCpuTime();
+  FILE *f = fopen(fileName, "rb");
   if (!f) {
     sprintf(printLine, "Unable to open file %s.", fileName);
     messHandler->message(CBC_GENERAL, messages) << printLine << CoinMessageEol;
     return 1;
   }
-  char line[STR_SIZE] = "";
-
-  int nLine = 0;
-  // check if psv format!
-  int lengthFilename = strlen(fileName);
-  // separator
-  char separator = ' ';
-  if (strstr(fileName,".psv") == fileName+lengthFilename-4)
-    separator = '|';
-  else if (strstr(fileName,".csv") == fileName+lengthFilename-4) 
-    separator = ',';
-  if (separator==' ') {
-    // ordinary
-    while (fgets(line, STR_SIZE, f)) {
-      ++nLine;
-      char col[4][STR_SIZE] = {"", "", "", ""};
-      int nread = sscanf(line, "%s %s %s %s", col[0], col[1], col[2], col[3]);
-      if (!nread)
-	continue;
-      /* line with variable value */
-      if (strlen(col[0]) && isdigit(col[0][0]) && (nread >= 3)) {
-	if (!isNumericStr(col[0])) {
-	  sprintf(printLine, "Reading: %s, line %d - first column in mipstart file should be numeric, ignoring.", fileName, nLine);
-	  messHandler->message(CBC_GENERAL, messages) << printLine << CoinMessageEol;
-	  continue;
-	}
-	if (!isNumericStr(col[2])) {
-	  sprintf(printLine, "Reading: %s, line %d - Third column in mipstart file should be numeric, ignoring.", fileName, nLine);
-	  messHandler->message(CBC_GENERAL, messages) << printLine << CoinMessageEol;
-	  continue;
-	}
-	
-	char *name = col[1];
-	double value = atof(col[2]);
-	
-	colValues.push_back(pair< string, double >(string(name), value));
+  const int numCols = solver->getNumCols();
+  CbcMipStartNameHash colIdx(solver);
+  // value and whether mentioned - last value in file wins
+  std::vector< double > fullValues(numCols, 0.0);
+  std::vector< char > mentioned(numCols, 0);
+  int nRead = 0;
+  int nNotFound = 0;
+  solObj = COIN_DBL_MAX;
+
+  char magic[sizeof(mipStartMagic)];
+  if (fread(magic, 1, sizeof(magic), f) == sizeof(magic) && !memcmp(magic, mipStartMagic, sizeof(magic))) {
+    // binary
+    int header[2];
+    CoinInt64 nameBytes = 0;
+    bool ok = fread(header, sizeof(int), 2, f) == 2 && header[1] >= 0
+      && fread(&solObj, sizeof(double), 1, f) == 1
+      && fread(&nameBytes, sizeof(CoinInt64), 1, f) == 1 && nameBytes >= 0;
+    int n = ok ? header[1] : 0;
+    std::vector< int > which(n);
+    std::vector< double > value(n);
+    std::vector< char > names(static_cast< size_t >(nameBytes) + 1, '\0');
+    if (ok && n) {
+      ok = fread(&which[0], sizeof(int), n, f) == static_cast< size_t >(n)
+        && fread(&value[0], sizeof(double), n, f) == static_cast< size_t >(n)
+        && fread(&names[0], 1, static_cast< size_t >(nameBytes), f) == static_cast< size_t >(nameBytes);
+    }
+    if (!ok) {
+      sprintf(printLine, "Reading: %s - binary mipstart file is truncated or corrupt.", fileName);
+      messHandler->message(CBC_GENERAL, messages) << printLine << CoinMessageEol;
+      fclose(f);
+      return 1;
+    }
+    // use stored index if written for this model, otherwise name
+    bool sameModel = header[0] == numCols;
+    const char *name = &names[0];
+    const char *endNames = name + nameBytes;
+    for (int i = 0; i < n; i++) {
+      if (name >= endNames) {
+        sprintf(printLine, "Reading: %s - binary mipstart file has too few names.", fileName);
+        messHandler->message(CBC_GENERAL, messages) << printLine << CoinMessageEol;
+        fclose(f);
+        return 1;
+      }
+      int idx = which[i];
+      if (!sameModel || idx < 0 || idx >= numCols || strcmp(colIdx.name(idx), name))
+        idx = colIdx.find(name);
+      if (idx >= 0) {
+        fullValues[idx] = value[i];
+        mentioned[idx] = 1;
+      } else {
+        nNotFound++;
       }
+      nRead++;
+      name += strlen(name) + 1;
     }
   } else {
-    // csv or psv
-    int nBad1 = 0;
-    int nBad2 = 0;
-    while (fgets(line, STR_SIZE, f)) {
-      ++nLine;
-      // clean line
-      // out \n \r and blanks
-      int n = strlen(line);
-      int nNew = 0;
-      for (int i=0;i<n;i++) {
-	char charX = line[i];
-	if (charX==' ') {
-	  continue;
-	} else if (charX=='\n'||charX=='\r') {
-	  line[nNew]='\0';
-	  break;
-	} else {
-	  line[nNew++] = charX;
-	}
+    rewind(f);
+    // large buffer as files can be big
+    setvbuf(f, NULL, _IOFBF, 1 << 20);
+#define LINE_SIZE 4096
+    char line[LINE_SIZE] = "";
+
+    int nLine = 0;
+    // check if psv format!
+    int lengthFilename = strlen(fileName);
+    // separator
+    char separator = ' ';
+    if (strstr(fileName,".psv") == fileName+lengthFilename-4)
+      separator = '|';
+    else if (strstr(fileName,".csv") == fileName+lengthFilename-4) 
+      separator = ',';
+    if (separator==' ') {
+      // ordinary
+      while (fgets(line, LINE_SIZE, f)) {
+        ++nLine;
+        if (nLine == 1) {
+          // status line may give objective
+          char *objective = strstr(line, "objective value");
+          if (objective)
+            solObj = atof(objective + 15);
+        }
+        char *next = line;
+        char *col[3];
+        int nread = 0;
+        while (nread < 3 && (col[nread] = nextToken(next, ' ')))
+          nread++;
+        if (!nread)
+          continue;
+        /* line with variable value */
+        if (isdigit(col[0][0]) && (nread >= 3)) {
+          if (!isNumericStr(col[0])) {
+            sprintf(printLine, "Reading: %s, line %d - first column in mipstart file should be numeric, ignoring.", fileName, nLine);
+            messHandler->message(CBC_GENERAL, messages) << printLine << CoinMessageEol;
+            continue;
+          }
+          if (!isNumericStr(col[2])) {
+            sprintf(printLine, "Reading: %s, line %d - Third column in mipstart file should be numeric, ignoring.", fileName, nLine);
+            messHandler->message(CBC_GENERAL, messages) << printLine << CoinMessageEol;
+            continue;
+          }
+          nRead++;
+          int idx = colIdx.find(col[1]);
+          if (idx >= 0) {
+            fullValues[idx] = strtod(col[2], NULL);
+            mentioned[idx] = 1;
+          } else {
+            nNotFound++;
+          }
+        }
       }
-      char * pipeorcomma = strchr(line,separator);
-      if (!pipeorcomma) {
-	if (!nBad1) {
-	  if (nLine>1) {
-	    sprintf(printLine, "Reading: %s, line %d (%s) - mipstart file should contain |.", fileName, nLine,line);
-	    messHandler->message(CBC_GENERAL, messages) << printLine << CoinMessageEol;
-	  } else {
-	    // may be OK
-	    nBad1--;
-	  }
-	}
-	nBad1++;
-	continue;
+    } else {
+      // csv or psv
+      int nBad1 = 0;
+      int nBad2 = 0;
+      while (fgets(line, LINE_SIZE, f)) {
+        ++nLine;
+        // clean line
+        // out \n \r and blanks
+        int n = strlen(line);
+        int nNew = 0;
+        for (int i=0;i<n;i++) {
+          char charX = line[i];
+          if (charX==' ') {
+            continue;
+          } else if (charX=='\n'||charX=='\r') {
+            break;
+          } else {
+            line[nNew++] = charX;
+          }
+        }
+        line[nNew]='\0';
+        char * pipeorcomma = strchr(line,separator);
+        if (!pipeorcomma) {
+          if (!nBad1) {
+            if (nLine>1) {
+              sprintf(printLine, "Reading: %s, line %d (%s) - mipstart file should contain |.", fileName, nLine,line);
+              messHandler->message(CBC_GENERAL, messages) << printLine << CoinMessageEol;
+            } else {
+              // may be OK
+              nBad1--;
+            }
+          }
+          nBad1++;
+          continue;
+        }
+        *pipeorcomma = '\0';
+        if (!isNumericStr(pipeorcomma+1)) {
+          if (!nBad2) {
+            if (nLine>1) {
+              sprintf(printLine, "Reading: %s, line %d (%s) - Second column in mipstart file should be numeric.", fileName, nLine,line);
+              messHandler->message(CBC_GENERAL, messages) << printLine << CoinMessageEol;
+            } else {
+              // may be OK
+              nBad2--;
+            }
+          }
+          nBad2++;
+          continue;
+        }
+
+        nRead++;
+        int idx = colIdx.find(line);
+        if (idx >= 0) {
+          fullValues[idx] = strtod(pipeorcomma+1, NULL);
+          mentioned[idx] = 1;
+        } else {
+          nNotFound++;
+        }
       }
-      *pipeorcomma = '\0';
-      if (!isNumericStr(pipeorcomma+1)) {
-	if (!nBad2) {
-	  if (nLine>1) {
-	    sprintf(printLine, "Reading: %s, line %d (%s) - Second column in mipstart file should be numeric.", fileName, nLine,line);
-	    messHandler->message(CBC_GENERAL, messages) << printLine << CoinMessageEol;
-	  } else {
-	    // may be OK
-	    nBad2--;
-	  }
-	}
-	nBad2++;
-	continue;
+      if (nBad1||nBad2) {
+        sprintf(printLine, "Reading: %s, %d errors.", fileName, nBad1+nBad2);
+        messHandler->message(CBC_GENERAL, messages) << printLine << CoinMessageEol;
+        fclose(f);
+        return 1;
       }
-	
-      double value = atof(pipeorcomma+1);
-      
-      colValues.push_back(pair< string, double >(string(line), value));
-    }
-    if (nBad1||nBad2) {
-      sprintf(printLine, "Reading: %s, %d errors.", fileName, nBad1+nBad2);
-      messHandler->message(CBC_GENERAL, messages) << printLine << CoinMessageEol;
-      return 1;
     }
+#undef LINE_SIZE
   }
+  fclose(f);
 
-  const int numCols = solver->getNumCols();
-  if (colValues.size()) {
-    sprintf(printLine, "MIPStart values read for %d variables.", static_cast< int >(colValues.size()));
+  if (!nRead) {
+    sprintf(printLine, "File %s does not contains a solution.", fileName);
     messHandler->message(CBC_GENERAL, messages) << printLine << CoinMessageEol;
-    vector< pair< string, double > > fullValues;
-    /* for fast search of column names */
-    map< string, int > colIdx;
-    for (int i = 0; i < numCols; i++) {
-      fullValues.push_back(pair< string, double >(solver->getColName(i), 0.0));
-      colIdx[solver->getColName(i)] = i;
-    }
-    const double *lower = solver->getColLower();
-    const double *upper = solver->getColUpper();
-    int nBadValues = 0;
-    for (int i = 0; (i < static_cast< int >(colValues.size())); ++i) {
-      map< string, int >::const_iterator mIt = colIdx.find(colValues[i].first);
-      if (mIt != colIdx.end()) {
-        const int idx = mIt->second;
-        double v = colValues[i].second;
-	if (v>upper[idx]) {
-	  nBadValues++;
-	  v = upper[idx];
-	} else if (v<lower[idx]) {
-	  nBadValues++;
-	  v = lower[idx];
-	}
-        fullValues[idx].second = v;
+    return 1;
+  }
+  sprintf(printLine, "MIPStart values read for %d variables.", nRead);
+  messHandler->message(CBC_GENERAL, messages) << printLine << CoinMessageEol;
+  if (nNotFound == nRead) {
+    sprintf(printLine, "No names in mipstart file %s match a column.", fileName);
+    messHandler->message(CBC_GENERAL, messages) << printLine << CoinMessageEol;
+    return 1;
+  } else if (nNotFound) {
+    sprintf(printLine, "Warning: %d names in mipstart file do not match any column.", nNotFound);
+    messHandler->message(CBC_GENERAL, messages) << printLine << CoinMessageEol;
+  }
+  const double *lower = solver->getColLower();
+  const double *upper = solver->getColUpper();
+  int nBadValues = 0;
+  columns.clear();
+  values.clear();
+  for (int i = 0; i < numCols; i++) {
+    if (mentioned[i]) {
+      double v = fullValues[i];
+      if (v > upper[i]) {
+        nBadValues++;
+        v = upper[i];
+      } else if (v < lower[i]) {
+        nBadValues++;
+        v = lower[i];
       }
+      columns.push_back(i);
+      values.push_back(v);
     }
-    if (nBadValues) {
-      sprintf(printLine,"Warning: modifying %d solution values outside bounds",
-	      nBadValues);
-      messHandler->message(CBC_GENERAL, messages) << printLine << CoinMessageEol;
-    }
-    colValues = fullValues;
-  } else {
-    sprintf(printLine, "File %s does not contains a solution.", fileName);
+  }
+  if (nBadValues) {
+    sprintf(printLine,"Warning: modifying %d solution values outside bounds",
+            nBadValues);
     messHandler->message(CBC_GENERAL, messages) << printLine << CoinMessageEol;
-    fclose(f);
+  }
+  sprintf(printLine, "MIPStart file parsed in %.2f seconds.", CoinCpuTime() - startTime);
+  messHandler->message(CBC_GENERAL, messages) << printLine << CoinMessageEol;
+  return 0;
+}
+
+int CbcMipStartIO::writeBinary(const OsiSolverInterface *solver, const char *fileName,
+  const double *solution, double objValue)
+{
+  FILE *f = fopen(fileName, "wb");
+  if (!f)
     return 1;
+  const int numCols = solver->getNumCols();
+  std::vector< int > which;
+  std::vector< double > value;
+  std::string names;
+  for (int i = 0; i < numCols; i++) {
+    if (solution[i]) {
+      which.push_back(i);
+      value.push_back(solution[i]);
+      names += solver->getColName(i);
+      names += '\0';
+    }
+  }
+  int header[2];
+  header[0] = numCols;
+  header[1] = static_cast< int >(which.size());
+  CoinInt64 nameBytes = names.size();
+  bool ok = fwrite(mipStartMagic, 1, sizeof(mipStartMagic), f) == sizeof(mipStartMagic)
+    && fwrite(header, sizeof(int), 2, f) == 2
+    && fwrite(&objValue, sizeof(double), 1, f) == 1
+    && fwrite(&nameBytes, sizeof(CoinInt64), 1, f) == 1;
+  if (ok && header[1]) {
+    ok = fwrite(&which[0], sizeof(int), header[1], f) == static_cast< size_t >(header[1])
+      && fwrite(&value[0], sizeof(double), header[1], f) == static_cast< size_t >(header[1])
+      && fwrite(names.data(), 1, names.size(), f) == names.size();
   }
+  if (fclose(f))
+    ok = false;
+  return ok ? 0 : 1;
+}
 
-  fclose(f);
-  return 0;
+bool CbcMipStartIO::isBinaryFileName(const char *fileName)
+{
+  size_t length = strlen(fileName);
+  return length > 5 && !strcmp(fileName + length - 5, ".mipb");
 }
 
 int CbcMipStartIO::computeCompleteSolution(CbcModel *model, OsiSolverInterface *solver,
@@ -200,13 +449,15 @@ int CbcMipStartIO::computeCompleteSolution(CbcModel *model, OsiSolverInterface *
   int status = 0;
   double compObj = COIN_DBL_MAX;
   bool foundIntegerSol = false;
+  double startTime = CoinCpuTime();
+  double subMipTime = 0.0;
   OsiSolverInterface *lp = solver->clone();
 
-  map< string, int > colIdx;
   assert((static_cast< int >(colNames.size())) == lp->getNumCols());
   /* for fast search of column names */
-  for (int i = 0; (i < static_cast< int >(colNames.size())); ++i)
-    colIdx[colNames[i]] = i;
+  CbcMipStartNameHash colIdx(colNames);
+  // partial start - leave integers not mentioned free for sub-MIP
+  const bool partial = (extraActions == 7);
 
   char printLine[STR_SIZE];
   int fixed = 0;
@@ -229,12 +480,12 @@ int CbcMipStartIO::computeCompleteSolution(CbcModel *model, OsiSolverInterface *
 
 #if JUST_FIX_INTEGER > 1
   // all not mentioned are at zero
-  for (int i = 0; (i < lp->getNumCols()); ++i) {
+  for (int i = 0; (i < lp->getNumCols()) && !partial; ++i) {
     if (lp->isInteger(i))
       lp->setColBounds(i, 0.0, 0.0);
   }
 #endif
-  if (extraActions) {
+  if (extraActions && !partial) {
     const double * objective = lp->getObjCoefficients();
     const double * lower = lp->getColLower();
     const double * upper = lp->getColUpper();
@@ -275,13 +526,12 @@ int CbcMipStartIO::computeCompleteSolution(CbcModel *model, OsiSolverInterface *
     }
   }
   for (int i = 0; (i < static_cast< int >(colValues.size())); ++i) {
-    map< string, int >::const_iterator mIt = colIdx.find(colValues[i].first);
-    if (mIt == colIdx.end()) {
+    const int idx = colIdx.find(colValues[i].first.c_str());
+    if (idx < 0) {
       if (!notFound)
-        strcpy(colNotFound, colValues[i].first.c_str());
+        strncpy(colNotFound, colValues[i].first.c_str(), sizeof(colNotFound) - 1);
       notFound++;
     } else {
-      const int idx = mIt->second;
       double v = colValues[i].second;
 #if JUST_FIX_INTEGER
       if (!lp->isInteger(idx))
@@ -299,7 +549,7 @@ int CbcMipStartIO::computeCompleteSolution(CbcModel *model, OsiSolverInterface *
     }
   }
 
-  if (extraActions)
+  if (extraActions && !partial)
     fixed = lp->getNumIntegers();
   if (!fixed) {
     messHandler->message(CBC_GENERAL, messages)
@@ -440,6 +690,7 @@ int CbcMipStartIO::computeCompleteSolution(CbcModel *model, OsiSolverInterface *
       compObj,
       model->getCutoff(),
       "ReduceInMIPStart");
+    subMipTime = CoinCpuTime() - start;
     if ((returnCode & 1) != 0) {
       sprintf(printLine, "Mini branch and bound defined values for remaining variables in %.2f seconds.",
         CoinCpuTime() - start);
@@ -724,6 +975,10 @@ int CbcMipStartIO::computeCompleteSolution(CbcModel *model, OsiSolverInterface *
   }
 
 TERMINATE:
+  sprintf(printLine, "MIPStart repair took %.2f seconds (%.2f in sub-MIP).",
+    CoinCpuTime() - startTime, subMipTime);
+  messHandler->message(CBC_GENERAL, messages)
+    << printLine << CoinMessageEol;
   delete[] realObj;
   delete lp;
   return status;
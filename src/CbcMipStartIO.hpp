@@ -16,18 +16,43 @@ class CBCLIB_EXPORT CbcMipStartIO{
 public:  
 /* tries to read mipstart (solution file) from
    fileName, filling colValues and obj
+   (COIN_DBL_MAX if file does not give it).
+   Only columns mentioned in file are returned.
+   Text files are parsed as they are read with names looked up in a
+   hash of column names.  Files written by writeBinary are recognized
+   whatever their name.
    returns 0 with success,
-   1 otherwise */
+   1 otherwise (also if no name in file matches a column) */
 static int read(OsiSolverInterface *solver, const char *fileName,
   std::vector< std::pair< std::string, double > > &colValues,
   double &solObj, CoinMessageHandler *messHandler, CoinMessages *pcoinmsgs);
 
+/* as above but returns column indices (in increasing order)
+   and values - no strings are created */
+static int read(OsiSolverInterface *solver, const char *fileName,
+  std::vector< int > &columns, std::vector< double > &values,
+  double &solObj, CoinMessageHandler *messHandler, CoinMessages *pcoinmsgs);
+
+/* writes nonzero values of solution as compact binary mipstart -
+   header, then column indices, values and names ('\0' separated).
+   On reading, indices are used if model has same number of columns
+   and names agree, otherwise names.  Native byte order.
+   returns 0 with success,
+   1 otherwise */
+static int writeBinary(const OsiSolverInterface *solver, const char *fileName,
+  const double *solution, double objValue);
+
+/* true if fileName ends in .mipb */
+static bool isBinaryFileName(const char *fileName);
+
 /* from a partial list of variables tries to fill the
    remaining variable values.
    extraActions 0 -default, otherwise set integers not mentioned
    1 - to lower bound, 2 - to upper bound
    3,5 ones without costs as 1,2 - ones with costs to cheapest
    4,6 ones without costs as 1,2 - ones with costs to expensive
+   7 partial start - integers not mentioned are left free and
+     filled in by a small (node limited) branch and bound
 */
 static int computeCompleteSolution(CbcModel *model, OsiSolverInterface *solver,
   const std::vector< std::string > colNames,
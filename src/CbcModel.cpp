@@ -22,6 +22,7 @@ extern int gomory_try;
 #include <cassert>
 #include <cfloat>
 #include <cmath>
+#include <typeinfo>
 #ifdef CBC_HAS_CLP
 // include Presolve from Clp
 #include "ClpDualRowDantzig.hpp"
@@ -46,6 +47,7 @@ extern int gomory_try;
 #include "CbcHeuristicRINS.hpp"
 #include "CbcMessage.hpp"
 #include "CbcModel.hpp"
+#include "CbcProgressStream.hpp"
 #include "CbcStatistics.hpp"
 #include "CbcStrategy.hpp"
 #include "CbcTreeLocal.hpp"
@@ -79,6 +81,7 @@ extern int gomory_try;
 
 #include "CbcCompareActual.hpp"
 #include "CbcCompareObjective.hpp"
+#include "CbcTrace.hpp"
 #include "CbcTree.hpp"
 // This may be dummy
 #include "CbcThread.hpp"
@@ -89,6 +92,7 @@ typedef struct {
   CbcModel *model;
   int switches;
   int iModel;
+  void *trace; // of thread starting root threads
 } rootBundle;
 static void *doRootCbcThread(void *voidInfo);
 
@@ -1428,6 +1432,7 @@ void CbcModel::saveModel(OsiSolverInterface *saveSolver,
         printf("%d rows added ZZZZZ\n",
                solver_->getNumRows() - continuousSolver_->getNumRows());
 #endif
+      int restartNumber = numberRestarts_ + 1;
       int returnCode = heuristic.smallBranchAndBound(
           solver2, -1, newSolution, objectiveValue, *checkCutoffForRestart,
           "Reduce");
@@ -1446,6 +1451,7 @@ void CbcModel::saveModel(OsiSolverInterface *saveSolver,
           setBestSolution(CBC_ROUNDING, objectiveValue, newSolution);
         }
         delete[] newSolution;
+        numberRestarts_ = CoinMax(numberRestarts_, restartNumber);
         *feasible = false; // stop search
       }
 #if 0 // probably not needed def CBC_THREAD
@@ -1945,7 +1951,15 @@ void CbcModel::branchAndBound(int doStatistics)
   strongInfo_[4] = 0;
   strongInfo_[5] = 0;
   strongInfo_[6] = 0;
+  lookaheadInfo_[0] = 0;
+  lookaheadInfo_[1] = 0;
+  lookaheadInfo_[2] = 0;
+  nodeCache_.clear();
+  globalFixing_.clear();
+  safeCheck_.clear();
   numberStrongIterations_ = 0;
+  numberHotStartReuses_ = 0;
+  numberFactorizationsSaved_ = 0;
   currentNode_ = NULL;
   // See if should do cuts old way
   if (parallelMode() < 0) {
@@ -2185,6 +2199,12 @@ void CbcModel::branchAndBound(int doStatistics)
     // and signal model set up
     eventHandler->event(CbcEventHandler::startUp);
   }
+  if (progressStream_ && !parentModel_) {
+    progressStream_->reset();
+    progressStream_->event(this, "start");
+  }
+  if (!parentModel_)
+    boundHistory_.start(bestObjective_, -COIN_DBL_MAX);
 #define CLIQUE_ANALYSIS
 #ifdef CLIQUE_ANALYSIS
   // set up for probing
@@ -2258,6 +2278,9 @@ void CbcModel::branchAndBound(int doStatistics)
   status_ = 0;
   secondaryStatus_ = 0;
   phase_ = 0;
+  // restarted search carries on count from model it replaces
+  if (!parentModel_)
+    numberRestarts_ = 0;
   /*
       Scan the variables, noting the integer variables. Create an
       CbcSimpleInteger object for each integer variable.
@@ -2591,13 +2614,31 @@ void CbcModel::branchAndBound(int doStatistics)
   {
     int numberOdd = 0;
     int numberSOS = 0;
+    // odd objects which are not SOS
+    int numberOtherOdd = 0;
+    /* objects which may branch by adding rows (so no node cache) -
+       exact Osi types as linked objects derive from them */
+    int numberNotBounds = 0;
     for (int i = 0; i < numberObjects_; i++) {
-      if (!object_[i]->canDoHeuristics())
-        numberOdd++;
+      if (!dynamic_cast<CbcSimpleInteger *>(object_[i]) &&
+          !dynamic_cast<CbcSOS *>(object_[i]) &&
+          !dynamic_cast<CbcClique *>(object_[i]) &&
+          !dynamic_cast<CbcNWay *>(object_[i]) &&
+          !dynamic_cast<CbcFollowOn *>(object_[i]) &&
+          typeid(*object_[i]) != typeid(OsiSimpleInteger) &&
+          typeid(*object_[i]) != typeid(OsiSOS))
+        numberNotBounds++;
       CbcSOS *obj = dynamic_cast<CbcSOS *>(object_[i]);
       if (obj)
         numberSOS++;
+      if (!object_[i]->canDoHeuristics()) {
+        numberOdd++;
+        if (!obj)
+          numberOtherOdd++;
+      }
     }
+    // node cache key is bounds so only safe if branching is on bounds
+    nodeCache_.setBoundsOnly(!numberNotBounds);
     if (numberOdd) {
       if (numberHeuristics_ && (specialOptions_ & 1024) == 0) {
         int k = 0;
@@ -2617,13 +2658,16 @@ void CbcModel::branchAndBound(int doStatistics)
       }
       // If odd switch off AddIntegers
       specialOptions_ &= ~65536;
-      // switch off fast nodes for now
-      fastNodeDepth_ = -1;
+      /* switch off fast nodes unless only SOS - subtrees in Clp
+         (fastNodeDepth_ >= 0) check solutions against SOS */
+      if (numberOtherOdd || fastNodeDepth_ < -1)
+        fastNodeDepth_ = -1;
       moreSpecialOptions_ &= ~33554432; // no diving
     } else if (numberSOS) {
       specialOptions_ |= 128; // say can do SOS in dynamic mode
-      // switch off fast nodes for now
-      fastNodeDepth_ = -1;
+      // switch off complete fathoming (subtrees check solutions)
+      if (fastNodeDepth_ < -1)
+        fastNodeDepth_ = -1;
       moreSpecialOptions_ &= ~33554432; // no diving
     }
     if (numberThreads_ > 0) {
@@ -2731,6 +2775,9 @@ void CbcModel::branchAndBound(int doStatistics)
       symmetryInfo_ = new CbcSymmetry();
       symmetryInfo_->setupSymmetry(this);
       int numberGenerators = symmetryInfo_->statsOrbits(this, 0);
+      if (orbitopalFixing_ && symmetryInfo_->numberUsefulOrbits() &&
+          (moreSpecialOptions2_ & 131072) != 0)
+        symmetryInfo_->findOrbitopes(this);
       if (!symmetryInfo_->numberUsefulOrbits() &&
           (moreSpecialOptions2_ & (128 | 256)) != (128 | 256)) {
         delete symmetryInfo_;
@@ -3039,6 +3086,7 @@ void CbcModel::branchAndBound(int doStatistics)
         dynamic_cast<CoinWarmStartBasis *>(solver_->getEmptyWarmStart());
     for (int i = 0; i < numberModels; i++) {
       rootModels[i] = new CbcModel(*this);
+      rootModels[i]->setProgressStream(NULL);
       if ((moreSpecialOptions2_&4194304) != 0) {
 	rootModels[i]->setCutoffIncrement(1.0e-5);
 	rootModels[i]->setAllowableGap(0.0);
@@ -3146,6 +3194,7 @@ void CbcModel::branchAndBound(int doStatistics)
       for (int iModel = 0; iModel < numberModels; iModel++) {
 	bundle[iModel].model = rootModels[iModel];
 	bundle[iModel].iModel = iModel;
+	bundle[iModel].trace = CbcTrace::current();
         doRootCbcThread(bundle+iModel);
 	double best = rootModels[iModel]->getMinimizationObjValue();
 	if (best < bestSoFar) {
@@ -3168,6 +3217,7 @@ void CbcModel::branchAndBound(int doStatistics)
         for (int iModel = kModel; iModel < CoinMin(numberModels, kModel + numberRootThreads); iModel++) {
 	  bundle[iModel].model = rootModels[iModel];
 	  bundle[iModel].iModel = iModel;
+	  bundle[iModel].trace = CbcTrace::current();
           pthread_create(&(threadId[iModel - kModel].thr), NULL,
             doRootCbcThread,
             bundle+iModel);
@@ -4213,9 +4263,11 @@ void CbcModel::branchAndBound(int doStatistics)
 #endif
   // Save copy of solver
   OsiSolverInterface *saveSolver = NULL;
-  if (!parentModel_ && (specialOptions_ & (512 + 32768)) != 0)
+  if (maximumRestarts_ > 0 && !parentModel_ &&
+      (specialOptions_ & (512 + 32768)) != 0)
     saveSolver = solver_->clone();
-  else if (parentModel_ && !(specialOptions_ & 2048) &&
+  else if (maximumRestarts_ > 0 && parentModel_ &&
+           !(specialOptions_ & 2048) &&
            (specialOptions_ & (512 + 32768)) == 512)
     saveSolver = solver_->clone();
   double checkCutoffForRestart = 1.0e100;
@@ -5080,10 +5132,12 @@ void CbcModel::branchAndBound(int doStatistics)
     } else {
       unlockThread();
     }
-    // If done 50/100 nodes see if worth trying reduction
+    // If done 50/100/200.. nodes see if worth trying reduction
     if (numberNodes_ >= nextCheckRestart) {
       if (nextCheckRestart < 100)
         nextCheckRestart = 100;
+      else if (saveSolver && nextCheckRestart < 800)
+        nextCheckRestart *= 2; // still early
       else
         nextCheckRestart = COIN_INT_MAX;
 #ifdef CBC_HAS_CLP
@@ -5111,9 +5165,13 @@ void CbcModel::branchAndBound(int doStatistics)
               Decide if we want to do a restart.
             */
       if (saveSolver && (specialOptions_ & (512 + 32768)) != 0) {
+        double restartStartTime = getCurrentSeconds();
         bool tryNewSearch = solverCharacteristics_->reducedCostsAccurate()
 	  && (getCutoff() < 1.0e20 && getCutoff() < checkCutoffForRestart);
         int numberColumns = getNumCols();
+        int numberFixed = 0;
+        int numberFixed2 = 0;
+        int numberFixedInTree = 0;
         if (tryNewSearch) {
           // adding increment back allows current best - tiny bit weaker
           checkCutoffForRestart = getCutoff() + getCutoffIncrement();
@@ -5121,6 +5179,25 @@ void CbcModel::branchAndBound(int doStatistics)
           printf("after %d nodes, cutoff %g - looking\n", numberNodes_,
                  getCutoff());
 #endif
+          double integerTolerance = getDblParam(CbcIntegerTolerance);
+          if (topOfTree_) {
+            // integers fixed globally since root (e.g. by probing)
+            lockThread();
+            const double *lower = saveSolver->getColLower();
+            const double *upper = saveSolver->getColUpper();
+            const double *treeLower = topOfTree_->lower();
+            const double *treeUpper = topOfTree_->upper();
+            for (int i = 0; i < numberIntegers_; i++) {
+              int iColumn = integerVariable_[i];
+              if (upper[iColumn] - lower[iColumn] > integerTolerance &&
+                  treeUpper[iColumn] - treeLower[iColumn] <= integerTolerance) {
+                saveSolver->setColLower(iColumn, treeLower[iColumn]);
+                saveSolver->setColUpper(iColumn, treeUpper[iColumn]);
+                numberFixedInTree++;
+              }
+            }
+            unlockThread();
+          }
           saveSolver->resolve();
           double direction = saveSolver->getObjSense();
           double gap =
@@ -5130,15 +5207,12 @@ void CbcModel::branchAndBound(int doStatistics)
           if (gap <= 0.0)
             gap = tolerance;
           gap += 100.0 * tolerance;
-          double integerTolerance = getDblParam(CbcIntegerTolerance);
 
           const double *lower = saveSolver->getColLower();
           const double *upper = saveSolver->getColUpper();
           const double *solution = saveSolver->getColSolution();
           const double *reducedCost = saveSolver->getReducedCost();
 
-          int numberFixed = 0;
-          int numberFixed2 = 0;
 #ifdef COIN_DEVELOP
           printf("gap %g\n", gap);
 #endif
@@ -5194,9 +5268,9 @@ void CbcModel::branchAndBound(int doStatistics)
           printf("Restart could fix %d integers (%d already fixed)\n",
                  numberFixed + numberFixed2, numberFixed2);
 #endif
-          numberFixed += numberFixed2;
-          if (numberFixed * 10 < numberColumns &&
-              numberFixed * 4 < numberIntegers_)
+          int numberFixedTotal = numberFixed + numberFixed2;
+          if (numberFixedTotal * 10 < numberColumns &&
+              numberFixedTotal < restartFraction_ * numberIntegers_)
             tryNewSearch = false;
         }
         // check for odd cuts
@@ -5218,6 +5292,13 @@ void CbcModel::branchAndBound(int doStatistics)
         // tryNewSearch=false;
 #endif
         if (tryNewSearch) {
+          if (progressStream_ && !parentModel_)
+            progressStream_->event(this, "restart");
+          int restartNumber = numberRestarts_ + 1;
+          handler_->message(CBC_RESTART_FIXED, messages_)
+              << restartNumber << numberNodes_ << numberFixed + numberFixed2
+              << numberIntegers_ << numberFixed << numberFixedInTree
+              << CoinMessageEol;
           // back to solver without cuts?
           OsiSolverInterface *solver2 = saveSolver->clone();
           const double *lower = saveSolver->getColLower();
@@ -5251,11 +5332,16 @@ void CbcModel::branchAndBound(int doStatistics)
               saveSolver, -1, newSolution, objectiveValue,
               checkCutoffForRestart, "Reduce");
           if (returnCode < 0) {
-#ifdef COIN_DEVELOP
-            printf("Restart - not small enough to do search after fixing\n");
-#endif
+            handler_->message(CBC_RESTART_TOOBIG, messages_)
+                << restartNumber << getCurrentSeconds() - restartStartTime
+                << CoinMessageEol;
             delete[] newSolution;
           } else {
+            // restarted search may have restarted again
+            numberRestarts_ = CoinMax(numberRestarts_, restartNumber);
+            handler_->message(CBC_RESTART_END, messages_)
+                << restartNumber << getCurrentSeconds() - restartStartTime
+                << CoinMessageEol;
             // 1 for sol'n, 2 for finished, 3 for both
             if ((returnCode & 1) != 0) {
               // increment number of solutions so other heuristics can test
@@ -5292,8 +5378,10 @@ void CbcModel::branchAndBound(int doStatistics)
             break;
           }
         }
-        delete saveSolver;
-        saveSolver = NULL;
+        if (nextCheckRestart == COIN_INT_MAX) {
+          delete saveSolver;
+          saveSolver = NULL;
+        }
       }
     }
     /*  Check for abort on limits: node count, solution count, time, integrality
@@ -5453,22 +5541,11 @@ void CbcModel::branchAndBound(int doStatistics)
       int nNodes = tree_->size();
 
       // MODIF PIERRE
-      bestPossibleObjective_ = tree_->getBestPossibleObjective();
-#ifdef CBC_THREAD
-      if (parallelMode() > 0 && master_) {
-        // need to adjust for ones not on tree
-        int numberThreads = master_->numberThreads();
-        for (int i = 0; i < numberThreads; i++) {
-          CbcThread *child = master_->child(i);
-          if (child->node()) {
-            // adjust
-            double value = child->node()->objectiveValue();
-            bestPossibleObjective_ = CoinMin(bestPossibleObjective_, value);
-          }
-        }
-      }
-#endif
+      bestPossibleObjective_ = bestPossibleInTree();
       unlockThread();
+      // bound history reuses bound found for status
+      if (!parentModel_ && nNodes)
+        boundHistory_.addDual(CoinMin(bestPossibleObjective_, bestObjective_));
 #if CBC_USEFUL_PRINTING > 1
       if (getCutoff() < 1.0e20) {
         if (fabs(getCutoff() - (bestObjective_ - getCutoffIncrement())) >
@@ -5526,6 +5603,11 @@ void CbcModel::branchAndBound(int doStatistics)
       }
       lastSecPrintProgress_ = CoinWallclockTime();
     }
+    if (progressStream_ && !parentModel_ && progressStream_->due()) {
+      lockThread();
+      progressStream_->check(this);
+      unlockThread();
+    }
     // See if can stop on gap
     if (canStopOnGap()) {
       stoppedOnGap_ = true;
@@ -5789,6 +5871,24 @@ void CbcModel::branchAndBound(int doStatistics)
         << bestObjective_ << bestPossibleObjective_ << numberIterations_
         << numberNodes_ << getCurrentSeconds() << CoinMessageEol;
   }
+  if (progressStream_ && !parentModel_)
+    progressStream_->event(this, "end");
+  if (!parentModel_)
+    boundHistory_.finish(bestObjective_, bestPossibleObjective_);
+  if (!parentModel_) {
+    // decisions of automatic cut scheduling
+    for (int i = 0; i < numberCutGenerators_; i++) {
+      CbcCutGenerator *generator = generator_[i];
+      if (generator->automatic())
+        handler_->message(CBC_CUT_SCHEDULE, messages_)
+            << i << generator->cutGeneratorName()
+            << generator->howOften() % 1000000 << generator->whatDepth()
+            << generator->gainAtRoot() << generator->gainInTree()
+            << generator->timeInCutGenerator()
+            << generator->numberScheduleChanges() << generator->scheduleReason()
+            << CoinMessageEol;
+    }
+  }
   if ((moreSpecialOptions_ & 4194304) != 0) {
     // Conflict cuts
     int numberCuts = globalCuts_.sizeRowCuts();
@@ -5814,6 +5914,37 @@ void CbcModel::branchAndBound(int doStatistics)
     handler_->message(CBC_STRONG_STATS, messages_)
         << strongInfo_[0] << numberStrongIterations_ << strongInfo_[2]
         << strongInfo_[1] << CoinMessageEol;
+  if (numberFactorizationsSaved_)
+    handler_->message(CBC_HOTSTART_STATS, messages_)
+        << numberFactorizationsSaved_ << numberHotStartReuses_
+        << CoinMessageEol;
+  if (lookaheadInfo_[0] + lookaheadInfo_[1])
+    handler_->message(CBC_LOOKAHEAD_STATS, messages_)
+        << strongLookahead_ << lookaheadInfo_[0] << lookaheadInfo_[1]
+        << lookaheadInfo_[2] << CoinMessageEol;
+  if (nodeCache_.maximumEntries())
+    handler_->message(CBC_NODE_CACHE, messages_)
+        << nodeCache_.numberHits() << nodeCache_.numberPruned()
+        << nodeCache_.numberWarmStarts() << nodeCache_.numberMisses()
+        << CoinMessageEol;
+  if (globalFixing_.maximumRecords())
+    handler_->message(CBC_GLOBAL_FIXING, messages_)
+        << globalFixing_.numberRecorded() << globalFixing_.numberTightened()
+        << globalFixing_.numberFixed() << globalFixing_.numberNodesChanged()
+        << globalFixing_.numberNodesPruned() << CoinMessageEol;
+  if (fastNodeInfo_[0] + fastNodeInfo_[1])
+    handler_->message(CBC_FAST_NODES, messages_)
+        << numberExtraNodes_ << numberNodes_ - numberExtraNodes_
+        << fastNodeInfo_[0] << fastNodeInfo_[1] << CoinMessageEol;
+  // solution is checked on original model by CbcSolver after postsolve
+  if (safeCheck_.active() && safeCheck_.bestBound() > -COIN_DBL_MAX) {
+    double direction = solver_->getObjSense();
+    handler_->message(CBC_SAFE_BOUND, messages_)
+        << direction * safeCheck_.bestBound()
+        << direction * CoinMin(safeCheck_.boundCutoff(), 1.0e50)
+        << getBestPossibleObjValue() << safeCheck_.seconds()
+        << CoinMessageEol;
+  }
   if (!numberExtraNodes_)
     handler_->message(CBC_OTHER_STATS, messages_)
         << maximumDepthActual_ << numberDJFixed_ << CoinMessageEol;
@@ -6388,7 +6519,11 @@ CbcModel::CbcModel()
       continuousInfeasibilities_(COIN_INT_MAX), maximumCutPassesAtRoot_(20),
       maximumCutPasses_(10), preferredWay_(0), currentPassNumber_(0),
       maximumWhich_(INITIAL_MAXIMUM_WHICH), maximumRows_(0), randomSeed_(-1),
-      multipleRootTries_(0), currentDepth_(0), whichGenerator_(NULL),
+      multipleRootTries_(0), orbitopalFixing_(false), progressStream_(NULL),
+      maximumRestarts_(1), restartFraction_(0.25), numberRestarts_(0),
+      keepHotStart_(false), numberHotStartReuses_(0),
+      numberFactorizationsSaved_(0), strongLookahead_(0),
+      currentDepth_(0), whichGenerator_(NULL),
       maximumStatistics_(0), statistics_(NULL), maximumDepthActual_(0),
       numberDJFixed_(0.0), probingInfo_(NULL), numberFixedAtRoot_(0),
       numberFixedNow_(0), stoppedOnGap_(false), eventHappened_(false),
@@ -6421,6 +6556,11 @@ CbcModel::CbcModel()
   strongInfo_[4] = 0;
   strongInfo_[5] = 0;
   strongInfo_[6] = 0;
+  lookaheadInfo_[0] = 0;
+  lookaheadInfo_[1] = 0;
+  lookaheadInfo_[2] = 0;
+  fastNodeInfo_[0] = 0;
+  fastNodeInfo_[1] = 0;
   keepNamesPreproc = false;
   solverCharacteristics_ = NULL;
   nodeCompare_ = new CbcCompareDefault();
@@ -6491,7 +6631,11 @@ CbcModel::CbcModel(const OsiSolverInterface &rhs)
       continuousInfeasibilities_(COIN_INT_MAX), maximumCutPassesAtRoot_(20),
       maximumCutPasses_(10), preferredWay_(0), currentPassNumber_(0),
       maximumWhich_(INITIAL_MAXIMUM_WHICH), maximumRows_(0), randomSeed_(-1),
-      multipleRootTries_(0), currentDepth_(0), whichGenerator_(NULL),
+      multipleRootTries_(0), orbitopalFixing_(false), progressStream_(NULL),
+      maximumRestarts_(1), restartFraction_(0.25), numberRestarts_(0),
+      keepHotStart_(false), numberHotStartReuses_(0),
+      numberFactorizationsSaved_(0), strongLookahead_(0),
+      currentDepth_(0), whichGenerator_(NULL),
       maximumStatistics_(0), statistics_(NULL), maximumDepthActual_(0),
       numberDJFixed_(0.0), probingInfo_(NULL), numberFixedAtRoot_(0),
       numberFixedNow_(0), stoppedOnGap_(false), eventHappened_(false),
@@ -6524,6 +6668,11 @@ CbcModel::CbcModel(const OsiSolverInterface &rhs)
   strongInfo_[4] = 0;
   strongInfo_[5] = 0;
   strongInfo_[6] = 0;
+  lookaheadInfo_[0] = 0;
+  lookaheadInfo_[1] = 0;
+  lookaheadInfo_[2] = 0;
+  fastNodeInfo_[0] = 0;
+  fastNodeInfo_[1] = 0;
   solverCharacteristics_ = NULL;
   keepNamesPreproc = false;
   nodeCompare_ = new CbcCompareDefault();
@@ -6752,6 +6901,20 @@ CbcModel::CbcModel(const CbcModel &rhs, bool cloneHandler)
       currentPassNumber_(rhs.currentPassNumber_),
       maximumWhich_(rhs.maximumWhich_), maximumRows_(0),
       randomSeed_(rhs.randomSeed_), multipleRootTries_(rhs.multipleRootTries_),
+      orbitopalFixing_(rhs.orbitopalFixing_),
+      progressStream_(NULL),
+      boundHistory_(rhs.boundHistory_),
+      maximumRestarts_(rhs.maximumRestarts_),
+      restartFraction_(rhs.restartFraction_),
+      numberRestarts_(rhs.numberRestarts_),
+      cutSelection_(rhs.cutSelection_),
+      keepHotStart_(rhs.keepHotStart_),
+      numberHotStartReuses_(rhs.numberHotStartReuses_),
+      numberFactorizationsSaved_(rhs.numberFactorizationsSaved_),
+      strongLookahead_(rhs.strongLookahead_),
+      nodeCache_(rhs.nodeCache_),
+      globalFixing_(rhs.globalFixing_),
+      safeCheck_(rhs.safeCheck_),
       currentDepth_(0), whichGenerator_(NULL), maximumStatistics_(0),
       statistics_(NULL), maximumDepthActual_(0), numberDJFixed_(0.0),
       probingInfo_(NULL), numberFixedAtRoot_(rhs.numberFixedAtRoot_),
@@ -6780,6 +6943,11 @@ CbcModel::CbcModel(const CbcModel &rhs, bool cloneHandler)
   strongInfo_[4] = rhs.strongInfo_[4];
   strongInfo_[5] = rhs.strongInfo_[5];
   strongInfo_[6] = rhs.strongInfo_[6];
+  lookaheadInfo_[0] = rhs.lookaheadInfo_[0];
+  lookaheadInfo_[1] = rhs.lookaheadInfo_[1];
+  lookaheadInfo_[2] = rhs.lookaheadInfo_[2];
+  fastNodeInfo_[0] = rhs.fastNodeInfo_[0];
+  fastNodeInfo_[1] = rhs.fastNodeInfo_[1];
   keepNamesPreproc = rhs.keepNamesPreproc;
   solverCharacteristics_ = NULL;
   if (rhs.emptyWarmStart_)
@@ -7140,6 +7308,20 @@ CbcModel &CbcModel::operator=(const CbcModel &rhs) {
     maximumCutPasses_ = rhs.maximumCutPasses_;
     randomSeed_ = rhs.randomSeed_;
     multipleRootTries_ = rhs.multipleRootTries_;
+    orbitopalFixing_ = rhs.orbitopalFixing_;
+    progressStream_ = NULL;
+    boundHistory_ = rhs.boundHistory_;
+    maximumRestarts_ = rhs.maximumRestarts_;
+    restartFraction_ = rhs.restartFraction_;
+    numberRestarts_ = rhs.numberRestarts_;
+    cutSelection_ = rhs.cutSelection_;
+    keepHotStart_ = rhs.keepHotStart_;
+    numberHotStartReuses_ = rhs.numberHotStartReuses_;
+    numberFactorizationsSaved_ = rhs.numberFactorizationsSaved_;
+    strongLookahead_ = rhs.strongLookahead_;
+    nodeCache_ = rhs.nodeCache_;
+    globalFixing_ = rhs.globalFixing_;
+    safeCheck_ = rhs.safeCheck_;
     preferredWay_ = rhs.preferredWay_;
     currentPassNumber_ = rhs.currentPassNumber_;
     memcpy(intParam_, rhs.intParam_, sizeof(intParam_));
@@ -7208,6 +7390,11 @@ CbcModel &CbcModel::operator=(const CbcModel &rhs) {
     strongInfo_[4] = rhs.strongInfo_[4];
     strongInfo_[5] = rhs.strongInfo_[5];
     strongInfo_[6] = rhs.strongInfo_[6];
+    lookaheadInfo_[0] = rhs.lookaheadInfo_[0];
+    lookaheadInfo_[1] = rhs.lookaheadInfo_[1];
+    lookaheadInfo_[2] = rhs.lookaheadInfo_[2];
+    fastNodeInfo_[0] = rhs.fastNodeInfo_[0];
+    fastNodeInfo_[1] = rhs.fastNodeInfo_[1];
     solverCharacteristics_ = NULL;
     lastHeuristic_ = NULL;
     numberCutGenerators_ = rhs.numberCutGenerators_;
@@ -7575,6 +7762,13 @@ void CbcModel::resetModel() {
   searchStrategy_ = -1;
   strongStrategy_ = 0;
   numberStrongIterations_ = 0;
+  numberHotStartReuses_ = 0;
+  numberFactorizationsSaved_ = 0;
+  lookaheadInfo_[0] = 0;
+  lookaheadInfo_[1] = 0;
+  lookaheadInfo_[2] = 0;
+  fastNodeInfo_[0] = 0;
+  fastNodeInfo_[1] = 0;
   // Parameters which need to be reset
   setCutoff(COIN_DBL_MAX);
   dblParam_[CbcCutoffIncrement] = 1e-4;
@@ -7605,6 +7799,17 @@ void CbcModel::gutsOfCopy(const CbcModel &rhs, int mode) {
   maximumCutPasses_ = rhs.maximumCutPasses_;
   randomSeed_ = rhs.randomSeed_;
   multipleRootTries_ = rhs.multipleRootTries_;
+  orbitopalFixing_ = rhs.orbitopalFixing_;
+  progressStream_ = NULL;
+  maximumRestarts_ = rhs.maximumRestarts_;
+  restartFraction_ = rhs.restartFraction_;
+  cutSelection_ = rhs.cutSelection_;
+  keepHotStart_ = rhs.keepHotStart_;
+  strongLookahead_ = rhs.strongLookahead_;
+  nodeCache_.setMaximumEntries(rhs.nodeCache_.maximumEntries());
+  nodeCache_.setBoundsOnly(rhs.nodeCache_.boundsOnly());
+  globalFixing_.setMaximumRecords(rhs.globalFixing_.maximumRecords());
+  safeCheck_.setActive(rhs.safeCheck_.active());
   preferredWay_ = rhs.preferredWay_;
   resolveAfterTakeOffCuts_ = rhs.resolveAfterTakeOffCuts_;
   maximumNumberIterations_ = rhs.maximumNumberIterations_;
@@ -7712,6 +7917,8 @@ void CbcModel::moveInfo(const CbcModel &rhs) {
   eventHappened_ = rhs.eventHappened_;
   numberLongStrong_ = rhs.numberLongStrong_;
   numberStrongIterations_ = rhs.numberStrongIterations_;
+  numberHotStartReuses_ = rhs.numberHotStartReuses_;
+  numberFactorizationsSaved_ = rhs.numberFactorizationsSaved_;
   strongInfo_[0] = rhs.strongInfo_[0];
   strongInfo_[1] = rhs.strongInfo_[1];
   strongInfo_[2] = rhs.strongInfo_[2];
@@ -7719,9 +7926,15 @@ void CbcModel::moveInfo(const CbcModel &rhs) {
   strongInfo_[4] = rhs.strongInfo_[4];
   strongInfo_[5] = rhs.strongInfo_[5];
   strongInfo_[6] = rhs.strongInfo_[6];
+  lookaheadInfo_[0] = rhs.lookaheadInfo_[0];
+  lookaheadInfo_[1] = rhs.lookaheadInfo_[1];
+  lookaheadInfo_[2] = rhs.lookaheadInfo_[2];
+  fastNodeInfo_[0] = rhs.fastNodeInfo_[0];
+  fastNodeInfo_[1] = rhs.fastNodeInfo_[1];
   numberRowsAtContinuous_ = rhs.numberRowsAtContinuous_;
   cutoffRowNumber_ = rhs.cutoffRowNumber_;
   maximumDepth_ = rhs.maximumDepth_;
+  boundHistory_ = rhs.boundHistory_;
 }
 // Save a copy of the current solver so can be reset to
 void CbcModel::saveReferenceSolver() {
@@ -8051,6 +8264,7 @@ bool CbcModel::addCuts1(CbcNode *node, CoinWarmStartBasis *&lastws) {
   descendants.
 */
 int CbcModel::addCuts(CbcNode *node, CoinWarmStartBasis *&lastws) {
+  CbcTraceSpan traceSpan(CBC_TRACE_ADDCUTS, "addCuts");
   /*
       addCuts1 performs step 1 of restoring the subproblem at this node; see the
       comments there.
@@ -9189,6 +9403,14 @@ bool CbcModel::solveWithCuts(OsiCuts &cuts, int numberTries, CbcNode *node)
           << currentPassNumber_ << solver_->getNumRows()
           << solver_->getNumRows() - numberRowsAtContinuous_
           << solver_->getObjValue() << CoinMessageEol;
+      if (progressStream_ && !parentModel_) {
+        char extra[120];
+        sprintf(extra, "\"pass\":%d,\"rows\":%d,\"tightCuts\":%d,\"lp\":%.10g",
+                currentPassNumber_, solver_->getNumRows(),
+                solver_->getNumRows() - numberRowsAtContinuous_,
+                solver_->getObjValue());
+        progressStream_->event(this, "rootCuts", extra);
+      }
     }
     // see if looks like solution
     bool lazy = false;
@@ -9265,7 +9487,9 @@ bool CbcModel::solveWithCuts(OsiCuts &cuts, int numberTries, CbcNode *node)
           continue;
         // see if heuristic will do anything
         double saveValue = heuristicValue;
+        CbcTraceSpan traceSpan(CBC_TRACE_HEURISTIC, heuristic_[i]->heuristicName());
         int ifSol = heuristic_[i]->solution(heuristicValue, newSolution);
+        traceSpan.finish();
         // theseCuts) ;
         if (ifSol > 0) {
           // better solution found
@@ -9452,6 +9676,9 @@ bool CbcModel::solveWithCuts(OsiCuts &cuts, int numberTries, CbcNode *node)
           TODO: Any reason why the three loops can't be consolidated?
         */
     const OsiRowCut **addCuts = NULL;
+    // bound gain of round is shared by efficacy among automatic generators
+    double objectiveBefore = direction * solver_->getObjValue();
+    double totalEfficacy = 0.0;
     if (numberRowCuts > 0 || numberColumnCuts > 0) {
       if (numberToAdd > 0) {
         int i;
@@ -9460,6 +9687,19 @@ bool CbcModel::solveWithCuts(OsiCuts &cuts, int numberTries, CbcNode *node)
         addCuts = new const OsiRowCut *[numberToAdd];
         for (i = 0; i < numberToAdd; i++) {
           addCuts[i] = &theseCuts.rowCut(i);
+          int code = whichGenerator[i];
+          int iGenerator = code >= 10000 ? code % 10000 : code;
+          if (code < 20097 && iGenerator < numberCutGenerators_ &&
+              generator_[iGenerator]->automatic()) {
+            double norm = addCuts[i]->row().twoNorm();
+            if (norm > 1.0e-12) {
+              double efficacy =
+                  CoinMax(addCuts[i]->violated(cbcColSolution_), 0.0) / norm;
+              generator_[iGenerator]->setRoundEfficacy(
+                  generator_[iGenerator]->roundEfficacy() + efficacy);
+              totalEfficacy += efficacy;
+            }
+          }
           whichGenerator[i] = 90;
         }
         if ((specialOptions_ & 262144) != 0 && !parentModel_) {
@@ -9495,6 +9735,20 @@ bool CbcModel::solveWithCuts(OsiCuts &cuts, int numberTries, CbcNode *node)
         delete[] addCuts;
         break;
       }
+      if (totalEfficacy > 0.0) {
+        double gain = 0.0;
+        if (feasible)
+          gain = direction * solver_->getObjValue() - objectiveBefore;
+        else if (getCutoff() < 1.0e50)
+          gain = getCutoff() - objectiveBefore;
+        gain = CoinMax(gain, 0.0);
+        for (int i = 0; i < numberCutGenerators_; i++) {
+          double efficacy = generator_[i]->roundEfficacy();
+          if (efficacy > 0.0)
+            generator_[i]->creditRound(gain * efficacy / totalEfficacy,
+                                       !numberNodes_);
+        }
+      }
 #ifdef CBC_DEBUG
       printf("Obj value after cuts %g %d rows\n", solver_->getObjValue(),
              solver_->getNumRows());
@@ -9857,8 +10111,21 @@ bool CbcModel::solveWithCuts(OsiCuts &cuts, int numberTries, CbcNode *node)
       Reduced cost fix at end. Must also check feasible, in case we've popped
     out because a generator indicated we're infeasible.
     */
-  if (feasible && solver_->isProvenOptimal())
+  if (feasible && solver_->isProvenOptimal()) {
     reducedCostFix();
+    // keep reduced costs for global fixing (cuts may be local at nodes)
+    if (globalFixing_.maximumRecords() &&
+        solverCharacteristics_->reducedCostsAccurate())
+      globalFixing_.record(solver_,
+                           numberNodes_ ? numberRowsAtContinuous_
+                                        : solver_->getNumRows(),
+                           numberIntegers_, integerVariable_, !numberNodes_,
+                           getCutoff());
+    // bound from root duals which does not trust rounding
+    if (safeCheck_.active() && !numberNodes_ &&
+        solverCharacteristics_->reducedCostsAccurate())
+      safeCheck_.safeBound(solver_, numberRowsAtContinuous_, getCutoff());
+  }
   // If at root node do heuristics
   if (!numberNodes_ && !maximumSecondsReached()) {
     // First see if any cuts are slack
@@ -9896,7 +10163,9 @@ bool CbcModel::solveWithCuts(OsiCuts &cuts, int numberTries, CbcNode *node)
           continue;
         // see if heuristic will do anything
         double saveValue = heuristicValue;
+        CbcTraceSpan traceSpan(CBC_TRACE_HEURISTIC, heuristic_[i]->heuristicName());
         int ifSol = heuristic_[i]->solution(heuristicValue, newSolution);
+        traceSpan.finish();
         if (ifSol > 0) {
           // better solution found
           heuristic_[i]->incrementNumberSolutionsFound();
@@ -10203,6 +10472,10 @@ bool CbcModel::solveWithCuts(OsiCuts &cuts, int numberTries, CbcNode *node)
       }
       if (eventHandler_) 
         eventHandler_->event(CbcEventHandler::afterRootCuts);
+      if (progressStream_ && !parentModel_)
+        progressStream_->event(this, "root");
+      if (!parentModel_)
+        boundHistory_.addDual(solver_->getObjValue() * solver_->getObjSense());
     }
     /*
           Count the number of cuts produced by each cut generator on this call.
@@ -10265,6 +10538,28 @@ bool CbcModel::solveWithCuts(OsiCuts &cuts, int numberTries, CbcNode *node)
     double smallProblem =
         (0.2 * totalCuts) /
         static_cast<double>(numberActiveGenerators + 1.0e-100);
+    // average bound gain per second of automatic generators
+    double averageRate = 0.0;
+    double rowDensity = 0.0;
+    {
+      double gain = 0.0;
+      double seconds = 0.0;
+      for (i = 0; i < numberCutGenerators_; i++) {
+        if (generator_[i]->automatic()) {
+          if (numberNodes_) {
+            gain += generator_[i]->gainInTree();
+            seconds += generator_[i]->timeInTree();
+          } else {
+            gain += generator_[i]->gainAtRoot();
+            seconds += generator_[i]->timeInCutGenerator();
+          }
+        }
+      }
+      averageRate = gain / CoinMax(seconds, 1.0e-3);
+      if (solver_->getNumRows())
+        rowDensity = static_cast<double>(solver_->getNumElements()) /
+                     solver_->getNumRows();
+    }
     for (i = 0; i < numberCutGenerators_; i++) {
       int howOften = generator_[i]->howOften();
       /*  Probing can be set to just do column cuts in treee.
@@ -10357,10 +10652,19 @@ bool CbcModel::solveWithCuts(OsiCuts &cuts, int numberTries, CbcNode *node)
         }
         continue;
       }
+      /*
+              Automatic generators are scheduled on bound gain per second
+         rather than on numbers of cuts.
+            */
+      bool automatic =
+          generator_[i]->automatic() && !probing && howOften > -99;
+      if (automatic)
+        howOften = generator_[i]->schedule(!numberNodes_, averageRate,
+                                           rowDensity);
       /*
               Adjust, if howOften is adjustable.
             */
-      if (howOften < 0 || howOften >= 1000000) {
+      if (!automatic && (howOften < 0 || howOften >= 1000000)) {
         if (!numberNodes_) {
           /*
                       If root only, or objective improvement but no cuts
@@ -10727,10 +11031,15 @@ int CbcModel::serialCuts(OsiCuts &theseCuts, CbcNode *node, OsiCuts &slackCuts,
   OsiSolverInterface *baseLagrangeanSolver = NULL;
   OsiSolverInterface *cleanLagrangeanSolver = NULL;
 #endif
+  // first row cut from each generator
+  int *generatorStart = new int[numberCutGenerators_ + 1];
+  int numberStarted = 0;
   for (i = 0; i < numberCutGenerators_ && (!this->maximumSecondsReached());
        i++) {
     int numberRowCutsBefore = theseCuts.sizeRowCuts();
     int numberColumnCutsBefore = theseCuts.sizeColCuts();
+    generatorStart[i] = numberRowCutsBefore;
+    numberStarted = i + 1;
     int numberRowCutsAfter = numberRowCutsBefore;
     int numberColumnCutsAfter = numberColumnCutsBefore;
     /*printf("GEN %d %s switches %d\n",
@@ -10952,6 +11261,12 @@ int CbcModel::serialCuts(OsiCuts &theseCuts, CbcNode *node, OsiCuts &slackCuts,
   delete baseLagrangeanSolver;
   delete cleanLagrangeanSolver;
 #endif
+  // generators not started (after any break) have no cuts
+  for (i = numberStarted; i <= numberCutGenerators_; i++)
+    generatorStart[i] = theseCuts.sizeRowCuts();
+  if (status >= 0)
+    selectCuts(theseCuts, generatorStart, lastNumberCuts);
+  delete[] generatorStart;
   if (status >= 0) {
     // delete null cuts
     int nCuts = theseCuts.sizeRowCuts();
@@ -10985,6 +11300,48 @@ int CbcModel::serialCuts(OsiCuts &theseCuts, CbcNode *node, OsiCuts &slackCuts,
   }
   return status;
 }
+// Takes out row cuts rejected by cut selection
+int CbcModel::selectCuts(OsiCuts &theseCuts, const int *generatorStart,
+                         int lastNumberCuts) {
+  // lazy constraints must all go in
+  if (!cutSelection_.maximumCutsAtRoot() ||
+      (moreSpecialOptions2_ & 65536) != 0 ||
+      solverCharacteristics_->solutionAddsCuts())
+    return 0;
+  int numberCuts = theseCuts.sizeRowCuts();
+  int numberCandidates =
+      generatorStart[numberCutGenerators_] - generatorStart[0];
+  if (numberCandidates < 2)
+    return 0;
+  char *reject = new char[numberCuts];
+  int numberRejected = cutSelection_.select(this, theseCuts,
+                                            numberCutGenerators_,
+                                            generatorStart, cbcColSolution_,
+                                            reject);
+  if (numberRejected) {
+    int numberReason[4] = {0, 0, 0, 0};
+    resizeWhichGenerator(lastNumberCuts + numberCuts,
+                         lastNumberCuts + numberCuts);
+    int *whichGenerator = whichGenerator_ + lastNumberCuts;
+    int n = 0;
+    for (int k = 0; k < numberCuts; k++) {
+      numberReason[static_cast<int>(reject[k])]++;
+      if (!reject[k])
+        whichGenerator[n++] = whichGenerator[k];
+    }
+    for (int k = numberCuts - 1; k >= 0; k--) {
+      if (reject[k])
+        theseCuts.eraseRowCut(k);
+    }
+    if (!numberNodes_)
+      handler_->message(CBC_CUT_SELECTION, messages_)
+          << numberCandidates - numberRejected << numberCandidates
+          << numberReason[1] << numberReason[2] << numberReason[3]
+          << CoinMessageEol;
+  }
+  delete[] reject;
+  return numberRejected;
+}
 
 /*
   Remove slack cuts. We obtain a basis and scan it. Cuts with basic slacks
@@ -11229,6 +11586,7 @@ int CbcModel::takeOffCuts(OsiCuts &newCuts, bool allowResolve,
 */
 int CbcModel::resolve(CbcNodeInfo *parent, int whereFrom, double *saveSolution,
                       double *saveLower, double *saveUpper) {
+  CbcTraceSpan traceSpan(CBC_TRACE_NODE_LP, "resolve");
 #ifdef CBC_STATISTICS
   void cbc_resolve_check(const OsiSolverInterface *solver);
   cbc_resolve_check(solver_);
@@ -15077,6 +15435,21 @@ double CbcModel::getBestPossibleObjValue() const {
   return CoinMin(bestPossibleObjective_, bestObjective_) *
          solver_->getObjSense();
 }
+double CbcModel::bestPossibleInTree() const {
+  double value = tree_->getBestPossibleObjective();
+#ifdef CBC_THREAD
+  if (parallelMode() > 0 && master_) {
+    // need to adjust for ones not on tree
+    int numberThreads = master_->numberThreads();
+    for (int i = 0; i < numberThreads; i++) {
+      CbcThread *child = master_->child(i);
+      if (child->node())
+        value = CoinMin(value, child->node()->objectiveValue());
+    }
+  }
+#endif
+  return value;
+}
 // Make given rows (L or G) into global cuts and remove from lp
 void CbcModel::makeGlobalCuts(int number, const int *which) {
   const double *rowLower = solver_->getRowLower();
@@ -15995,6 +16368,7 @@ int CbcModel::chooseBranch(CbcNode *&newNode, int numberPassesLeft,
                            CoinWarmStartBasis *lastws,
                            const double *lowerBefore, const double *upperBefore,
                            OsiSolverBranch *&branches) {
+  CbcTraceSpan traceSpan(CBC_TRACE_STRONG, "chooseBranch");
   // Set state of search
   /*
       0 - outside CbcNode
@@ -16145,6 +16519,8 @@ int CbcModel::chooseBranch(CbcNode *&newNode, int numberPassesLeft,
            diving) &&
           /*!parentModel_*/ (specialOptions_ & 2048) == 0 &&
           !cuts.sizeRowCuts()) {
+        /* not if new cuts - subproblems passed back would have a basis
+           with more rows than the LP they are applied to */
         OsiClpSolverInterface *clpSolver =
             dynamic_cast<OsiClpSolverInterface *>(solver_);
         if (clpSolver) {
@@ -16208,7 +16584,11 @@ int CbcModel::chooseBranch(CbcNode *&newNode, int numberPassesLeft,
           }
         }
       } else if (rootSymmetryInfo_) {
-        int n = rootSymmetryInfo_->orbitalFixing2(solver_);
+        int n;
+        if (rootSymmetryInfo_->numberOrbitopes())
+          n = rootSymmetryInfo_->orbitopalFixing(solver_);
+        else
+          n = rootSymmetryInfo_->orbitalFixing2(solver_);
         if (n) {
 #if PRINT_MORE == 0
           if (logLevel() > 1)
@@ -16770,6 +17150,7 @@ void CbcModel::doHeuristicsAtRoot(int deleteHeuristicsAfterwards) {
               strategy_ = NULL;
               CbcModel *newModel = new CbcModel(*this);
               strategy_ = saveStrategy;
+              newModel->setProgressStream(NULL);
               assert(!newModel->continuousSolver_);
               if (continuousSolver_)
                 newModel->continuousSolver_ = continuousSolver_->clone();
@@ -16843,7 +17224,9 @@ void CbcModel::doHeuristicsAtRoot(int deleteHeuristicsAfterwards) {
             // see if heuristic will do anything
             double saveValue = heuristicValue;
             double before = getCurrentSeconds();
+            CbcTraceSpan traceSpan(CBC_TRACE_HEURISTIC, heuristic_[i]->heuristicName());
             int ifSol = heuristic_[i]->solution(heuristicValue, newSolution);
+            traceSpan.finish();
             if (handler_->logLevel() > 1) {
               char line[100];
               sprintf(line, "Heuristic %s took %g seconds (%s)",
@@ -17453,7 +17836,25 @@ int CbcModel::doOneNode(CbcModel *baseModel, CbcNode *&node,
     phase_ = 2;
     OsiCuts cuts;
     int saveNumber = numberIterations_;
-    if (solverCharacteristics_->solutionAddsCuts()) {
+    // same bounds as a node already solved?
+    bool useCache = nodeCache_.maximumEntries() && nodeCache_.boundsOnly() &&
+                    !solverCharacteristics_->solutionAddsCuts();
+    // global bounds may have been tightened since node was created
+    if (globalFixing_.apply(solver_, getCutoff()) ||
+        (useCache && nodeCache_.lookup(solver_, getCutoff()))) {
+      feasible = false;
+      useCache = false;
+      // this node won't be referencing the cuts
+      lockThread();
+      for (int i = 0; i < currentNumberCuts_; i++) {
+        if (addedCuts_[i]) {
+          if (!addedCuts_[i]->decrement())
+            delete addedCuts_[i];
+          addedCuts_[i] = NULL;
+        }
+      }
+      unlockThread();
+    } else if (solverCharacteristics_->solutionAddsCuts()) {
       int returnCode = resolve(node ? node->nodeInfo() : NULL, 1);
       feasible = returnCode != 0;
       if (feasible) {
@@ -17863,6 +18264,8 @@ int CbcModel::doOneNode(CbcModel *baseModel, CbcNode *&node,
       feasible = solveWithCuts(cuts, maximumCutPasses_, node);
 #endif
     }
+    if (useCache)
+      nodeCache_.store(solver_);
     if ((specialOptions_ & 1) != 0 && onOptimalPath) {
       if (solver_->getRowCutDebuggerAlways()->optimalValue() < getCutoff()) {
         if (!solver_->getRowCutDebugger() || !feasible) {
@@ -18416,7 +18819,9 @@ int CbcModel::doOneNode(CbcModel *baseModel, CbcNode *&node,
             if (!heuristic_[iHeur]->shouldHeurRun(whereFrom))
               continue;
             double saveValue = heurValue;
+            CbcTraceSpan traceSpan(CBC_TRACE_HEURISTIC, heuristic_[iHeur]->heuristicName());
             int ifSol = heuristic_[iHeur]->solution(heurValue, newSolution);
+            traceSpan.finish();
             if (ifSol > 0) {
               // new solution found
               heuristic_[iHeur]->incrementNumberSolutionsFound();
@@ -18633,6 +19038,9 @@ int CbcModel::doOneNode(CbcModel *baseModel, CbcNode *&node,
       baseModel->handler_->message(CBC_ROUNDING, messages_)
           << bestObjective_ << "heuristic" << baseModel->numberIterations_
           << baseModel->numberNodes_ << getCurrentSeconds() << CoinMessageEol;
+      if (baseModel->progressStream_)
+        baseModel->progressStream_->event(baseModel, "incumbent");
+      baseModel->boundHistory_.addPrimal(bestObjective_);
     }
     baseModel->numberSolutions_++;
     unlockThread();
@@ -19013,6 +19421,10 @@ void CbcModel::saveBestSolution(const double *solution, double objectiveValue) {
   else
     bestSolution_ = new double[n];
   bestObjective_ = objectiveValue;
+  if (progressStream_ && !parentModel_)
+    progressStream_->event(this, "incumbent");
+  if (!parentModel_)
+    boundHistory_.addPrimal(objectiveValue);
 #ifdef GET_ALL_SOLUTIONS
   if (dblParam_[CbcCutoffIncrement]==-3333.0) {
     double objValue = 0.0;
@@ -19438,8 +19850,11 @@ bool CbcModel::integerPresolveThisModel(OsiSolverInterface *originalSolver,
           if (!heuristic_[iHeuristic]->shouldHeurRun(whereFrom))
             continue;
           double saveValue = heuristicValue;
+          CbcTraceSpan traceSpan(CBC_TRACE_HEURISTIC,
+                                 heuristic_[iHeuristic]->heuristicName());
           int ifSol =
               heuristic_[iHeuristic]->solution(heuristicValue, newSolution);
+          traceSpan.finish();
           if (ifSol > 0) {
             // better solution found
             heuristic_[iHeuristic]->incrementNumberSolutionsFound();
@@ -20375,6 +20790,7 @@ static void *doRootCbcThread(void *voidInfo)
 {
   rootBundle * bundle = reinterpret_cast< rootBundle *>(voidInfo);
   CbcModel *model = bundle->model;
+  CbcTrace::setCurrent(bundle->trace);
 #ifdef CBC_HAS_CLP
   OsiClpSolverInterface *clpSolver =
       dynamic_cast<OsiClpSolverInterface *>(model->solver());
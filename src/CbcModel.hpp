@@ -16,6 +16,11 @@
 #include "CbcCountRowCut.hpp"
 #include "CbcMessage.hpp"
 #include "CbcEventHandler.hpp"
+#include "CbcBoundHistory.hpp"
+#include "CbcCutSelection.hpp"
+#include "CbcNodeCache.hpp"
+#include "CbcGlobalFixing.hpp"
+#include "CbcSafeCheck.hpp"
 #include "ClpDualRowPivot.hpp"
 #ifndef CBC_OTHER_SOLVER
 #include "OsiClpSolverInterface.hpp"
@@ -40,6 +45,7 @@ class CbcFeasibilityBase;
 class CbcStatistics;
 class CbcFullNodeInfo;
 class CbcEventHandler;
+class CbcProgressStream;
 class CglPreProcess;
 class OsiClpSolverInterface;
 class ClpNodeStuff;
@@ -250,6 +256,12 @@ private:
         -1 - infeasible
     */
   int parallelCuts(CbcBaseModel *master, OsiCuts &cuts, CbcNode *node, OsiCuts &slackCuts, int lastNumberCuts);
+  /** Takes out row cuts rejected by cut selection.
+        Cuts generatorStart[i] to generatorStart[i+1]-1 are from generator i,
+        whichGenerator_ is compacted from lastNumberCuts.
+        Returns number taken out.
+    */
+  int selectCuts(OsiCuts &cuts, const int *generatorStart, int lastNumberCuts);
   /** Input one node output N nodes to put on tree and optional solution update
         This should be able to operate in parallel so is given a solver and is const(ish)
         However we will need to keep an array of solver_ and bases and more
@@ -262,6 +274,9 @@ private:
   void resizeWhichGenerator(int numberNow, int numberAfter);
   /// One last go at cuts
   int oneLastGoAtCuts(OsiCuts &cuts, int typeGo);
+  /** Best possible objective of nodes on tree and being worked on by
+      threads (tree should be locked) */
+  double bestPossibleInTree() const;
 
 public:
 #ifdef CBC_KEEP_DEPRECATED
@@ -2121,6 +2136,175 @@ public:
   {
     return multipleRootTries_;
   }
+  /** Set orbitopal fixing.  If symmetry handling is on and finds
+      packing or partitioning orbitopes (binary matrices whose columns
+      can be permuted freely) then variables are fixed at each node so
+      that columns are in lexicographic order - instead of orbital fixing */
+  inline void setOrbitopalFixing(bool yesNo)
+  {
+    orbitopalFixing_ = yesNo;
+  }
+  /// Get orbitopal fixing
+  inline bool orbitopalFixing() const
+  {
+    return orbitopalFixing_;
+  }
+  /** Set stream for JSON lines of progress (not owned - NULL for none).
+      It is not copied so thread models and sub-models made by
+      heuristics do not write to it. */
+  inline void setProgressStream(CbcProgressStream *stream)
+  {
+    progressStream_ = stream;
+  }
+  /// Get progress stream
+  inline CbcProgressStream *progressStream() const
+  {
+    return progressStream_;
+  }
+  /** Incumbent and best possible over time in last branchAndBound, with
+      primal, dual and primal-dual integrals and time to first solution
+      (computed at end of search) */
+  inline const CbcBoundHistory &boundHistory() const
+  {
+    return boundHistory_;
+  }
+  /** Set maximum number of in-tree restarts (0 switches off).
+      After 50 nodes and at doubling node counts up to 1000 nodes, if an
+      incumbent has improved the cutoff, integers are fixed on reduced cost
+      at the root and bounds fixed globally since (e.g. by probing) are
+      added.  If enough integers are fixed the reduced problem is presolved
+      again and searched instead, keeping incumbent, global cuts and
+      pseudocosts.  The new search may itself restart while the limit
+      allows. */
+  inline void setMaximumRestarts(int value)
+  {
+    maximumRestarts_ = value;
+  }
+  /// Get maximum number of in-tree restarts
+  inline int maximumRestarts() const
+  {
+    return maximumRestarts_;
+  }
+  /** Set fraction of integers which must be fixed to restart (also
+      restarts if a tenth of all columns are fixed) */
+  inline void setRestartFraction(double value)
+  {
+    restartFraction_ = value;
+  }
+  /// Get fraction of integers which must be fixed to restart
+  inline double restartFraction() const
+  {
+    return restartFraction_;
+  }
+  /// Number of in-tree restarts done in last branchAndBound
+  inline int numberRestarts() const
+  {
+    return numberRestarts_;
+  }
+  /// Set number of in-tree restarts (used to pass back from restarted search)
+  inline void setNumberRestarts(int value)
+  {
+    numberRestarts_ = value;
+  }
+  /// Cut selection (limits, parallelism and weights can be changed)
+  inline CbcCutSelection &cutSelection()
+  {
+    return cutSelection_;
+  }
+  inline const CbcCutSelection &cutSelection() const
+  {
+    return cutSelection_;
+  }
+  /** Set whether strong branching keeps hot start after fixing.
+
+      When strong branching finds one way infeasible it fixes the variable.
+      Normally the LP is then resolved and a new hot start is marked (so the
+      factorization is redone).  If keep is true the fixed bound is just left
+      in the solver (and saved bounds) so later candidates are solved from
+      the existing hot start, and there is one resolve after all candidates.
+  */
+  inline void setKeepHotStart(bool keep)
+  {
+    keepHotStart_ = keep;
+  }
+  /// Whether strong branching keeps hot start after fixing
+  inline bool keepHotStart() const
+  {
+    return keepHotStart_;
+  }
+  /// Increment solves from kept hot start and factorizations saved
+  inline void incrementHotStartInfo(int reuses, int saved)
+  {
+    numberHotStartReuses_ += reuses;
+    numberFactorizationsSaved_ += saved;
+  }
+  /// Strong branching solves done from a hot start kept after fixing
+  inline int numberHotStartReuses() const
+  {
+    return numberHotStartReuses_;
+  }
+  /// Hot starts kept (not refactorized) after strong branching fixed a variable
+  inline int numberFactorizationsSaved() const
+  {
+    return numberFactorizationsSaved_;
+  }
+  /** Set reliability branching lookahead.
+
+      If value > 0 strong branching stops after value candidates (which
+      were actually strong branched) have not improved on the best.  It
+      also stops if both ways on the best are at least half way from the
+      node objective to the cutoff.  Candidates whose pseudocosts are not
+      trusted are then ordered by pseudocost score alone.  0 (default)
+      switches this off.
+  */
+  inline void setStrongLookahead(int value)
+  {
+    strongLookahead_ = value;
+  }
+  /// Reliability branching lookahead (0 off)
+  inline int strongLookahead() const
+  {
+    return strongLookahead_;
+  }
+  /// Say strong branching stopped (1 lookahead, 2 bound) with candidates left
+  inline void incrementLookaheadInfo(int why, int numberNotEvaluated)
+  {
+    lookaheadInfo_[why - 1]++;
+    lookaheadInfo_[2] += numberNotEvaluated;
+  }
+  /** Times strong branching stopped on lookahead (0) and on bound (1) and
+      candidates not evaluated (2) */
+  inline const int *lookaheadInfo() const
+  {
+    return lookaheadInfo_;
+  }
+  /// Node cache (setMaximumEntries to switch on)
+  inline CbcNodeCache &nodeCache()
+  {
+    return nodeCache_;
+  }
+  inline const CbcNodeCache &nodeCache() const
+  {
+    return nodeCache_;
+  }
+  /// Global reduced cost fixing (setMaximumRecords to switch on)
+  inline CbcGlobalFixing &globalFixing()
+  {
+    return globalFixing_;
+  }
+  inline const CbcGlobalFixing &globalFixing() const
+  {
+    return globalFixing_;
+  }
+  /// Safe check of final solution and bound (setActive to switch on)
+  inline CbcSafeCheck &safeCheck()
+  {
+    return safeCheck_;
+  }
+  inline const CbcSafeCheck &safeCheck() const
+  {
+    return safeCheck_;
+  }
   /// Tell model to stop on event
   inline void sayEventHappened()
   {
@@ -2719,6 +2903,17 @@ public:
   {
     return fastNodeDepth_;
   }
+  /** Increment fast subtree counts - nodes passed back as subproblems (0)
+      or subtrees dropped as Clp solution did not satisfy SOS etc (1) */
+  inline void incrementFastNodeInfo(int which, int value)
+  {
+    fastNodeInfo_[which] += value;
+  }
+  /// Fast subtree counts (see incrementFastNodeInfo)
+  inline const int *fastNodeInfo() const
+  {
+    return fastNodeInfo_;
+  }
   /// Get anything with priority >= this can be treated as continuous
   inline int continuousPriority() const
   {
@@ -3213,6 +3408,9 @@ private:
   CbcHeuristic *lastHeuristic_;
   /// Depth for fast nodes
   int fastNodeDepth_;
+  /** Fast subtrees - nodes passed back as subproblems (0) and subtrees
+      dropped as Clp solution did not satisfy SOS etc (1) */
+  int fastNodeInfo_[2];
   /*! Pointer to the event handler */
 #ifdef CBC_ONLY_CLP
   ClpEventHandler *eventHandler_;
@@ -3280,6 +3478,37 @@ private:
   unsigned int randomSeed_;
   /// Multiple root tries
   int multipleRootTries_;
+  /// Whether to try orbitopal fixing
+  bool orbitopalFixing_;
+  /// Progress stream (not owned)
+  CbcProgressStream *progressStream_;
+  /// Bounds over time
+  CbcBoundHistory boundHistory_;
+  /// Maximum number of in-tree restarts
+  int maximumRestarts_;
+  /// Fraction of integers fixed to restart
+  double restartFraction_;
+  /// Number of in-tree restarts done
+  int numberRestarts_;
+  /// Chooses which row cuts go into LP
+  CbcCutSelection cutSelection_;
+  /// Whether strong branching keeps hot start after fixing a variable
+  bool keepHotStart_;
+  /// Strong branching solves done from a hot start kept after fixing
+  int numberHotStartReuses_;
+  /// Hot starts not re-marked (so not refactorized) after fixing
+  int numberFactorizationsSaved_;
+  /// Strong branching candidates without improvement before stopping (0 off)
+  int strongLookahead_;
+  /** Strong branching stopped on lookahead (0), on bound (1) and
+      candidates not evaluated (2) */
+  int lookaheadInfo_[3];
+  /// Outcomes of node LPs keyed by bounds
+  CbcNodeCache nodeCache_;
+  /// Reduced costs giving global bounds
+  CbcGlobalFixing globalFixing_;
+  /// Checks of final solution and bound in safe arithmetic
+  CbcSafeCheck safeCheck_;
   /// Current depth
   int currentDepth_;
   /// Thread specific random number generator
@@ -2025,6 +2025,13 @@ int CbcNode::chooseDynamicBranch(CbcModel *model, CbcNode *lastNode,
   int numberUnfinished = 0;
   int numberStrongInfeasible = 0;
   int numberStrongIterations = 0;
+  // fixings which kept hot start and solves done from a kept hot start
+  int numberHotStartKept = 0;
+  int numberHotStartReuses = 0;
+  bool keepHotStart = model->keepHotStart();
+  bool hotStartKept = false;
+  // reliability branching - stop after this many candidates without improvement
+  int strongLookahead = model->strongLookahead();
   int strongType = 0;
 #define DO_ALL_AT_ROOT
 #ifdef DO_ALL_AT_ROOT
@@ -2305,7 +2312,8 @@ int CbcNode::chooseDynamicBranch(CbcModel *model, CbcNode *lastNode,
             }
 #endif
             sort[numberToDo] = -10.0 * infeasibility;
-            if (!(numberThisUp + numberThisDown))
+            // with lookahead order purely by pseudocost score
+            if (!(numberThisUp + numberThisDown) && !strongLookahead)
               sort[numberToDo] *= 100.0; // make even more likely
             if (iColumn < numberColumns) {
               double part = saveSolution[iColumn] - floor(saveSolution[iColumn]);
@@ -2870,6 +2878,7 @@ int CbcNode::chooseDynamicBranch(CbcModel *model, CbcNode *lastNode,
             int save = osiclp->specialOptions();
             osiclp->setSpecialOptions(save | 256);
             solver->markHotStart();
+            hotStartKept = false;
 #ifdef RESET_BOUNDS
             memcpy(saveLower, solver->getColLower(), solver->getNumCols() * sizeof(double));
             memcpy(saveUpper, solver->getColUpper(), solver->getNumCols() * sizeof(double));
@@ -2877,6 +2886,7 @@ int CbcNode::chooseDynamicBranch(CbcModel *model, CbcNode *lastNode,
             osiclp->setSpecialOptions(save);
           } else {
             solver->markHotStart();
+            hotStartKept = false;
 #ifdef RESET_BOUNDS
             memcpy(saveLower, solver->getColLower(), solver->getNumCols() * sizeof(double));
             memcpy(saveUpper, solver->getColUpper(), solver->getNumCols() * sizeof(double));
@@ -2984,6 +2994,7 @@ int CbcNode::chooseDynamicBranch(CbcModel *model, CbcNode *lastNode,
 	      double newObjValue = solver->getObjSense() * solver->getObjValue();
 	      objectiveValue_ = CoinMax(objectiveValue_, newObjValue);
 	      solver->markHotStart();
+	      hotStartKept = false;
 #ifdef RESET_BOUNDS
 	      memcpy(saveLower, solver->getColLower(), solver->getNumCols() * sizeof(double));
 	      memcpy(saveUpper, solver->getColUpper(), solver->getNumCols() * sizeof(double));
@@ -3329,6 +3340,7 @@ int CbcNode::chooseDynamicBranch(CbcModel *model, CbcNode *lastNode,
       for (iDo = 0; iDo < numberToDo; iDo++)
 	info22[iDo].jColumn=-1;
 #endif
+      int numberNoImprovement = 0;
       for (iDo = 0; iDo < numberToDo; iDo++) {
         int iObject = whichObject[iDo];
         OsiObject *object = model->modifiableObject(iObject);
@@ -3398,6 +3410,7 @@ int CbcNode::chooseDynamicBranch(CbcModel *model, CbcNode *lastNode,
             // Mark hot start
             doneHotStart = true;
             solver->markHotStart();
+            hotStartKept = false;
 #ifdef RESET_BOUNDS
             memcpy(saveLower, solver->getColLower(), solver->getNumCols() * sizeof(double));
             memcpy(saveUpper, solver->getColUpper(), solver->getNumCols() * sizeof(double));
@@ -3480,6 +3493,8 @@ int CbcNode::chooseDynamicBranch(CbcModel *model, CbcNode *lastNode,
           }
 #endif
           solver->solveFromHotStart();
+          if (hotStartKept)
+            numberHotStartReuses++;
           if ((model->moreSpecialOptions2() & 32768) != 0 && solver->isProvenOptimal()) {
             // If any small values re-do
             model->cleanBounds(solver, cleanVariables);
@@ -3678,6 +3693,7 @@ int CbcNode::chooseDynamicBranch(CbcModel *model, CbcNode *lastNode,
               cutoff = model->getCutoff();
             }
             solver->markHotStart();
+            hotStartKept = false;
 #ifdef RESET_BOUNDS
             memcpy(saveLower, solver->getColLower(), solver->getNumCols() * sizeof(double));
             memcpy(saveUpper, solver->getColUpper(), solver->getNumCols() * sizeof(double));
@@ -3710,6 +3726,8 @@ int CbcNode::chooseDynamicBranch(CbcModel *model, CbcNode *lastNode,
 	  }
 #endif
           solver->solveFromHotStart();
+          if (hotStartKept)
+            numberHotStartReuses++;
 #ifdef CBC_HAS_CLP
           if (osiclp && goToEndInStrongBranching) {
             osiclp->setIntParam(OsiMaxNumIterationHotStart, saveMaxHotIts);
@@ -3931,6 +3949,7 @@ int CbcNode::chooseDynamicBranch(CbcModel *model, CbcNode *lastNode,
               cutoff = model->getCutoff();
             }
             solver->markHotStart();
+            hotStartKept = false;
 #ifdef RESET_BOUNDS
             memcpy(saveLower, solver->getColLower(), solver->getNumCols() * sizeof(double));
             memcpy(saveUpper, solver->getColUpper(), solver->getNumCols() * sizeof(double));
@@ -4042,7 +4061,24 @@ int CbcNode::chooseDynamicBranch(CbcModel *model, CbcNode *lastNode,
                 ws = NULL;
                 break;
               }
+              if (strongLookahead && !canSkip) {
+                numberNoImprovement = 0;
+                // no point going on if smaller change is half way to cutoff
+                double gap = model->getCutoff() - objectiveValue_;
+                if (CoinMin(choice.upMovement, choice.downMovement) >= 0.5 * gap) {
+                  model->incrementLookaheadInfo(2, numberToDo - iDo - 1);
+                  break;
+                }
+              }
             } else {
+              if (strongLookahead && !canSkip && ++numberNoImprovement >= strongLookahead) {
+                if (!choiceObject) {
+                  delete choice.possibleBranch;
+                  choice.possibleBranch = NULL;
+                }
+                model->incrementLookaheadInfo(1, numberToDo - iDo - 1);
+                break; // best not changed for a while
+              }
               if (!choiceObject) {
                 delete choice.possibleBranch;
                 choice.possibleBranch = NULL;
@@ -4098,30 +4134,37 @@ int CbcNode::chooseDynamicBranch(CbcModel *model, CbcNode *lastNode,
               choice.possibleBranch = choiceObject;
             }
             assert(doneHotStart);
-            solver->unmarkHotStart();
-            model->resolve(NULL, 11, saveSolution, saveLower, saveUpper);
+            bool goneInfeasible = false;
+            if (keepHotStart) {
+              // fix is in bounds so snapshot still usable - resolve after loop
+              numberHotStartKept++;
+              hotStartKept = true;
+            } else {
+              solver->unmarkHotStart();
+              model->resolve(NULL, 11, saveSolution, saveLower, saveUpper);
 #ifdef CHECK_DEBUGGER_PATH
-            if ((model->specialOptions() & 1) != 0 && onOptimalPath) {
-              const OsiRowCutDebugger *debugger = solver->getRowCutDebugger();
-              if (!debugger) {
-                printf("Strong branching down on %d went off optimal path\n", iObject);
-                abort();
+              if ((model->specialOptions() & 1) != 0 && onOptimalPath) {
+                const OsiRowCutDebugger *debugger = solver->getRowCutDebugger();
+                if (!debugger) {
+                  printf("Strong branching down on %d went off optimal path\n", iObject);
+                  abort();
+                }
               }
-            }
 #endif
-            double newObjValue = solver->getObjSense() * solver->getObjValue();
-            objectiveValue_ = CoinMax(objectiveValue_, newObjValue);
-            bool goneInfeasible = (!solver->isProvenOptimal() || solver->isDualObjectiveLimitReached());
-            solver->markHotStart();
+              double newObjValue = solver->getObjSense() * solver->getObjValue();
+              objectiveValue_ = CoinMax(objectiveValue_, newObjValue);
+              goneInfeasible = (!solver->isProvenOptimal() || solver->isDualObjectiveLimitReached());
+              solver->markHotStart();
 #ifdef RESET_BOUNDS
-            memcpy(saveLower, solver->getColLower(), solver->getNumCols() * sizeof(double));
-            memcpy(saveUpper, solver->getColUpper(), solver->getNumCols() * sizeof(double));
+              memcpy(saveLower, solver->getColLower(), solver->getNumCols() * sizeof(double));
+              memcpy(saveUpper, solver->getColUpper(), solver->getNumCols() * sizeof(double));
 #endif
-            if (!solver->isProvenOptimal()) {
-              skipAll = -2;
-              canSkip = 1;
+              if (!solver->isProvenOptimal()) {
+                skipAll = -2;
+                canSkip = 1;
+              }
+              xMark++;
             }
-            xMark++;
             // may be infeasible (if other way stopped on iterations)
             if (goneInfeasible) {
               // neither side feasible
@@ -4173,31 +4216,38 @@ int CbcNode::chooseDynamicBranch(CbcModel *model, CbcNode *lastNode,
               choice.possibleBranch = choiceObject;
             }
             assert(doneHotStart);
-            solver->unmarkHotStart();
-            model->resolve(NULL, 11, saveSolution, saveLower, saveUpper);
+            bool goneInfeasible = false;
+            if (keepHotStart) {
+              // fix is in bounds so snapshot still usable - resolve after loop
+              numberHotStartKept++;
+              hotStartKept = true;
+            } else {
+              solver->unmarkHotStart();
+              model->resolve(NULL, 11, saveSolution, saveLower, saveUpper);
 #ifdef CHECK_DEBUGGER_PATH
-            if ((model->specialOptions() & 1) != 0 && onOptimalPath) {
-              const OsiRowCutDebugger *debugger = solver->getRowCutDebugger();
-              if (!debugger) {
-                printf("Strong branching down on %d went off optimal path\n", iObject);
-                solver->writeMps("query");
-                abort();
+              if ((model->specialOptions() & 1) != 0 && onOptimalPath) {
+                const OsiRowCutDebugger *debugger = solver->getRowCutDebugger();
+                if (!debugger) {
+                  printf("Strong branching down on %d went off optimal path\n", iObject);
+                  solver->writeMps("query");
+                  abort();
+                }
               }
-            }
 #endif
-            double newObjValue = solver->getObjSense() * solver->getObjValue();
-            objectiveValue_ = CoinMax(objectiveValue_, newObjValue);
-            bool goneInfeasible = (!solver->isProvenOptimal() || solver->isDualObjectiveLimitReached());
-            solver->markHotStart();
+              double newObjValue = solver->getObjSense() * solver->getObjValue();
+              objectiveValue_ = CoinMax(objectiveValue_, newObjValue);
+              goneInfeasible = (!solver->isProvenOptimal() || solver->isDualObjectiveLimitReached());
+              solver->markHotStart();
 #ifdef RESET_BOUNDS
-            memcpy(saveLower, solver->getColLower(), solver->getNumCols() * sizeof(double));
-            memcpy(saveUpper, solver->getColUpper(), solver->getNumCols() * sizeof(double));
+              memcpy(saveLower, solver->getColLower(), solver->getNumCols() * sizeof(double));
+              memcpy(saveUpper, solver->getColUpper(), solver->getNumCols() * sizeof(double));
 #endif
-            if (!solver->isProvenOptimal()) {
-              skipAll = -2;
-              canSkip = 1;
+              if (!solver->isProvenOptimal()) {
+                skipAll = -2;
+                canSkip = 1;
+              }
+              xMark++;
             }
-            xMark++;
             // may be infeasible (if other way stopped on iterations)
             if (goneInfeasible) {
               // neither side feasible
@@ -4277,8 +4327,8 @@ int CbcNode::chooseDynamicBranch(CbcModel *model, CbcNode *lastNode,
       }
       solver->setIntParam(OsiMaxNumIterationHotStart, saveLimit);
       // Unless infeasible we will carry on
-      // But we could fix anyway
-      if (numberToFix && !hitMaxTime) {
+      // But we could fix anyway (must if hot start was kept after fixing)
+      if (numberToFix && (!hitMaxTime || numberHotStartKept)) {
         if (anyAction != -2) {
           // apply and take off
           bool feasible = true;
@@ -4498,6 +4548,7 @@ int CbcNode::chooseDynamicBranch(CbcModel *model, CbcNode *lastNode,
   // update number of strong iterations etc
   model->incrementStrongInfo(numberStrongDone, numberStrongIterations,
     anyAction == -2 ? 0 : numberToFix, anyAction == -2);
+  model->incrementHotStartInfo(numberHotStartReuses, numberHotStartKept);
   if (model->searchStrategy() == -1) {
 #ifndef COIN_DEVELOP
     if (solver->messageHandler()->logLevel() > 1)
@@ -6597,6 +6648,8 @@ int CbcNode::chooseClpBranch(CbcModel *model,
   ClpSimplex *simplex = clpSolver->getModelPtr();
   int preferredWay;
   double infeasibility = object->infeasibility(&usefulInfo, preferredWay);
+  // true if Clp solution does not satisfy SOS or other objects
+  bool rejected = false;
   if (thisOne->whichSolution() >= 0) {
     ClpNode *nodeInfo = NULL;
     if ((model->moreSpecialOptions() & 33554432) == 0) {
@@ -6649,16 +6702,25 @@ int CbcNode::chooseClpBranch(CbcModel *model,
             }
           }
         }
-        simplex->writeMps("bad8.mps", 2);
-        bool gotSol = model->feasibleSolution(numInf, numInf2);
-        if (!gotSol)
+        gotSol = model->feasibleSolution(numInf, numInf2);
+        if (numInf2) {
+          /* Clp only branches on integers so may have pruned against this
+             value - drop whole subtree and branch on node in usual way */
+          rejected = true;
+        } else if (!gotSol) {
+          simplex->writeMps("bad8.mps", 2);
           assert(gotSol);
+          // never store an infeasible point
+          rejected = true;
+        }
+      }
+      if (!rejected) {
+        model->setBestSolution(CBC_STRONGSOL,
+          newObjectiveValue,
+          solver->getColSolution());
+        model->setLastHeuristic(NULL);
+        model->incrementUsed(solver->getColSolution());
       }
-      model->setBestSolution(CBC_STRONGSOL,
-        newObjectiveValue,
-        solver->getColSolution());
-      model->setLastHeuristic(NULL);
-      model->incrementUsed(solver->getColSolution());
     }
   }
   // restore bounds
@@ -6673,6 +6735,14 @@ int CbcNode::chooseClpBranch(CbcModel *model,
   // restore basis
   solver->setWarmStart(ws);
   delete ws;
+  if (rejected) {
+    // get back node solution
+    solver->resolve();
+    model->incrementFastNodeInfo(1, 1);
+    // not worth it if most subtrees are dropped
+    if (model->fastNodeInfo()[1] >= 10 && 2 * model->fastNodeInfo()[1] > model->getFathomCount())
+      model->setFastNodeDepth(-1);
+  }
   int anyAction;
   //#define CHECK_PATH
 #ifdef CHECK_PATH
@@ -6680,7 +6750,9 @@ int CbcNode::chooseClpBranch(CbcModel *model,
   if (gotGoodNode_Z >= 0)
     printf("good node %d %g\n", gotGoodNode_Z, infeasibility);
 #endif
-  if (infeasibility > 0.0) {
+  if (rejected) {
+    anyAction = -1;
+  } else if (infeasibility > 0.0) {
     if (infeasibility == COIN_DBL_MAX) {
       anyAction = -2; // infeasible
     } else {
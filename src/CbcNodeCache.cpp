@@ -0,0 +1,218 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#pragma warning(disable : 4786)
+#endif
+
+#include "CbcConfig.h"
+
+#include <cstring>
+
+#include "CoinFinite.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinWarmStartBasis.hpp"
+#include "OsiSolverInterface.hpp"
+#include "CbcNodeCache.hpp"
+
+namespace {
+// Bit pattern of double (so -0.0 and 0.0 differ but that does not matter)
+inline CoinUInt64 bits(double value)
+{
+  CoinUInt64 result;
+  memcpy(&result, &value, sizeof(double));
+  return result;
+}
+// Mixes value into hash
+inline CoinUInt64 mix(CoinUInt64 hash, CoinUInt64 value, CoinUInt64 multiplier)
+{
+  hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+  hash *= multiplier;
+  return hash ^ (hash >> 29);
+}
+}
+
+CbcNodeCache::CbcNodeCache()
+  : key1_(NULL)
+  , key2_(NULL)
+  , bound_(NULL)
+  , basis_(NULL)
+  , lastKey1_(0)
+  , lastKey2_(0)
+  , maximumEntries_(0)
+  , boundsOnly_(false)
+  , numberHits_(0)
+  , numberMisses_(0)
+  , numberPruned_(0)
+  , numberWarmStarts_(0)
+{
+}
+
+CbcNodeCache::CbcNodeCache(const CbcNodeCache &rhs)
+  : key1_(NULL)
+  , key2_(NULL)
+  , bound_(NULL)
+  , basis_(NULL)
+{
+  gutsOfCopy(rhs);
+}
+
+CbcNodeCache &
+CbcNodeCache::operator=(const CbcNodeCache &rhs)
+{
+  if (this != &rhs) {
+    gutsOfDelete();
+    gutsOfCopy(rhs);
+  }
+  return *this;
+}
+
+CbcNodeCache::~CbcNodeCache()
+{
+  gutsOfDelete();
+}
+
+void CbcNodeCache::gutsOfDelete()
+{
+  if (basis_) {
+    for (int i = 0; i < maximumEntries_; i++)
+      delete basis_[i];
+  }
+  delete[] key1_;
+  delete[] key2_;
+  delete[] bound_;
+  delete[] basis_;
+  key1_ = NULL;
+  key2_ = NULL;
+  bound_ = NULL;
+  basis_ = NULL;
+}
+
+void CbcNodeCache::gutsOfCopy(const CbcNodeCache &rhs)
+{
+  maximumEntries_ = rhs.maximumEntries_;
+  boundsOnly_ = rhs.boundsOnly_;
+  lastKey1_ = rhs.lastKey1_;
+  lastKey2_ = rhs.lastKey2_;
+  numberHits_ = rhs.numberHits_;
+  numberMisses_ = rhs.numberMisses_;
+  numberPruned_ = rhs.numberPruned_;
+  numberWarmStarts_ = rhs.numberWarmStarts_;
+  if (rhs.key1_) {
+    key1_ = CoinCopyOfArray(rhs.key1_, maximumEntries_);
+    key2_ = CoinCopyOfArray(rhs.key2_, maximumEntries_);
+    bound_ = CoinCopyOfArray(rhs.bound_, maximumEntries_);
+    basis_ = new CoinWarmStartBasis *[maximumEntries_];
+    for (int i = 0; i < maximumEntries_; i++)
+      basis_[i] = rhs.basis_[i] ? new CoinWarmStartBasis(*rhs.basis_[i]) : NULL;
+  }
+}
+
+void CbcNodeCache::setMaximumEntries(int value)
+{
+  gutsOfDelete();
+  maximumEntries_ = CoinMax(value, 0);
+  lastKey1_ = 0;
+}
+
+void CbcNodeCache::clear()
+{
+  if (basis_) {
+    for (int i = 0; i < maximumEntries_; i++) {
+      delete basis_[i];
+      basis_[i] = NULL;
+    }
+    memset(key1_, 0, maximumEntries_ * sizeof(CoinUInt64));
+  }
+  lastKey1_ = 0;
+  numberHits_ = 0;
+  numberMisses_ = 0;
+  numberPruned_ = 0;
+  numberWarmStarts_ = 0;
+}
+
+int CbcNodeCache::lookup(OsiSolverInterface *solver, double cutoff)
+{
+  lastKey1_ = 0;
+  if (!maximumEntries_ || !boundsOnly_)
+    return 0;
+  if (!key1_) {
+    key1_ = new CoinUInt64[maximumEntries_];
+    key2_ = new CoinUInt64[maximumEntries_];
+    bound_ = new double[maximumEntries_];
+    basis_ = new CoinWarmStartBasis *[maximumEntries_];
+    memset(key1_, 0, maximumEntries_ * sizeof(CoinUInt64));
+    memset(basis_, 0, maximumEntries_ * sizeof(CoinWarmStartBasis *));
+  }
+  int numberColumns = solver->getNumCols();
+  const double *lower = solver->getColLower();
+  const double *upper = solver->getColUpper();
+  CoinUInt64 key1 = 0xcbf29ce484222325ULL;
+  CoinUInt64 key2 = static_cast< CoinUInt64 >(numberColumns);
+  for (int i = 0; i < numberColumns; i++) {
+    CoinUInt64 lowerBits = bits(lower[i]);
+    CoinUInt64 upperBits = bits(upper[i]);
+    key1 = mix(key1, lowerBits ^ (upperBits << 1), 0xff51afd7ed558ccdULL);
+    key2 = mix(key2, upperBits ^ (lowerBits << 3), 0xc4ceb9fe1a85ec53ULL);
+  }
+  // 0 means empty
+  lastKey1_ = key1 | 1;
+  lastKey2_ = key2;
+  int slot = static_cast< int >(lastKey1_ % static_cast< CoinUInt64 >(maximumEntries_));
+  if (key1_[slot] != lastKey1_ || key2_[slot] != lastKey2_) {
+    numberMisses_++;
+    return 0;
+  }
+  numberHits_++;
+  if (bound_[slot] >= cutoff) {
+    numberPruned_++;
+    return 1;
+  }
+  if (basis_[slot] && basis_[slot]->getNumArtificial() == solver->getNumRows()) {
+    solver->setWarmStart(basis_[slot]);
+    numberWarmStarts_++;
+  }
+  return 0;
+}
+
+void CbcNodeCache::store(const OsiSolverInterface *solver)
+{
+  if (!lastKey1_)
+    return;
+  double bound;
+  if (solver->isProvenOptimal() || solver->isDualObjectiveLimitReached()) {
+    bound = solver->getObjSense() * solver->getObjValue();
+  } else if (solver->isProvenPrimalInfeasible()) {
+    bound = COIN_DBL_MAX;
+  } else {
+    // abandoned or stopped - outcome not known
+    lastKey1_ = 0;
+    return;
+  }
+  int slot = static_cast< int >(lastKey1_ % static_cast< CoinUInt64 >(maximumEntries_));
+  key1_[slot] = lastKey1_;
+  key2_[slot] = lastKey2_;
+  bound_[slot] = bound;
+  delete basis_[slot];
+  basis_[slot] = NULL;
+  if (solver->isProvenOptimal()) {
+    CoinWarmStart *ws = solver->getWarmStart();
+    basis_[slot] = dynamic_cast< CoinWarmStartBasis * >(ws);
+    if (!basis_[slot])
+      delete ws;
+  }
+  lastKey1_ = 0;
+}
+
+void CbcNodeCache::addStatistics(const CbcNodeCache &rhs)
+{
+  numberHits_ += rhs.numberHits_;
+  numberMisses_ += rhs.numberMisses_;
+  numberPruned_ += rhs.numberPruned_;
+  numberWarmStarts_ += rhs.numberWarmStarts_;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
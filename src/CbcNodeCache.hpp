@@ -0,0 +1,144 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+/*! \file CbcNodeCache.hpp
+    \brief Cache of node LP outcomes keyed by bounds.
+*/
+
+#ifndef CbcNodeCache_H
+#define CbcNodeCache_H
+
+#include "CoinTypes.hpp"
+#include "CbcConfig.h"
+
+class OsiSolverInterface;
+class CoinWarmStartBasis;
+
+/** Node cache.
+
+    A node is defined by its column bounds, whatever order the branches
+    which led to it were taken in.  Before the LP of a node is solved a
+    key is computed from all the column bounds (two independent 64 bit
+    hashes so a false match is not a practical worry) and looked up.
+    After the solve the outcome - infeasible or the objective bound and
+    the final basis - is stored under that key.
+
+    Cuts in the LP of a node are valid for all integer solutions within
+    its bounds so if a later node has the same bounds it can be pruned if
+    the stored bound is now at or above the cutoff, and otherwise its LP
+    can be started from the stored basis (if the row count matches).  This
+    happens when branching objects do not partition (some general integer,
+    SOS and user branching) and when nodes are re-created.
+
+    That is only true if branching changes bounds alone - a branch which
+    adds a row (e.g. CbcBranchCut) gives nodes with the same bounds but
+    different LPs.  So the cache is only used if setBoundsOnly(true) has
+    been called, which CbcModel does when every object is of a kind known
+    to branch on bounds.  Only proven outcomes are stored - an LP which was
+    abandoned or stopped on iterations is not.
+
+    The table is direct mapped and a new entry replaces whatever was in
+    its slot, so memory is bounded by maximumEntries.
+*/
+
+class CBCLIB_EXPORT CbcNodeCache {
+public:
+  /// Default Constructor (off)
+  CbcNodeCache();
+
+  /// Copy constructor
+  CbcNodeCache(const CbcNodeCache &rhs);
+
+  /// Assignment
+  CbcNodeCache &operator=(const CbcNodeCache &rhs);
+
+  /// Destructor
+  ~CbcNodeCache();
+
+  /// Set maximum entries (0 switches off) - clears cache
+  void setMaximumEntries(int value);
+  /// Maximum entries (0 off)
+  inline int maximumEntries() const
+  {
+    return maximumEntries_;
+  }
+  /// Empties cache and zeroes statistics (e.g. at start of search)
+  void clear();
+  /// Say whether all branching is on bounds (cache not used if not)
+  inline void setBoundsOnly(bool yesNo)
+  {
+    boundsOnly_ = yesNo;
+  }
+  /// Whether all branching is on bounds
+  inline bool boundsOnly() const
+  {
+    return boundsOnly_;
+  }
+
+  /** Computes key for bounds in solver and looks it up.  Returns 1 if node
+      can be pruned (stored bound >= cutoff), 0 if not (always 0 unless
+      boundsOnly).  If not pruned and a basis with the same number of rows
+      is stored it is put in solver. */
+  int lookup(OsiSolverInterface *solver, double cutoff);
+  /** Stores outcome of LP in solver for key computed by last lookup.  The
+      bound is the objective if optimal or over the dual limit and
+      COIN_DBL_MAX if proven infeasible; nothing is stored otherwise (e.g.
+      abandoned or iteration limit).  Basis is kept if optimal. */
+  void store(const OsiSolverInterface *solver);
+
+  /// Add in statistics from another cache (e.g. thread)
+  void addStatistics(const CbcNodeCache &rhs);
+  /// Number of lookups which found an entry
+  inline int numberHits() const
+  {
+    return numberHits_;
+  }
+  /// Number of lookups which did not
+  inline int numberMisses() const
+  {
+    return numberMisses_;
+  }
+  /// Number of nodes pruned
+  inline int numberPruned() const
+  {
+    return numberPruned_;
+  }
+  /// Number of nodes started from stored basis
+  inline int numberWarmStarts() const
+  {
+    return numberWarmStarts_;
+  }
+
+private:
+  /// Free entries
+  void gutsOfDelete();
+  /// Copy entries
+  void gutsOfCopy(const CbcNodeCache &rhs);
+
+  /// First half of key of each entry (0 if empty)
+  CoinUInt64 *key1_;
+  /// Second half of key of each entry
+  CoinUInt64 *key2_;
+  /// Objective bound (COIN_DBL_MAX if infeasible)
+  double *bound_;
+  /// Basis at end of solve (may be NULL)
+  CoinWarmStartBasis **basis_;
+  /// Key of last lookup
+  CoinUInt64 lastKey1_;
+  CoinUInt64 lastKey2_;
+  /// Maximum entries
+  int maximumEntries_;
+  /// Whether all branching is on bounds
+  bool boundsOnly_;
+  /// Statistics
+  int numberHits_;
+  int numberMisses_;
+  int numberPruned_;
+  int numberWarmStarts_;
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -59,6 +59,8 @@ public:
       // Action Parameters
       FIRSTACTIONPARAM,
       BAB,
+      BATCH,
+      BENCHCOMPARE,
       DEBUG,
       ENVIRONMENT,
       END,
@@ -76,6 +78,7 @@ public:
       READSOL,
       READMODEL,
       READMODEL_OLD, // For backward compatibility
+      SERVE,
       SHOWUNIMP,
       SOLVECONTINUOUS,
       STATISTICS,
@@ -96,6 +99,8 @@ public:
       
       // File Parameters
       FIRSTFILEPARAM,
+      BATCHRESULTSFILE,
+      BENCHRESULTSFILE,
       CSVSTATSFILE,
       DEBUGFILE,
       EXPORTFILE,
@@ -105,8 +110,10 @@ public:
       MODELFILE,
       NEXTSOLFILE,
       PRIORITYFILE,
+      PROGRESSFILE,
       SOLUTIONFILE,
       SOLUTIONBINARYFILE,
+      TRACEFILE,
       LASTFILEPARAM,
 
       // Directory Paramaters
@@ -177,8 +184,10 @@ public:
       CPX,
       DOHEURISTIC,
       ERRORSALLOWED,
+      KEEPHOTSTART,
       MESSAGES,
       PREPROCNAMES,
+      SAFECHECK,
       SOS,
       USESOLUTION,
       LASTBOOLPARAM,
@@ -189,6 +198,7 @@ public:
       CLQSTRENGTHENING,
       BRANCHPRIORITY,
       CUTOFFCONSTRAINT,
+      CUTSCHEDULE,
       INTPRINT,
       NODESTRATEGY,
       ORBITAL,
@@ -201,6 +211,7 @@ public:
       
       // Integer Parameters
       FIRSTINTPARAM,
+      BATCHWORKERS,
       BKPIVOTINGSTRATEGY,
       BKMAXCALLS,
       BKCLQEXTMETHOD,
@@ -221,19 +232,24 @@ public:
       FPUMPITS,
       FPUMPTUNE,
       FPUMPTUNE2,
+      GLOBALFIXING,
       HEUROPTIONS,
       LOGLEVEL,
       LPLOGLEVEL,
+      MAXCUTSROUND,
       MAXHOTITS,
+      MAXRESTARTS,
       MAXSAVEDSOLS,
       MAXSLOWCUTS,
       MOREMOREMIPOPTIONS,
       MULTIPLEROOTS,
+      NODECACHE,
       ODDWEXTMETHOD,
       OUTPUTFORMAT,
       PRINTOPTIONS,
       PROCESSTUNE,
       RANDOMSEED,
+      STRONGLOOKAHEAD,
       STRONGSTRATEGY,
       TESTOSI,
       THREADS,
@@ -245,12 +261,16 @@ public:
       // Double Parameters
       FIRSTDBLPARAM,
       ARTIFICIALCOST,
+      CUTEFFICACY,
+      CUTPARALLEL,
       DEXTRA3,
       DEXTRA4,
       DEXTRA5,
       DJFIX,
       FAKECUTOFF,
       FAKEINCREMENT,
+      PROGRESSINTERVAL,
+      RESTARTFRACTION,
       SMALLBAB,
       TIGHTENFACTOR,
       LASTDBLPARAM,
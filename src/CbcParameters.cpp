@@ -349,6 +349,8 @@ void CbcParameters::setDefaults(int strategy) {
       getParam(code)->setDefault(dfltDirectory_);
   }
 
+  parameters_[CbcParam::BATCHRESULTSFILE]->setDefault(std::string("batch.csv"));
+  parameters_[CbcParam::BENCHRESULTSFILE]->setDefault("");
   parameters_[CbcParam::DEBUGFILE]->setDefault("");
   parameters_[CbcParam::CSVSTATSFILE]->setDefault(std::string("stats.csv"));
   parameters_[CbcParam::EXPORTFILE]->setDefault(std::string("export.mps"));
@@ -359,8 +361,10 @@ void CbcParameters::setDefaults(int strategy) {
   parameters_[CbcParam::NEXTSOLFILE]->setDefault(std::string("next.sol"));
   parameters_[CbcParam::PRINTMASK]->setDefault("");
   parameters_[CbcParam::PRIORITYFILE]->setDefault(std::string("priorities.txt"));
+  parameters_[CbcParam::PROGRESSFILE]->setDefault("");
   parameters_[CbcParam::SOLUTIONFILE]->setDefault(std::string("opt.sol"));
   parameters_[CbcParam::SOLUTIONBINARYFILE]->setDefault(std::string("solution.file"));
+  parameters_[CbcParam::TRACEFILE]->setDefault("");
   parameters_[CbcParam::COMMANDPRINTLEVEL]->setDefault("more");
 
   // Now set up  parameters according to overall strategies
@@ -369,6 +373,7 @@ void CbcParameters::setDefaults(int strategy) {
      parameters_[CbcParam::CLQSTRENGTHENING]->setDefault("after");
      parameters_[CbcParam::BRANCHPRIORITY]->setDefault("off");
      parameters_[CbcParam::CUTOFFCONSTRAINT]->setDefault("off");
+     parameters_[CbcParam::CUTSCHEDULE]->setDefault("fixed");
      parameters_[CbcParam::INTPRINT]->setDefault("normal");
      parameters_[CbcParam::NODESTRATEGY]->setDefault("hybrid");
      parameters_[CbcParam::ORBITAL]->setDefault("off");
@@ -378,14 +383,19 @@ void CbcParameters::setDefaults(int strategy) {
      parameters_[CbcParam::TIMEMODE]->setDefault("cpu");
      parameters_[CbcParam::USECGRAPH]->setDefault("on");
      parameters_[CbcParam::ARTIFICIALCOST]->setDefault(getArtVarThreshold());
+     parameters_[CbcParam::CUTEFFICACY]->setDefault(1.0e-6);
+     parameters_[CbcParam::CUTPARALLEL]->setDefault(0.98);
      parameters_[CbcParam::DEXTRA3]->setDefault(0.0);
      parameters_[CbcParam::DEXTRA4]->setDefault(0.0);
      parameters_[CbcParam::DEXTRA5]->setDefault(0.0);
      parameters_[CbcParam::DJFIX]->setDefault(getDjFixThreshold());
      parameters_[CbcParam::FAKECUTOFF]->setDefault(0.0);
      parameters_[CbcParam::FAKEINCREMENT]->setDefault(0.0);
+     parameters_[CbcParam::PROGRESSINTERVAL]->setDefault(5.0);
+     parameters_[CbcParam::RESTARTFRACTION]->setDefault(0.25);
      parameters_[CbcParam::SMALLBAB]->setDefault(0.5);
      parameters_[CbcParam::TIGHTENFACTOR]->setDefault(0.0);
+     parameters_[CbcParam::BATCHWORKERS]->setDefault(1);
      parameters_[CbcParam::BKPIVOTINGSTRATEGY]->setDefault(3);
      parameters_[CbcParam::BKMAXCALLS]->setDefault(1000);
      parameters_[CbcParam::BKCLQEXTMETHOD]->setDefault(4);
@@ -406,19 +416,24 @@ void CbcParameters::setDefaults(int strategy) {
      parameters_[CbcParam::FPUMPITS]->setDefault(getFeasPumpIters());
      parameters_[CbcParam::FPUMPTUNE]->setDefault(0);
      parameters_[CbcParam::FPUMPTUNE2]->setDefault(0);
+     parameters_[CbcParam::GLOBALFIXING]->setDefault(0);
      parameters_[CbcParam::HEUROPTIONS]->setDefault(0);
      parameters_[CbcParam::LOGLEVEL]->setDefault(getLogLevel());
      parameters_[CbcParam::LPLOGLEVEL]->setDefault(getLpLogLevel());
+     parameters_[CbcParam::MAXCUTSROUND]->setDefault(2000);
      parameters_[CbcParam::MAXHOTITS]->setDefault(0);
+     parameters_[CbcParam::MAXRESTARTS]->setDefault(1);
      parameters_[CbcParam::MAXSAVEDSOLS]->setDefault(1);
      parameters_[CbcParam::MAXSLOWCUTS]->setDefault(10);
      parameters_[CbcParam::MOREMOREMIPOPTIONS]->setDefault(0);
      parameters_[CbcParam::MULTIPLEROOTS]->setDefault(0);
+     parameters_[CbcParam::NODECACHE]->setDefault(0);
      parameters_[CbcParam::ODDWEXTMETHOD]->setDefault(2);
      parameters_[CbcParam::OUTPUTFORMAT]->setDefault(2);
      parameters_[CbcParam::PRINTOPTIONS]->setDefault(0);
      parameters_[CbcParam::PROCESSTUNE]->setDefault(0);
      parameters_[CbcParam::RANDOMSEED]->setDefault(-1);
+     parameters_[CbcParam::STRONGLOOKAHEAD]->setDefault(0);
      parameters_[CbcParam::STRONGSTRATEGY]->setDefault(0);
      parameters_[CbcParam::TESTOSI]->setDefault(-1);
 #ifdef CBC_THREAD
@@ -430,8 +445,10 @@ void CbcParameters::setDefaults(int strategy) {
      parameters_[CbcParam::CPX]->setDefault("off");
      parameters_[CbcParam::DOHEURISTIC]->setDefault("off");
      parameters_[CbcParam::ERRORSALLOWED]->setDefault("off");
+     parameters_[CbcParam::KEEPHOTSTART]->setDefault("off");
      parameters_[CbcParam::MESSAGES]->setDefault("off");
      parameters_[CbcParam::PREPROCNAMES]->setDefault("off");
+     parameters_[CbcParam::SAFECHECK]->setDefault("off");
      parameters_[CbcParam::SOS]->setDefault("off");
      parameters_[CbcParam::USESOLUTION]->setDefault("off");
      parameters_[CbcParam::CUTSTRATEGY]->setDefault("off");
@@ -719,6 +736,44 @@ void CbcParameters::addCbcSolverActionParams() {
       CoinParam::displayPriorityHigh);
   parameters_[CbcParam::BAB]->setPushFunc(CbcParamUtils::doBaCParam);
 
+  parameters_[CbcParam::BATCH]->setup(
+      "batch", "Solve many models, one after another",
+      "This reads a list of model files (one per line, '#' starts a comment) "
+      "or, if given a directory, takes every .mps, .lp or .cbcb file in it, "
+      "and solves each model.  All commands after the file name are applied "
+      "to every model (e.g. -batch list.txt -sec 10 -cuts off) and are not "
+      "otherwise obeyed.  Models are shared between 'batchWorkers' workers, "
+      "each of which sets up its model and parameters once and reuses them. "
+      "One line per model (status, objective, bound, seconds and nodes) is "
+      "written to the file set by 'batchResults' and throughput is reported "
+      "at the end.",
+      CoinParam::displayPriorityHigh);
+
+  parameters_[CbcParam::BENCHCOMPARE]->setup(
+      "benchC!ompare", "Compare benchmark results against a baseline",
+      "This reads the baseline file given and the file set by "
+      "'benchResults' (both written by miplib or unitTest) and, for runs "
+      "with the same model, seed and threads, prints time, node, iteration "
+      "and primal integral ratios and their shifted geometric means.  Runs "
+      "which lose optimality or a solution, change the optimum or take more "
+      "than 10% longer are flagged as regressions, as is a 10% increase in "
+      "the shifted geometric mean of time.  Returns the number of "
+      "regressions as exit code.",
+      CoinParam::displayPriorityLow);
+
+  parameters_[CbcParam::SERVE]->setup(
+      "serve", "Serve solve requests on a Unix-domain socket",
+      "This creates a socket with the given name and solves models sent to "
+      "it until a client asks it to shut down.  A request is a line "
+      "'solve <bytes> <format> [commands]' followed by the model, where "
+      "format is mps, mps.gz, lp or cbcb; progress and result lines are "
+      "sent back and 'cancel' stops a running solve.  All commands after "
+      "the socket name are applied to every model before those in the "
+      "request.  'batchWorkers' models are solved at once, each worker "
+      "setting up its model and parameters only once.  Needs cbc built "
+      "with threads on a POSIX system.",
+      CoinParam::displayPriorityLow);
+
   parameters_[CbcParam::DEBUG]->setup(
       "debug!In", "Read/write valid solution from/to file", 
       "This will read a solution file from the given file name.  It will use "
@@ -771,7 +826,10 @@ void CbcParameters::addCbcSolverActionParams() {
       "previous value for the name.  This is initialized to 'default.mps'. It "
       "can be useful to get rid of the original names and go over to using "
       "Rnnnnnnn and Cnnnnnnn.  This can be done by setting 'keepnames' off "
-      "before importing mps file.",
+      "before importing mps file.  If the file name ends in '.cbcb' the "
+      "model is written in Cbc native binary format (with priorities and "
+      "any incumbent as MIP start) and, if preprocessing is set to save, "
+      "the preprocessed model is also saved in binary format.",
       CoinParam::displayPriorityHigh);
 
   parameters_[CbcParam::IMPORT]->setup(
@@ -780,7 +838,8 @@ void CbcParameters::addCbcSolverActionParams() {
       "use the default directory given by 'directory'.  A name of '$' will use "
       "the previous value for the name.  This is initialized to '', i.e., it "
       "must be set.  If you have libgz then it can read compressed files "
-      "'xxxxxxxx.gz'.",
+      "'xxxxxxxx.gz'.  Files ending in '.cbcb' are in Cbc native binary "
+      "format (see export) and are mapped into memory rather than parsed.",
       CoinParam::displayPriorityHigh);
   parameters_[CbcParam::IMPORT]->setPushFunc(CbcParamUtils::doImportParam);
 
@@ -829,8 +888,12 @@ void CbcParameters::addCbcSolverActionParams() {
       "feasible solution. \n\n Silly options added.  If filename ends .low "
       "then integers not mentioned are set low - also .high, .lowcheap, "
       ".highcheap, .lowexpensive, .highexpensive where .lowexpensive sets "
-      "costed ones to make expensive others low. Also if filename starts "
-      "empty. then no file is read at all - just actions done. \n\n Question "
+      "costed ones to make expensive others low. If filename ends .partial "
+      "then integers not mentioned are left free and a small branch and bound "
+      "tries to complete the solution. Also if filename starts "
+      "empty. then no file is read at all - just actions done. A compact "
+      "binary mipstart can be written with writeSolution to a file ending "
+      ".mipb and is recognized when read. \n\n Question "
       "and suggestions regarding MIPStart can be directed to\n "
       "haroldo.santos@gmail.com. ");
 
@@ -1028,6 +1091,22 @@ void CbcParameters::addCbcSolverFileParams() {
     getParam(code)->setType(CoinParam::paramFile);
   }
 
+  parameters_[CbcParam::BATCHRESULTSFILE]->setup(
+      "batchR!esults", "sets name of file for batch results",
+      "The batch command writes a CSV file with one line per model to this "
+      "file. This is initialized to 'batch.csv'.",
+      CoinParam::displayPriorityLow);
+
+  parameters_[CbcParam::BENCHRESULTSFILE]->setup(
+      "benchR!esults", "sets name of file for benchmark results",
+      "If set, miplib and unitTest append a CSV line for each model solved "
+      "(status, seed, threads, objective, wall and cpu seconds, nodes, "
+      "iterations, root bound, primal and dual integrals, time to first "
+      "solution and peak memory) to this "
+      "file.  Fix randomCbcSeed and threads so runs can be compared with "
+      "benchCompare.  This is initialized to '', i.e. nothing is written.",
+      CoinParam::displayPriorityLow);
+
   parameters_[CbcParam::CSVSTATSFILE]->setup(
       "csv!Statistics", "sets file name for writing out statistics",
       "This appends statistics to given file name.  If name is not "
@@ -1096,6 +1175,17 @@ void CbcParameters::addCbcSolverFileParams() {
       "direction, up, down, solution.  Exactly one of name and number must be "
       "given.");
 
+  parameters_[CbcParam::PROGRESSFILE]->setup(
+      "progressF!ile", "sets name of file for JSON lines of progress",
+      "If set, branch and bound appends one JSON object per line to this "
+      "file at start, each root cut pass, end of root, each new solution, "
+      "improvement in bound, restart and end, and every 'progressInterval' "
+      "seconds.  Each line has nodes, open nodes, iterations, objective, "
+      "bound, gap and memory; periodic lines also have counters for cut "
+      "generators, heuristics and threads.  "
+      "This is initialized to '', i.e. no progress file.",
+      CoinParam::displayPriorityLow);
+
   parameters_[CbcParam::SOLUTIONBINARYFILE]->setup(
       "solBinaryF!ile",
       "sets name for file to store solution in binary format",
@@ -1109,6 +1199,16 @@ void CbcParameters::addCbcSolverFileParams() {
       "By default, solutions are written to 'opt.sol'. To print to stdout, "
       "use printSolution.", CoinParam::displayPriorityHigh);
 
+  parameters_[CbcParam::TRACEFILE]->setup(
+      "traceF!ile", "sets name of file for timeline of search",
+      "If set, spans for node LP solves, cut generators, heuristics, "
+      "choice of branch, restoring nodes, waiting for locks (threaded) and "
+      "tree operations are recorded during branch and bound and written "
+      "to this file in Chrome trace format (load into chrome://tracing or "
+      "ui.perfetto.dev).  Each thread keeps its latest million or so spans. "
+      "This is initialized to '', i.e. no trace.",
+      CoinParam::displayPriorityLow);
+
 }
 
 //###########################################################################
@@ -1188,6 +1288,17 @@ void CbcParameters::addCbcSolverKwdParams() {
   parameters_[CbcParam::CUTOFFCONSTRAINT]->appendKwd("forcevariable", CbcParameters::COForceVariable);
   parameters_[CbcParam::CUTOFFCONSTRAINT]->appendKwd("conflict", CbcParameters::COConflict);
 
+  parameters_[CbcParam::CUTSCHEDULE]->setup(
+      "cutSched!ule", "How frequency of cut generators is decided",
+      "With fixed the frequency of a generator which is on or ifmove is "
+      "decided from the number of cuts it generates at root.  With auto "
+      "each such generator is measured by bound improvement per second "
+      "against the others, at root and then every so often in the tree, "
+      "and its frequency and depth set from that.  The decisions are "
+      "printed at the end of the run.");
+  parameters_[CbcParam::CUTSCHEDULE]->appendKwd("fixed", CbcParameters::CSFixed);
+  parameters_[CbcParam::CUTSCHEDULE]->appendKwd("auto", CbcParameters::CSAuto);
+
   parameters_[CbcParam::INTPRINT]->setup(
       "printi!ngOptions", "Print options", 
       "This changes the amount and format of printing a solution:\n normal - "
@@ -1237,7 +1348,12 @@ void CbcParameters::addCbcSolverKwdParams() {
       "This switches on Orbital branching. Value 'on' just adds orbital, "
       "'strong' tries extra fixing in strong branching."
       "'cuts' just adds global cuts to break symmetry."
-      "'lightweight' is as on where computation seems cheap");
+      "'lightweight' is as on where computation seems cheap.  "
+      "'orbitope' is as on but where symmetry permutes columns of a 0-1 "
+      "matrix with at most one nonzero in each row (e.g. bins or shifts) "
+      "variables are fixed so columns are in lexicographic order.  If Cbc was "
+      "built without nauty its own symmetry search is used and this is off "
+      "by default.");
   parameters_[CbcParam::ORBITAL]->appendKwd("off", CbcParameters::OBOff);
   parameters_[CbcParam::ORBITAL]->appendKwd("slowish", CbcParameters::OBSlowish);
   parameters_[CbcParam::ORBITAL]->appendKwd("strong", CbcParameters::OBStrong);
@@ -1248,6 +1364,7 @@ void CbcParameters::addCbcSolverKwdParams() {
   parameters_[CbcParam::ORBITAL]->appendKwd("moreprinting", CbcParameters::OBMorePrinting);  
   parameters_[CbcParam::ORBITAL]->appendKwd("cuts", CbcParameters::OBCuts);
   parameters_[CbcParam::ORBITAL]->appendKwd("cutslight", CbcParameters::OBCutsLight);
+  parameters_[CbcParam::ORBITAL]->appendKwd("orbitope", CbcParameters::OBOrbitope);
 
   parameters_[CbcParam::PREPROCESS]->setup(
       "preprocess", "Whether to use integer preprocessing", 
@@ -1333,6 +1450,22 @@ void CbcParameters::addCbcSolverDblParams() {
       "Costs >= this treated as artificials in feasibility pump", 0.0,
       COIN_DBL_MAX, "", CoinParam::displayPriorityLow);
 
+  parameters_[CbcParam::CUTEFFICACY]->setup(
+      "cutEff!icacy", "Minimum efficacy of a cut added to LP", 0.0,
+      COIN_DBL_MAX,
+      "Efficacy is the distance a cut moves off the LP solution (violation "
+      "divided by norm).  Cuts with less are not added to the LP (see "
+      "maxCutsRound).",
+      CoinParam::displayPriorityLow);
+
+  parameters_[CbcParam::CUTPARALLEL]->setup(
+      "cutPar!allelism", "Maximum parallelism between cuts added to LP",
+      0.0, 1.0,
+      "A cut is not added to the LP if the cosine of the angle between it and "
+      "a better cut of the same round is more than this (see maxCutsRound). "
+      "1.0 allows parallel cuts.",
+      CoinParam::displayPriorityLow);
+
   parameters_[CbcParam::DEXTRA3]->setup(
       "dextra3", "Extra double parameter 3", -COIN_DBL_MAX, COIN_DBL_MAX,
       "", CoinParam::displayPriorityNone);
@@ -1366,6 +1499,25 @@ void CbcParameters::addCbcSolverDblParams() {
       "below this value in feasibility pump",
       CoinParam::displayPriorityLow);
 
+  parameters_[CbcParam::PROGRESSINTERVAL]->setup(
+      "progressI!nterval", "Seconds between lines in progress file", 0.0,
+      COIN_DBL_MAX,
+      "See progressFile.  Lines for events such as new solutions are written "
+      "whenever they happen.",
+      CoinParam::displayPriorityLow);
+
+  parameters_[CbcParam::RESTARTFRACTION]->setup(
+      "restartF!raction", "Fraction of integers fixed to restart search",
+      0.0, 1.0,
+      "Early in the search (after 50 nodes and at doubling node counts up to "
+      "1000 nodes) once a better solution has been found, integers are fixed "
+      "on reduced cost at the root and any fixed globally in the tree are "
+      "added. If at least this fraction of the integers (or a tenth of all "
+      "columns) is then fixed, the reduced problem is preprocessed again and "
+      "searched instead, keeping solution, global cuts and pseudocosts. See "
+      "also maxRestarts.",
+      CoinParam::displayPriorityLow);
+
   parameters_[CbcParam::SMALLBAB]->setup(
       "fraction!forBAB", "Fraction in feasibility pump", 1.0e-5, 1.1,
       "After a pass in the feasibility pump, variables which have not moved "
@@ -1391,6 +1543,14 @@ void CbcParameters::addCbcSolverIntParams() {
     getParam(code)->setPushFunc(CbcParamUtils::pushCbcSolverIntParam);
   }
 
+  parameters_[CbcParam::BATCHWORKERS]->setup(
+      "batchW!orkers", "Number of models solved at once by batch", 1, 1000,
+      "Each batch worker is a separate process (where the system has fork) "
+      "and solves one model at a time.  Also used by serve.  For many small "
+      "models it is usually best to set this to the number of cpus and leave "
+      "threads at 0.",
+      CoinParam::displayPriorityLow);
+
   parameters_[CbcParam::BKPIVOTINGSTRATEGY]->setup(
       "bkpivot!ing", "Pivoting strategy used in Bron-Kerbosch algorithm", 0, 6);
 
@@ -1536,6 +1696,16 @@ void CbcParameters::addCbcSolverIntParams() {
       "fix if value of variable same for last n iterations.",
       CoinParam::displayPriorityNone);
 
+  parameters_[CbcParam::GLOBALFIXING]->setup(
+      "globalFix!ing", "Number of LPs kept for global reduced cost fixing",
+      0, COIN_INT_MAX,
+      "If positive the reduced costs of the root LP and of up to this number "
+      "less one node LPs are kept as bounds valid in the whole tree.  When "
+      "the cutoff improves they are used to tighten global bounds, which "
+      "nodes pick up when they are next selected (or are pruned if the "
+      "bounds conflict).  0 switches off.",
+      CoinParam::displayPriorityLow);
+
   parameters_[CbcParam::HEUROPTIONS]->setup(
       "hOp!tions", "Heuristic options", -COIN_INT_MAX, COIN_INT_MAX,
       "Value 1 stops heuristics immediately if the allowable gap has been "
@@ -1557,10 +1727,26 @@ void CbcParameters::addCbcSolverIntParams() {
       "value of 1 is probably the best value for most uses, while 2 and 3 give "
       "more information.");
 
+  parameters_[CbcParam::MAXCUTSROUND]->setup(
+      "maxCutsR!ound", "Maximum cuts added to LP in a round at root", 0,
+      COIN_INT_MAX,
+      "Cuts from a round are scored on efficacy, parallelism to objective, "
+      "integer support and sparsity and added best first, skipping weak "
+      "cuts and cuts nearly parallel to one already added, up to this "
+      "number at the root and a tenth of it in the tree.  0 adds all cuts.",
+      CoinParam::displayPriorityLow);
+
   parameters_[CbcParam::MAXHOTITS]->setup(
       "hot!StartMaxIts", "Maximum iterations on hot start",
       0, COIN_INT_MAX);
 
+  parameters_[CbcParam::MAXRESTARTS]->setup(
+      "maxRestart!s", "Maximum number of restarts in search", 0, 100,
+      "Search may be restarted on a smaller problem when many integers "
+      "have been fixed (see restartFraction).  This limits how many times; "
+      "0 switches restarts off.",
+      CoinParam::displayPriorityLow);
+
   parameters_[CbcParam::MAXSAVEDSOLS]->setup(
       "maxSaved!Solutions", "Maximum number of solutions to save", 0,
       COIN_INT_MAX, "Number of solutions to save.");
@@ -1597,6 +1783,16 @@ void CbcParameters::addCbcSolverIntParams() {
       "Fischetti, Michele Monaci, Domenico Salvagnin, and Andrea Tramontani.",
       CoinParam::displayPriorityHigh);
 
+  parameters_[CbcParam::NODECACHE]->setup(
+      "nodeC!ache", "Size of cache of node outcomes keyed by bounds", 0,
+      COIN_INT_MAX,
+      "If positive the outcome of each node LP (infeasible or bound and "
+      "basis) is kept in a table of this size keyed by the node's bounds.  "
+      "A later node with the same bounds, whatever order they were imposed "
+      "in, is pruned if the stored bound is now above the cutoff and "
+      "otherwise starts from the stored basis.  0 switches off.",
+      CoinParam::displayPriorityLow);
+
   parameters_[CbcParam::ODDWEXTMETHOD]->setup(
       "oddwext!method",
       "Strategy used to search for wheel centers for the cuts found by Odd "
@@ -1646,6 +1842,16 @@ void CbcParameters::addCbcSolverIntParams() {
       "up or down. The special value of 0 lets Cbc use the time of the day for "
       "the initial seed.");
 
+  parameters_[CbcParam::STRONGLOOKAHEAD]->setup(
+      "strongL!ookahead", "Stop strong branching when best does not improve",
+      0, COIN_INT_MAX,
+      "Reliability branching with lookahead.  If this is positive strong "
+      "branching at a node stops after this many candidates in a row have "
+      "not improved on the best, or when both ways on the best are half way "
+      "to the cutoff.  Untrusted candidates are then ordered by pseudocost "
+      "score only.  Numbers of early stops are printed at the end.",
+      CoinParam::displayPriorityLow);
+
   parameters_[CbcParam::STRONGSTRATEGY]->setup(
       "expensive!Strong", "Whether to do even more strong branching", 0,
       COIN_INT_MAX,
@@ -1729,6 +1935,15 @@ void CbcParameters::addCbcSolverBoolParams() {
       "from which the code can not recover, e.g., no ENDATA.  This has to be "
       "set before import, i.e., -errorsAllowed on -import xxxxxx.mps.");
 
+  parameters_[CbcParam::KEEPHOTSTART]->setup(
+      "keepH!otStart", "Whether strong branching keeps hot start after fixing",
+      "When strong branching finds one way infeasible the variable is fixed "
+      "and normally the LP is resolved and refactorized before going on to "
+      "the next candidate.  If this is on the fixing is left in the bounds "
+      "and the remaining candidates are solved from the existing hot start, "
+      "with one resolve at the end.  Numbers of factorizations saved are "
+      "printed at the end of branch and bound.");
+
   parameters_[CbcParam::MESSAGES]->setup(
       "mess!ages", "Controls whether standardised message prefix is printed",
       "By default, messages have a standard prefix, such as:\n   Cbc0005 2261  "
@@ -1743,6 +1958,17 @@ void CbcParameters::addCbcSolverBoolParams() {
       "C0000... Setting this option to on keeps original names in variables "
       "which still exist in the preprocessed problem");
 
+  parameters_[CbcParam::SAFECHECK]->setup(
+      "safeC!heck", "Whether to check final solution and bound safely",
+      "If this is on the best solution is checked after postsolve using "
+      "arithmetic which bounds all rounding errors, so it is either proven "
+      "to satisfy the rows and bounds of the original problem or the largest "
+      "possible violation is printed.  A lower bound (upper for maximization) "
+      "is also found from the duals of the root LP in the same way and "
+      "printed next to the bound found by the search.  As reduced cost fixing "
+      "uses the cutoff, that bound only holds for solutions better than the "
+      "cutoff printed with it.");
+
   parameters_[CbcParam::SOS]->setup(
       "sos!Options", "Whether to use SOS from AMPL",
       "Normally if AMPL says there are SOS variables they should be used, but "
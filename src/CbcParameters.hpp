@@ -199,6 +199,7 @@ public:
     - OBMorePrinting:
     - OBCuts:
     - OBCutsLight:
+    - OBOrbitope: as OBOn but use orbitopal fixing on any orbitopes found
     - OBEndMarker
    */
 
@@ -213,6 +214,7 @@ public:
     OBMorePrinting,
     OBCuts,
     OBCutsLight,
+    OBOrbitope,
     OBEndMarker
   };
 
@@ -368,6 +370,14 @@ public:
     COEndMarker
   };
 
+  /*! \brief Codes to specify how cut generator frequency is decided
+
+      - CSFixed: from howOften and cut counts
+      - CSAuto: adjustable generators from bound gain per second
+   */
+
+  enum CutScheduleMode { CSFixed = 0, CSAuto, CSEndMarker };
+
   /*! \brief Codes to specify the assignment of branching priorities
 
       - HeurOff:
@@ -0,0 +1,285 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#pragma warning(disable : 4786)
+#endif
+
+#include "CbcConfig.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#if defined(__linux__)
+#include <unistd.h>
+#elif !defined(_MSC_VER)
+#include <sys/resource.h>
+#endif
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinTime.hpp"
+#include "CbcModel.hpp"
+#include "CbcTree.hpp"
+#include "CbcNode.hpp"
+#include "CbcCutGenerator.hpp"
+#include "CbcHeuristic.hpp"
+#include "CbcThread.hpp"
+#include "CbcProgressStream.hpp"
+
+namespace {
+// Resident memory in megabytes (0.0 if not known)
+double memoryUsed()
+{
+#if defined(__linux__)
+  double value = 0.0;
+  FILE *fp = fopen("/proc/self/statm", "r");
+  if (fp) {
+    long size, resident;
+    if (fscanf(fp, "%ld %ld", &size, &resident) == 2)
+      value = static_cast< double >(resident) * sysconf(_SC_PAGESIZE) / 1048576.0;
+    fclose(fp);
+  }
+  return value;
+#elif !defined(_MSC_VER)
+  // peak rather than current
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage))
+    return 0.0;
+#if defined(__APPLE__)
+  return usage.ru_maxrss / 1048576.0;
+#else
+  return usage.ru_maxrss / 1024.0;
+#endif
+#else
+  return 0.0;
+#endif
+}
+
+// Adds ,"name":value (null if not finite or huge)
+void addNumber(std::string &line, const char *name, double value)
+{
+  char temp[80];
+  if (value == value && fabs(value) < 1.0e50)
+    sprintf(temp, ",\"%s\":%.10g", name, value);
+  else
+    sprintf(temp, ",\"%s\":null", name);
+  line += temp;
+}
+
+void addInteger(std::string &line, const char *name, long long value)
+{
+  char temp[80];
+  sprintf(temp, ",\"%s\":%lld", name, value);
+  line += temp;
+}
+
+// Adds "name":"value" escaping value
+void addString(std::string &line, const char *name, const char *value)
+{
+  line += "\"";
+  line += name;
+  line += "\":\"";
+  for (const char *c = value; *c; c++) {
+    if (*c == '"' || *c == '\\') {
+      line += '\\';
+      line += *c;
+    } else if (static_cast< unsigned char >(*c) >= 32) {
+      line += *c;
+    }
+  }
+  line += "\"";
+}
+}
+
+CbcProgressStream::CbcProgressStream()
+  : fp_(NULL)
+  , callback_(NULL)
+  , userData_(NULL)
+  , interval_(5.0)
+  , nextProgress_(0.0)
+  , nextCheck_(0.0)
+  , bound_(-COIN_DBL_MAX)
+{
+#ifdef CBC_THREAD
+  pthread_mutex_init(&mutex_, NULL);
+#endif
+}
+
+CbcProgressStream::~CbcProgressStream()
+{
+  if (fp_)
+    fclose(fp_);
+#ifdef CBC_THREAD
+  pthread_mutex_destroy(&mutex_);
+#endif
+}
+
+int CbcProgressStream::open(const char *fileName)
+{
+  if (fp_)
+    fclose(fp_);
+  callback_ = NULL;
+  fp_ = fopen(fileName, "a");
+  return fp_ ? 0 : 1;
+}
+
+void CbcProgressStream::setCallback(Callback callback, void *userData)
+{
+  if (fp_)
+    fclose(fp_);
+  fp_ = NULL;
+  callback_ = callback;
+  userData_ = userData;
+}
+
+void CbcProgressStream::reset()
+{
+  double now = CoinGetTimeOfDay();
+  nextProgress_ = now + interval_;
+  nextCheck_ = now + CoinMin(interval_, 1.0);
+  bound_ = -COIN_DBL_MAX;
+}
+
+bool CbcProgressStream::due() const
+{
+  return CoinGetTimeOfDay() >= nextCheck_;
+}
+
+double CbcProgressStream::treeBound(CbcModel *model) const
+{
+  CbcTree *tree = model->tree();
+  if (!tree || !tree->size())
+    return bound_;
+  double bound = tree->getBestPossibleObjective();
+#ifdef CBC_THREAD
+  if (model->parallelMode() > 0 && model->master()) {
+    // need to adjust for ones not on tree
+    CbcBaseModel *master = model->master();
+    int numberThreads = master->numberThreads();
+    for (int i = 0; i < numberThreads; i++) {
+      CbcNode *node = master->child(i)->node();
+      if (node)
+        bound = CoinMin(bound, node->objectiveValue());
+    }
+  }
+#endif
+  return bound;
+}
+
+void CbcProgressStream::check(CbcModel *model)
+{
+  double now = CoinGetTimeOfDay();
+  nextCheck_ = now + CoinMin(interval_, 1.0);
+  double bound = treeBound(model);
+  double tolerance = 1.0e-7 * CoinMax(1.0, fabs(bound));
+  if (bound > bound_ + tolerance && bound < 1.0e50) {
+    bound_ = bound;
+    event(model, "bound");
+  }
+  if (now >= nextProgress_) {
+    nextProgress_ = now + interval_;
+    event(model, "progress");
+  }
+}
+
+void CbcProgressStream::event(CbcModel *model, const char *type,
+  const char *extra)
+{
+  if (!fp_ && !callback_)
+    return;
+  std::string line = "{";
+  addString(line, "event", type);
+  addNumber(line, "time", model->getCurrentSeconds());
+  addInteger(line, "nodes", model->getNodeCount());
+  addInteger(line, "open", model->tree() ? model->tree()->size() : 0);
+  addInteger(line, "iterations", model->getIterationCount());
+  addInteger(line, "solutions", model->getSolutionCount());
+  double direction = model->getObjSense();
+  // internal values are for minimization
+  double objective = model->bestSolution() ? model->getObjValue() * direction
+                                           : COIN_DBL_MAX;
+  double bound = CoinMax(bound_, model->getBestPossibleObjValue() * direction);
+  if (objective < bound)
+    bound = objective;
+  if (objective < 1.0e50) {
+    addNumber(line, "objective", objective * direction);
+  } else {
+    addNumber(line, "objective", COIN_DBL_MAX);
+  }
+  addNumber(line, "bound", bound > -1.0e50 ? bound * direction : -COIN_DBL_MAX);
+  if (objective < 1.0e50 && bound > -1.0e50) {
+    double largest = CoinMax(fabs(objective), fabs(bound));
+    addNumber(line, "gap", largest > 1.0e-10 ? (objective - bound) / largest : 0.0);
+  } else {
+    addNumber(line, "gap", COIN_DBL_MAX);
+  }
+  addNumber(line, "memory", memoryUsed());
+  if (extra) {
+    line += ",";
+    line += extra;
+  }
+  if (!strcmp(type, "progress") || !strcmp(type, "end")) {
+    char temp[200];
+    line += ",\"cuts\":[";
+    for (int i = 0; i < model->numberCutGenerators(); i++) {
+      CbcCutGenerator *generator = model->cutGenerator(i);
+      line += i ? ",{" : "{";
+      addString(line, "name", generator->cutGeneratorName());
+      sprintf(temp, ",\"calls\":%d,\"cuts\":%d,\"active\":%d,\"time\":%.4g}",
+        generator->numberTimesEntered(), generator->numberCutsInTotal(),
+        generator->numberCutsActive(), generator->timeInCutGenerator());
+      line += temp;
+    }
+    line += "],\"heuristics\":[";
+    for (int i = 0; i < model->numberHeuristics(); i++) {
+      CbcHeuristic *heuristic = model->heuristic(i);
+      line += i ? ",{" : "{";
+      addString(line, "name", heuristic->heuristicName());
+      sprintf(temp, ",\"runs\":%d,\"couldRun\":%d,\"solutions\":%d}",
+        heuristic->numRuns(), heuristic->numCouldRun(),
+        heuristic->numberSolutionsFound());
+      line += temp;
+    }
+    line += "]";
+#ifdef CBC_THREAD
+    if (model->master()) {
+      CbcBaseModel *master = model->master();
+      int numberThreads = master->numberThreads();
+      line += ",\"threads\":[";
+      for (int i = 0; i < numberThreads; i++) {
+        CbcThread *child = master->child(i);
+        sprintf(temp, "%s{\"busy\":%s,\"time\":%.4g,\"waitStart\":%.4g,"
+                      "\"locked\":%.4g,\"waitLock\":%.4g}",
+          i ? "," : "", child->node() ? "true" : "false",
+          child->timeInThread(), child->timeWaitingToStart(),
+          child->timeLocked(), child->timeWaitingToLock());
+        line += temp;
+      }
+      line += "]";
+    }
+#endif
+  }
+  line += "}";
+  output(line);
+}
+
+void CbcProgressStream::output(const std::string &line)
+{
+#ifdef CBC_THREAD
+  pthread_mutex_lock(&mutex_);
+#endif
+  if (callback_) {
+    callback_(line.c_str(), userData_);
+  } else if (fp_) {
+    fprintf(fp_, "%s\n", line.c_str());
+    fflush(fp_);
+  }
+#ifdef CBC_THREAD
+  pthread_mutex_unlock(&mutex_);
+#endif
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
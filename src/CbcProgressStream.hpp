@@ -0,0 +1,114 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+/*! \file CbcProgressStream.hpp
+    \brief Machine readable progress of branch and bound as JSON lines.
+*/
+
+#ifndef CbcProgressStream_H
+#define CbcProgressStream_H
+
+#include <cstdio>
+#include <string>
+
+#include "CbcConfig.h"
+#ifdef CBC_THREAD
+#include <pthread.h>
+#endif
+
+class CbcModel;
+
+/** Progress stream.
+
+    Writes one JSON object per line, either to a file or to a callback,
+    for these events -
+      - "start" - start of branch and bound
+      - "rootCuts" - start of each cut pass at root (pass, rows, tightCuts, lp)
+      - "root" - root node finished
+      - "incumbent" - new best solution
+      - "bound" - best possible objective improved (checked at most once
+        a second)
+      - "restart" - search restarted after fixing variables
+      - "progress" - every interval seconds
+      - "end" - end of search
+
+    Every line has event, time, nodes, open, iterations, solutions,
+    objective, bound, gap and memory (resident megabytes).  "progress" and
+    "end" also have counters for each cut generator and heuristic and, in
+    threaded search, how busy each thread has been.  Objective, bound and
+    gap are null if not known.
+
+    A model given a stream (CbcModel::setProgressStream) does not own it.
+    Lines are written whole under a lock so threads may share a stream.
+*/
+
+class CBCLIB_EXPORT CbcProgressStream {
+public:
+  /// Callback gets each line (without newline)
+  typedef void (*Callback)(const char *line, void *userData);
+
+  /// Default Constructor - goes nowhere until open or setCallback
+  CbcProgressStream();
+  /// Destructor (closes file)
+  ~CbcProgressStream();
+
+  /// Writes to file (appends).  Returns 0 if OK, 1 if could not open
+  int open(const char *fileName);
+  /// Writes to callback instead of file
+  void setCallback(Callback callback, void *userData);
+  /// Seconds between progress lines
+  inline double interval() const
+  {
+    return interval_;
+  }
+  inline void setInterval(double value)
+  {
+    interval_ = value;
+  }
+
+  /// Get ready for new search (nothing written)
+  void reset();
+  /// True if worth calling check (one time test)
+  bool due() const;
+  /** Called from node loop when due - writes "bound" if bound improved
+      and "progress" if interval passed.  Should be called with model
+      locked in threaded search. */
+  void check(CbcModel *model);
+  /** Writes line for event.  extra (if given) is more JSON fields
+      without leading comma e.g. "\"pass\":3". */
+  void event(CbcModel *model, const char *type, const char *extra = NULL);
+
+private:
+  /// Not allowed
+  CbcProgressStream(const CbcProgressStream &);
+  CbcProgressStream &operator=(const CbcProgressStream &);
+  /// Best possible objective from tree (and threads)
+  double treeBound(CbcModel *model) const;
+  /// Writes line
+  void output(const std::string &line);
+
+  /// File (if not callback)
+  FILE *fp_;
+  /// Callback
+  Callback callback_;
+  /// Data for callback
+  void *userData_;
+  /// Seconds between progress lines
+  double interval_;
+  /// Wall clock time of next progress line
+  double nextProgress_;
+  /// Wall clock time of next bound check
+  double nextCheck_;
+  /// Best bound found (minimization)
+  double bound_;
+#ifdef CBC_THREAD
+  /// So lines from threads do not mix
+  pthread_mutex_t mutex_;
+#endif
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
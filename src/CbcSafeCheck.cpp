@@ -0,0 +1,267 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#pragma warning(disable : 4786)
+#endif
+
+#include "CbcConfig.h"
+
+#include <cmath>
+#include <vector>
+
+#include "CoinFinite.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CoinTime.hpp"
+#include "OsiSolverInterface.hpp"
+#include "CbcSafeCheck.hpp"
+
+namespace {
+// Next double towards minus or plus infinity
+inline double down(double value)
+{
+  return nextafter(value, -COIN_DBL_MAX);
+}
+inline double up(double value)
+{
+  return nextafter(value, COIN_DBL_MAX);
+}
+// a+b rounded down - exact error from two sum
+inline double addDown(double a, double b)
+{
+  double sum = a + b;
+  if (!CoinFinite(sum))
+    return (sum > 0.0) ? COIN_DBL_MAX : sum;
+  double bb = sum - a;
+  double error = (a - (sum - bb)) + (b - bb);
+  return (error < 0.0) ? down(sum) : sum;
+}
+// a+b rounded up
+inline double addUp(double a, double b)
+{
+  double sum = a + b;
+  if (!CoinFinite(sum))
+    return (sum < 0.0) ? -COIN_DBL_MAX : sum;
+  double bb = sum - a;
+  double error = (a - (sum - bb)) + (b - bb);
+  return (error > 0.0) ? up(sum) : sum;
+}
+// a*b rounded down - exact error from fused multiply add
+inline double multiplyDown(double a, double b)
+{
+  double product = a * b;
+  if (!CoinFinite(product))
+    return (product > 0.0) ? COIN_DBL_MAX : product;
+  if (fabs(product) < 1.0e-290)
+    return (a && b) ? down(product) : 0.0; // error may not be representable
+  double error = fma(a, b, -product);
+  return (error < 0.0) ? down(product) : product;
+}
+// a*b rounded up
+inline double multiplyUp(double a, double b)
+{
+  double product = a * b;
+  if (!CoinFinite(product))
+    return (product < 0.0) ? -COIN_DBL_MAX : product;
+  if (fabs(product) < 1.0e-290)
+    return (a && b) ? up(product) : 0.0;
+  double error = fma(a, b, -product);
+  return (error > 0.0) ? up(product) : product;
+}
+}
+
+CbcSafeCheck::CbcSafeCheck()
+  : active_(false)
+{
+  clear();
+}
+
+void CbcSafeCheck::clear()
+{
+  objectiveLower_ = -COIN_DBL_MAX;
+  objectiveUpper_ = COIN_DBL_MAX;
+  maximumViolation_ = 0.0;
+  maximumIntegerChange_ = 0.0;
+  bestBound_ = -COIN_DBL_MAX;
+  boundCutoff_ = COIN_DBL_MAX;
+  seconds_ = 0.0;
+  status_ = -1;
+}
+
+int CbcSafeCheck::checkSolution(const OsiSolverInterface *solver,
+  const double *solution, int numberRows, const double *columnLower,
+  const double *columnUpper)
+{
+  double time1 = CoinCpuTime();
+  int numberColumns = solver->getNumCols();
+  if (numberRows < 0 || numberRows > solver->getNumRows())
+    numberRows = solver->getNumRows();
+  const double *lower = columnLower ? columnLower : solver->getColLower();
+  const double *upper = columnUpper ? columnUpper : solver->getColUpper();
+  const double *objective = solver->getObjCoefficients();
+  double direction = solver->getObjSense();
+  double primalTolerance;
+  solver->getDblParam(OsiPrimalTolerance, primalTolerance);
+  double offset;
+  solver->getDblParam(OsiObjOffset, offset);
+  bool proven = true;
+  maximumViolation_ = 0.0;
+  maximumIntegerChange_ = 0.0;
+  // objective is c x - offset (minimization sense)
+  double objectiveLower = -direction * offset;
+  double objectiveUpper = objectiveLower;
+  std::vector< double > x(solution, solution + numberColumns);
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    double value = x[iColumn];
+    if (solver->isInteger(iColumn)) {
+      double nearest = floor(value + 0.5);
+      maximumIntegerChange_ = CoinMax(maximumIntegerChange_, fabs(nearest - value));
+      value = nearest;
+      x[iColumn] = value;
+    }
+    if (value < lower[iColumn]) {
+      proven = false;
+      maximumViolation_ = CoinMax(maximumViolation_, addUp(lower[iColumn], -value));
+    } else if (value > upper[iColumn]) {
+      proven = false;
+      maximumViolation_ = CoinMax(maximumViolation_, addUp(value, -upper[iColumn]));
+    }
+    double cost = direction * objective[iColumn];
+    if (cost && value) {
+      objectiveLower = addDown(objectiveLower, multiplyDown(cost, value));
+      objectiveUpper = addUp(objectiveUpper, multiplyUp(cost, value));
+    }
+  }
+  objectiveLower_ = objectiveLower;
+  objectiveUpper_ = objectiveUpper;
+  // row activities as intervals
+  std::vector< double > activityLower(numberRows, 0.0);
+  std::vector< double > activityUpper(numberRows, 0.0);
+  const CoinPackedMatrix *matrix = solver->getMatrixByCol();
+  const CoinBigIndex *columnStart = matrix->getVectorStarts();
+  const int *columnLength = matrix->getVectorLengths();
+  const int *row = matrix->getIndices();
+  const double *element = matrix->getElements();
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    double value = x[iColumn];
+    if (!value)
+      continue;
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+      int iRow = row[j];
+      if (iRow < numberRows) {
+        activityLower[iRow] = addDown(activityLower[iRow], multiplyDown(element[j], value));
+        activityUpper[iRow] = addUp(activityUpper[iRow], multiplyUp(element[j], value));
+      }
+    }
+  }
+  const double *rowLower = solver->getRowLower();
+  const double *rowUpper = solver->getRowUpper();
+  for (int iRow = 0; iRow < numberRows; iRow++) {
+    if (activityLower[iRow] < rowLower[iRow]) {
+      proven = false;
+      maximumViolation_ = CoinMax(maximumViolation_,
+        addUp(rowLower[iRow], -activityLower[iRow]));
+    }
+    if (activityUpper[iRow] > rowUpper[iRow]) {
+      proven = false;
+      maximumViolation_ = CoinMax(maximumViolation_,
+        addUp(activityUpper[iRow], -rowUpper[iRow]));
+    }
+  }
+  if (proven)
+    status_ = 0;
+  else if (maximumViolation_ <= primalTolerance)
+    status_ = 1;
+  else
+    status_ = 2;
+  seconds_ += CoinCpuTime() - time1;
+  return status_;
+}
+
+double CbcSafeCheck::safeBound(const OsiSolverInterface *solver,
+  int numberRows, double cutoff)
+{
+  if (!solver->isProvenOptimal())
+    return -COIN_DBL_MAX;
+  double time1 = CoinCpuTime();
+  int numberColumns = solver->getNumCols();
+  if (numberRows < 0 || numberRows > solver->getNumRows())
+    numberRows = solver->getNumRows();
+  double direction = solver->getObjSense();
+  double infinity = solver->getInfinity();
+  const double *lower = solver->getColLower();
+  const double *upper = solver->getColUpper();
+  const double *objective = solver->getObjCoefficients();
+  const double *rowPrice = solver->getRowPrice();
+  const double *rowLower = solver->getRowLower();
+  const double *rowUpper = solver->getRowUpper();
+  double offset;
+  solver->getDblParam(OsiObjOffset, offset);
+  // y b using side each dual says (zero if that side infinite)
+  std::vector< double > dual(numberRows);
+  double bound = -direction * offset;
+  for (int iRow = 0; iRow < numberRows; iRow++) {
+    double value = direction * rowPrice[iRow];
+    if (value > 0.0 && rowLower[iRow] > -infinity) {
+      dual[iRow] = value;
+      bound = addDown(bound, multiplyDown(value, rowLower[iRow]));
+    } else if (value < 0.0 && rowUpper[iRow] < infinity) {
+      dual[iRow] = value;
+      bound = addDown(bound, multiplyDown(value, rowUpper[iRow]));
+    } else {
+      dual[iRow] = 0.0;
+    }
+  }
+  // interval for each d = c - A'y and its worst end point against bounds
+  const CoinPackedMatrix *matrix = solver->getMatrixByCol();
+  const CoinBigIndex *columnStart = matrix->getVectorStarts();
+  const int *columnLength = matrix->getVectorLengths();
+  const int *row = matrix->getIndices();
+  const double *element = matrix->getElements();
+  for (int iColumn = 0; iColumn < numberColumns && bound > -COIN_DBL_MAX; iColumn++) {
+    double dLower = direction * objective[iColumn];
+    double dUpper = dLower;
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+      int iRow = row[j];
+      if (iRow < numberRows && dual[iRow]) {
+        dLower = addDown(dLower, -multiplyUp(dual[iRow], element[j]));
+        dUpper = addUp(dUpper, -multiplyDown(dual[iRow], element[j]));
+      }
+    }
+    if (!dLower && !dUpper)
+      continue;
+    // d x is bilinear so minimum is at a corner
+    double smallest = COIN_DBL_MAX;
+    if (lower[iColumn] > -infinity) {
+      smallest = CoinMin(multiplyDown(dLower, lower[iColumn]),
+        multiplyDown(dUpper, lower[iColumn]));
+    } else if (dUpper > 0.0) {
+      bound = -COIN_DBL_MAX;
+      break;
+    }
+    if (upper[iColumn] < infinity) {
+      smallest = CoinMin(smallest, multiplyDown(dLower, upper[iColumn]));
+      smallest = CoinMin(smallest, multiplyDown(dUpper, upper[iColumn]));
+    } else if (dLower < 0.0) {
+      bound = -COIN_DBL_MAX;
+      break;
+    }
+    bound = addDown(bound, smallest);
+  }
+  if (!CoinFinite(bound))
+    bound = -COIN_DBL_MAX;
+  if (bound > bestBound_) {
+    bestBound_ = bound;
+    boundCutoff_ = cutoff;
+  }
+  seconds_ += CoinCpuTime() - time1;
+  return bound;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
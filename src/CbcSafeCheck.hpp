@@ -0,0 +1,143 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+/*! \file CbcSafeCheck.hpp
+    \brief Checks of solution and bound which do not trust rounding.
+*/
+
+#ifndef CbcSafeCheck_H
+#define CbcSafeCheck_H
+
+#include "CbcConfig.h"
+#include "CoinFinite.hpp"
+
+class OsiSolverInterface;
+
+/** Safe checks of final solution and bound.
+
+    All sums and products are done in interval arithmetic.  Each
+    operation is done in ordinary floating point and its exact error is
+    found (two sum and fused multiply add) so the result is rounded
+    outward by one unit only when it was not exact.  So if the data and
+    solution are integers the activities are exact and equality rows can
+    be proven to hold.
+
+    checkSolution rounds integer variables and then bounds the activity of
+    each row; the solution is proven feasible if every interval lies
+    within the row bounds, otherwise the largest possible violation is
+    found.  The objective is also bounded.  It is meant to be used on the
+    original model after postsolve, with the column bounds as they were
+    before the search tightened them.
+
+    safeBound takes the duals y of an optimal LP and finds a lower bound
+    (minimization) on c x over the row and column bounds with
+
+      c x >= y b + min (c - A'y) x
+
+    computing c - A'y as intervals and taking the worst end point against
+    the column bounds.  It holds for any y so only the rows of the problem
+    (not cuts) need be used.  The column bounds may have been tightened by
+    reduced cost fixing against the cutoff, so the bound only holds for
+    solutions better than that cutoff, which is kept with it.  Values are
+    in minimization sense.
+*/
+
+class CBCLIB_EXPORT CbcSafeCheck {
+public:
+  /// Default Constructor (off)
+  CbcSafeCheck();
+
+  /// Switch on or off
+  inline void setActive(bool yesNo)
+  {
+    active_ = yesNo;
+  }
+  /// Whether on
+  inline bool active() const
+  {
+    return active_;
+  }
+  /// Forget results (e.g. at start of search)
+  void clear();
+
+  /** Checks solution against bounds, integrality and first numberRows rows
+      (all if -1) of solver.  Column bounds are columnLower and columnUpper
+      if given, otherwise those of solver.  Returns 0 if proven feasible, 1
+      if possible violation is within primal tolerance and 2 if not. */
+  int checkSolution(const OsiSolverInterface *solver, const double *solution,
+    int numberRows = -1, const double *columnLower = NULL,
+    const double *columnUpper = NULL);
+  /** Safe lower bound from duals of optimal LP in solver using first
+      numberRows rows (all if -1).  cutoff is cutoff used to fix variables
+      in solver.  Kept (with cutoff) if best so far.  Returns -COIN_DBL_MAX
+      if no finite bound. */
+  double safeBound(const OsiSolverInterface *solver, int numberRows = -1,
+    double cutoff = COIN_DBL_MAX);
+
+  /// Status of last checkSolution (-1 none)
+  inline int status() const
+  {
+    return status_;
+  }
+  /// Largest possible violation of bound or row
+  inline double maximumViolation() const
+  {
+    return maximumViolation_;
+  }
+  /// Largest change when integers rounded
+  inline double maximumIntegerChange() const
+  {
+    return maximumIntegerChange_;
+  }
+  /// Lower end of objective of solution
+  inline double objectiveLower() const
+  {
+    return objectiveLower_;
+  }
+  /// Upper end of objective of solution
+  inline double objectiveUpper() const
+  {
+    return objectiveUpper_;
+  }
+  /// Best safe bound found (-COIN_DBL_MAX if none)
+  inline double bestBound() const
+  {
+    return bestBound_;
+  }
+  /// Cutoff for best bound - it only holds for solutions better than this
+  inline double boundCutoff() const
+  {
+    return boundCutoff_;
+  }
+  /// Seconds spent in checks
+  inline double seconds() const
+  {
+    return seconds_;
+  }
+
+private:
+  /// Lower end of objective of solution
+  double objectiveLower_;
+  /// Upper end of objective of solution
+  double objectiveUpper_;
+  /// Largest possible violation
+  double maximumViolation_;
+  /// Largest change when integers rounded
+  double maximumIntegerChange_;
+  /// Best safe bound
+  double bestBound_;
+  /// Cutoff for best bound
+  double boundCutoff_;
+  /// Time
+  double seconds_;
+  /// Status of last checkSolution
+  int status_;
+  /// Whether on
+  bool active_;
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -112,6 +112,7 @@ void CbcCrashHandler(int sig);
 #include "CglTwomir.hpp"
 #include "CglZeroHalf.hpp"
 
+#include "CbcBinaryModel.hpp"
 #include "CbcBranchActual.hpp"
 #include "CbcBranchCut.hpp"
 #include "CbcBranchLotsize.hpp"
@@ -131,6 +132,7 @@ void CbcCrashHandler(int sig);
 #include "CbcHeuristicPivotAndFix.hpp"
 #include "CbcHeuristicRINS.hpp"
 #include "CbcHeuristicRandRound.hpp"
+#include "CbcLazyConstraints.hpp"
 #include "CbcMessage.hpp"
 #include "CbcMipStartIO.hpp"
 #include "CbcModel.hpp"
@@ -138,6 +140,11 @@ void CbcCrashHandler(int sig);
 #include "CbcParamUtils.hpp"
 #include "CbcSolver.hpp"
 #include "CbcSolverAnalyze.hpp"
+#include "CbcSolverBatch.hpp"
+#include "CbcSolverBenchmark.hpp"
+#include "CbcProgressStream.hpp"
+#include "CbcTrace.hpp"
+#include "CbcSolverDaemon.hpp"
 #include "CbcSolverExpandKnapsack.hpp"
 #include "CbcSolverHeuristics.hpp"
 #include "CbcStrategy.hpp"
@@ -575,6 +582,30 @@ static int numberPrintingColumns(const OsiSolverInterface *solver) {
 #endif
 }
 
+// Safe check of final solution on original model (after postsolve)
+static void safeCheckSolution(CbcModel *babModel,
+                              const OsiSolverInterface *originalSolver,
+                              const double *solution,
+                              const std::vector<double> &columnLower,
+                              const std::vector<double> &columnUpper) {
+  CbcSafeCheck &safeCheck = babModel->safeCheck();
+  int numberColumns = originalSolver->getNumCols();
+  if (!safeCheck.active() || !solution || !numberColumns ||
+      static_cast<int>(columnLower.size()) != numberColumns)
+    return;
+  static const char *status[] = {"proven feasible", "within tolerance",
+                                 "NOT feasible"};
+  int iStatus = safeCheck.checkSolution(originalSolver, solution, -1,
+                                        &columnLower[0], &columnUpper[0]);
+  double direction = originalSolver->getObjSense();
+  double lower = direction * safeCheck.objectiveLower();
+  double upper = direction * safeCheck.objectiveUpper();
+  babModel->messageHandler()->message(CBC_SAFE_CHECK, babModel->messages())
+      << status[iStatus] << safeCheck.maximumViolation()
+      << safeCheck.maximumIntegerChange() << CoinMin(lower, upper)
+      << CoinMax(lower, upper) << CoinMessageEol;
+}
+
 //###########################################################################
 //###########################################################################
 
@@ -1033,7 +1064,7 @@ void CbcMain0(CbcModel &model, CbcParameters &parameters) {
   parameters[CbcParam::GREEDY]->setVal("on");
   parameters[CbcParam::COMBINE]->setVal("off");
   parameters[CbcParam::CROSSOVER]->setVal("off");
-#ifdef CBC_HAS_NAUTY
+#if defined(CBC_HAS_NAUTY) && !defined(CBC_NAUTY_BUILTIN)
 #ifndef CBC_LIGHTWEIGHT_NAUTY
   parameters[CbcParam::ORBITAL]->setVal("on");
 #else
@@ -4313,6 +4344,7 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
                 /* Do not try and produce equality cliques and
                                    do up to 10 passes */
                 OsiSolverInterface *solver2;
+                bool lazyNotMapped = false;
                 {
                   // Tell solver we are in Branch and Cut
                   saveSolver->setHintParam(OsiDoInBranchAndCut, true,
@@ -4608,7 +4640,14 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
 		    process.setOptions(128|256|process.options());
                     delete[] prohibited;
                   }
-                  if (model_.numberObjects()) {
+                  // lazy constraints - keep their columns so rows can be mapped
+                  bool lazyConstraints = false;
+                  for (int i = 0; i < babModel_->numberCutGenerators(); i++) {
+                    if (dynamic_cast<CbcLazyConstraints *>(
+                            babModel_->cutGenerator(i)->generator()))
+                      lazyConstraints = true;
+                  }
+                  if (model_.numberObjects() || lazyConstraints) {
                     OsiObject **oldObjects = babModel_->objects();
                     int numberOldObjects = babModel_->numberObjects();
                     if (!numberOldObjects) {
@@ -4642,6 +4681,15 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
                         numberProhibited++;
                       }
                     }
+                    for (int i = 0; i < babModel_->numberCutGenerators(); i++) {
+                      CbcLazyConstraints *lazy =
+                          dynamic_cast<CbcLazyConstraints *>(
+                              babModel_->cutGenerator(i)->generator());
+                      if (lazy) {
+                        lazy->markColumns(prohibited, numberColumns);
+                        numberProhibited++;
+                      }
+                    }
                     if (numberProhibited) 
                       process.passInProhibited(prohibited, numberColumns);
                     delete[] prohibited;
@@ -4732,6 +4780,46 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
                       setPreProcessingMode(solver2, 0);
                       model_.setOriginalColumns(process.originalColumns(),
                                                 solver2->getNumCols());
+                      // lazy constraints now refer to preprocessed columns
+                      for (int i = 0; i < babModel_->numberCutGenerators();
+                           i++) {
+                        CbcLazyConstraints *lazy =
+                            dynamic_cast<CbcLazyConstraints *>(
+                                babModel_->cutGenerator(i)->generator());
+                        if (lazy) {
+                          // removed columns were fixed - value if known
+                          int numberColumns = saveSolver->getNumCols();
+                          const double *lower = saveSolver->getColLower();
+                          const double *upper = saveSolver->getColUpper();
+                          const double *lower2 =
+                              process.originalModel()->getColLower();
+                          const double *upper2 =
+                              process.originalModel()->getColUpper();
+                          double *fixedValue = new double[numberColumns];
+                          for (int iColumn = 0; iColumn < numberColumns;
+                               iColumn++) {
+                            if (lower[iColumn] == upper[iColumn])
+                              fixedValue[iColumn] = lower[iColumn];
+                            else if (lower2[iColumn] == upper2[iColumn])
+                              fixedValue[iColumn] = lower2[iColumn];
+                            else
+                              fixedValue[iColumn] = COIN_DBL_MAX;
+                          }
+                          int numberBad = lazy->mapColumns(
+                              process.originalColumns(), solver2->getNumCols(),
+                              fixedValue);
+                          delete[] fixedValue;
+                          if (numberBad) {
+                            buffer.str("");
+                            buffer << numberBad
+                                   << " lazy constraints use columns removed "
+                                      "by preprocessing - switch preprocessing "
+                                      "off";
+                            printGeneralMessage(model_, buffer.str());
+                            lazyNotMapped = true;
+                          }
+                        }
+                      }
 
                       osiclp->getModelPtr()->setPerturbation(savePerturbation);
                       osiclp->getModelPtr()->setMoreSpecialOptions(saveOptions);
@@ -4822,6 +4910,14 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
                 }
                 if (!solver2)
                   break;
+                if (lazyNotMapped) {
+                  // lazy constraints could not be enforced - give up
+                  delete saveSolver;
+                  saveSolver = NULL;
+                  model_.setProblemStatus(2);
+                  babModel_->setProblemStatus(2);
+                  break;
+                }
                 if (model_.bestSolution()) {
                   // need to redo - in case no better found in BAB
                   // just get integer part right
@@ -4910,9 +5006,22 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
                       strcpy(name, "preprocessed.mps");
                     }
                   }
-                  lpSolver->writeMps(name, 0, 1, lpSolver->optimizationDirection());
-                  printf("Preprocessed model (minimization) on %s - size %d %d \n",
-			 name,lpSolver->getNumRows(),lpSolver->getNumCols());
+                  bool written = true;
+                  if (CbcBinaryModel::isBinaryFileName(
+                          parameters[CbcParam::EXPORTFILE]->fileName().c_str())) {
+                    // export file is binary so save preprocessed model as binary
+                    char *dot = strstr(name, ".mps");
+                    if (dot)
+                      strcpy(dot, ".cbcb");
+                    written = !CbcBinaryModel::write(clpSolver2, name);
+                  } else {
+                    lpSolver->writeMps(name, 0, 1, lpSolver->optimizationDirection());
+                  }
+                  if (written)
+                    printf("Preprocessed model (minimization) on %s - size %d %d \n",
+                           name,lpSolver->getNumRows(),lpSolver->getNumCols());
+                  else
+                    printf("Unable to write preprocessed model to %s\n", name);
                   if (preProcess >= 10) {
                     printf("user wanted to stop\n");
                     return 0; //exit(0);
@@ -6147,6 +6256,7 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
               numberGenerators = babModel_->numberCutGenerators();
               int iGenerator;
               int cutDepth = parameters[CbcParam::CUTDEPTH]->intVal();
+              int cutSchedule = parameters[CbcParam::CUTSCHEDULE]->modeVal();
               for (iGenerator = 0; iGenerator < numberGenerators;
                    iGenerator++) {
                 CbcCutGenerator *generator =
@@ -6175,6 +6285,13 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
                 generator->setTiming(true);
                 if (cutDepth >= 0)
                   generator->setWhatDepth(cutDepth);
+                // schedule adjustable generators (not probing) on bound gain
+                else if (cutSchedule == CbcParameters::CSAuto &&
+                         (howOften == -1 || howOften == -98) &&
+                         generator->maximumTries() <= 0 &&
+                         !doAtEnd[iGenerator] &&
+                         !dynamic_cast<CglProbing *>(generator->generator()))
+                  generator->setAutomatic(true);
               }
               // Could tune more
               if (!miplib) {
@@ -6422,6 +6539,9 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
                   babModel_->setWhenCuts(999998);
                 }
               }
+              // column bounds of original model for safe check
+              std::vector<double> safeLower;
+              std::vector<double> safeUpper;
               if (cbcParamCode == CbcParam::BAB) {
                 if (info && statusUserFunction_[0]) {
                   priorities = info->priorities;
@@ -6492,15 +6612,16 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
                   babModel_->findIntegers(true);
                   int extraActions = 0;
                   int lengthFileName = mipStartFile.size();
-                  const char *checkEnd[6] = {".low",          ".high",
+                  const char *checkEnd[7] = {".low",          ".high",
                                              ".lowcheap",     ".highcheap",
-                                             ".lowexpensive", ".highexpensive"};
-                  for (extraActions = 0; extraActions < 6; extraActions++) {
+                                             ".lowexpensive", ".highexpensive",
+                                             ".partial"};
+                  for (extraActions = 0; extraActions < 7; extraActions++) {
                     if (ends_with(mipStartFile,
                                   std::string(checkEnd[extraActions])))
                       break;
                   }
-                  if (extraActions == 6)
+                  if (extraActions == 7)
                     extraActions = 0;
                   else
                     extraActions++;
@@ -8034,6 +8155,12 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
                 int specialOptions = parameters[CbcParam::STRONGSTRATEGY]->intVal();
                 if (specialOptions >= 0)
                   babModel_->setStrongStrategy(specialOptions);
+                babModel_->setStrongLookahead(
+                    parameters[CbcParam::STRONGLOOKAHEAD]->intVal());
+                babModel_->nodeCache().setMaximumEntries(
+                    parameters[CbcParam::NODECACHE]->intVal());
+                babModel_->globalFixing().setMaximumRecords(
+                    parameters[CbcParam::GLOBALFIXING]->intVal());
                 if (parameters[CbcParam::CUTOFFCONSTRAINT]->modeVal()) {
                   babModel_->setCutoffAsConstraint(true);
                   int moreOptions = babModel_->moreSpecialOptions();
@@ -8139,6 +8266,34 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
                 if (biLinearProblem)
                    babModel_->setSpecialOptions(babModel_->specialOptions() &
                                                 (~(512 | 32768)));
+                babModel_->setMaximumRestarts(
+                    parameters[CbcParam::MAXRESTARTS]->intVal());
+                babModel_->setRestartFraction(
+                    parameters[CbcParam::RESTARTFRACTION]->dblVal());
+                babModel_->setKeepHotStart(
+                    parameters[CbcParam::KEEPHOTSTART]->modeVal() ==
+                    CbcParameters::ParamOn);
+                babModel_->safeCheck().setActive(
+                    parameters[CbcParam::SAFECHECK]->modeVal() ==
+                    CbcParameters::ParamOn);
+                if (babModel_->safeCheck().active()) {
+                  // original bounds - solution is checked after postsolve
+                  int numberColumns = originalSolver->getNumCols();
+                  const double *lower = originalSolver->getColLower();
+                  const double *upper = originalSolver->getColUpper();
+                  safeLower.assign(lower, lower + numberColumns);
+                  safeUpper.assign(upper, upper + numberColumns);
+                }
+                {
+                  int maximumCuts =
+                      parameters[CbcParam::MAXCUTSROUND]->intVal();
+                  babModel_->cutSelection().setMaximumCuts(
+                      maximumCuts, CoinMax(maximumCuts / 10, 1));
+                  babModel_->cutSelection().setMinimumEfficacy(
+                      parameters[CbcParam::CUTEFFICACY]->dblVal());
+                  babModel_->cutSelection().setMaximumParallelism(
+                      parameters[CbcParam::CUTPARALLEL]->dblVal());
+                }
                 babModel_->setMoreSpecialOptions2(
                     parameters[CbcParam::MOREMOREMIPOPTIONS]->intVal());
 #ifdef CBC_HAS_NAUTY
@@ -8153,6 +8308,12 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
 #define MAX_NAUTY_PASS 2000
                       nautyAdded =
                           nautiedConstraints(*babModel_, MAX_NAUTY_PASS);
+                    } else if (k == CbcParameters::OBOrbitope) {
+                      // as on but orbitopes found are handled by fixing
+                      babModel_->setMoreSpecialOptions2(
+                          babModel_->moreSpecialOptions2() | 128 | 256 |
+                          131072);
+                      babModel_->setOrbitopalFixing(true);
                     } else {
 		      assert (k>=5 && k <=9);
                       if (k == 5)
@@ -8219,7 +8380,49 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
 		  babModel_ = NULL;
 		  return returnCode;
 		}
+                std::string traceFile =
+                  parameters[CbcParam::TRACEFILE]->fileName();
+                if (traceFile != "")
+                  CbcTrace::start();
+                CbcProgressStream progressStream;
+                std::string progressFile =
+                  parameters[CbcParam::PROGRESSFILE]->fileName();
+                if (progressFile != "") {
+                  if (progressStream.open(progressFile.c_str())) {
+                    buffer.str("");
+                    buffer << "Unable to open progress file " << progressFile;
+                    printGeneralMessage(model_, buffer.str());
+                  } else {
+                    progressStream.setInterval(
+                      parameters[CbcParam::PROGRESSINTERVAL]->dblVal());
+                    babModel_->setProgressStream(&progressStream);
+                  }
+                }
+#ifdef COIN_HAS_LINK
+                OsiSolverLink::zeroLinearizationStatistics();
+#endif
                 babModel_->branchAndBound(statistics);
+                babModel_->setProgressStream(NULL);
+#ifdef COIN_HAS_LINK
+                if (OsiSolverLink::numberLinearizationChecks()) {
+                  buffer.str("");
+                  buffer << "Bilinear coefficients looked at "
+                         << OsiSolverLink::numberLinearizationChecks()
+                         << " times, " << OsiSolverLink::numberLinearizationHits()
+                         << " unchanged from cache, taking "
+                         << OsiSolverLink::linearizationSeconds() << " seconds";
+                  printGeneralMessage(model_, buffer.str());
+                }
+#endif
+                if (traceFile != "") {
+                  CbcTrace::stop();
+                  if (CbcTrace::write(traceFile.c_str())) {
+                    buffer.str("");
+                    buffer << "Unable to open trace file " << traceFile;
+                    printGeneralMessage(model_, buffer.str());
+                  }
+                  CbcTrace::clear();
+                }
 #ifdef CBC_HAS_NAUTY
                 if (nautyAdded) {
                   int *which = new int[nautyAdded];
@@ -8490,6 +8693,14 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
                          << " cuts of which "
                          << generator->numberCutsActive()
                          << " were active after adding rounds of cuts";
+                  if (generator->numberParallelCuts() +
+                      generator->numberWeakCuts() +
+                      generator->numberCutsOverLimit())
+                    buffer << " (not added "
+                           << generator->numberParallelCuts() << " parallel, "
+                           << generator->numberWeakCuts() << " weak, "
+                           << generator->numberCutsOverLimit()
+                           << " over limit)";
                   if (generator->timing()) {
                      buffer << " (" << generator->timeInCutGenerator() <<  " seconds)";
                      statistics_cut_time += generator->timeInCutGenerator();
@@ -8831,6 +9042,8 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
                   // assert(originalSolver->isProvenOptimal());
                 }
 #endif
+                safeCheckSolution(babModel_, originalSolver, bestSolution,
+                                  safeLower, safeUpper);
                 checkSOS(babModel_, babModel_->solver());
               } else if (model_.bestSolution() &&
                          cbcParamCode == CbcParam::BAB &&
@@ -8874,6 +9087,8 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
                   delete basis;
                 }
 #endif
+                safeCheckSolution(babModel_, originalSolver, bestSolution,
+                                  safeLower, safeUpper);
               }
 #ifndef CBC_OTHER_SOLVER
               // if (type==STRENGTHEN&&strengthenedModel)
@@ -8978,6 +9193,21 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
                 buffer << "Total iterations:               ";
                 buffer << babModel_->getIterationCount() << std::endl;
 #if CBC_QUIET == 0
+                const CbcBoundHistory &history = babModel_->boundHistory();
+                if (history.searchTime() > 0.0) {
+                  buffer << "Primal integral:                "
+                         << history.primalIntegral() << std::endl;
+                  buffer << "Dual integral:                  "
+                         << history.dualIntegral() << std::endl;
+                  buffer << "Primal-dual integral:           "
+                         << history.primalDualIntegral() << std::endl;
+                  if (history.timeToFirstSolution() >= 0.0) {
+                    buffer << "Time to first solution:         "
+                           << history.timeToFirstSolution() << std::endl;
+                    buffer << "Time to within 1% of best:      "
+                           << history.timeToOnePercent() << std::endl;
+                  }
+                }
                 buffer << "Time (CPU seconds):             "
                        << CoinCpuTime() - time1 << std::endl;
                 buffer << "Time (Wallclock seconds):       "
@@ -9207,7 +9437,40 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
             delete[] lotsize;
 #ifndef CBC_OTHER_SOLVER
             ClpSimplex *lpSolver = clpSolver->getModelPtr();
-            if (!gmpl) {
+            if (!gmpl && CbcBinaryModel::isBinaryFileName(fileName.c_str())) {
+               // native binary - mapped and loaded without parsing
+               CbcBinaryModel binaryModel;
+               status = binaryModel.open(fileName.c_str());
+               if (!status && binaryModel.loadInto(clpSolver, keepImportNames != 0)) {
+                  buffer.str("");
+                  buffer << "Binary model " << fileName.c_str()
+                         << " can not be loaded into this build";
+                  printGeneralMessage(model_, buffer.str());
+                  continue;
+               }
+               if (!status) {
+                  int numberColumns = binaryModel.numberColumns();
+                  if (binaryModel.mipStart()) {
+                     const double *values = binaryModel.mipStart();
+                     mipStart.clear();
+                     for (int i = 0; i < numberColumns; i++)
+                        mipStart.push_back(std::pair<std::string, double>(
+                            clpSolver->getColName(i), values[i]));
+                  }
+                  if (binaryModel.priorities()) {
+                     priorities = reinterpret_cast<int *>(
+                         malloc(numberColumns * sizeof(int)));
+                     memcpy(priorities, binaryModel.priorities(),
+                            numberColumns * sizeof(int));
+                  }
+               } else {
+                  buffer.str("");
+                  buffer << "Binary model " << fileName.c_str()
+                         << " could not be read - error " << status;
+                  printGeneralMessage(model_, buffer.str());
+                  continue;
+               }
+            } else if (!gmpl) {
                status =
                   clpSolver->readMps(fileName.c_str(), keepImportNames != 0,
                                      allowImportErrors != 0);
@@ -9446,7 +9709,14 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
                       !strcmp(fileName.c_str() + lengthName - 3, ".lp"))
                      writeLp = true;
                }
-               if (!writeLp) {
+               if (CbcBinaryModel::isBinaryFileName(fileName.c_str())) {
+                  OsiClpSolverInterface solver(model2);
+                  if (CbcBinaryModel::write(&solver, fileName.c_str())) {
+                     buffer.str("");
+                     buffer << "Unable to write file " << fileName.c_str();
+                     printGeneralMessage(model_, buffer.str());
+                  }
+               } else if (!writeLp) {
                   model2->writeMps(fileName.c_str(), (outputFormat - 1) / 2,
                                    1 + ((outputFormat - 1) & 1));
                } else {
@@ -9513,7 +9783,20 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
                         clpSolver->setColumnType(iColumn, type);
                      }
                   }
-                  if (!writeLp) {
+                  if (CbcBinaryModel::isBinaryFileName(fileName.c_str())) {
+                     // keep incumbent (if any) as MIP start
+                     const double *bestSolution = NULL;
+                     if (model_.bestSolution() &&
+                         model_.getNumCols() == numberColumns)
+                        bestSolution = model_.bestSolution();
+                     if (CbcBinaryModel::write(clpSolver, fileName.c_str(),
+                                               bestSolution, priorities,
+                                               model2->lengthNames() != 0)) {
+                        buffer.str("");
+                        buffer << "Unable to write file " << fileName.c_str();
+                        printGeneralMessage(model_, buffer.str());
+                     }
+                  } else if (!writeLp) {
                      remove(fileName.c_str());
                      // model_.addSOSEtcToSolver();
                      clpSolver->writeMpsNative(
@@ -10141,6 +10424,84 @@ int CbcMain1(std::deque<std::string> inputQueue, CbcModel &model,
             for (iRow = 0; iRow < numberRows; iRow++)
                dualRowSolution[iRow] = dualRowSolution[iRow];
            } break;
+          case CbcParam::BATCH: {
+            cbcParam->readValue(inputQueue, fileName, &message);
+            CoinParamUtils::processFile(fileName,
+                                 parameters[CbcParam::DIRECTORY]->dirName());
+            // everything else on command line is for each model
+            std::deque<std::string> batchOptions;
+            while (!inputQueue.empty()) {
+               batchOptions.push_back(inputQueue.front());
+               inputQueue.pop_front();
+            }
+            std::string resultsFile =
+               parameters[CbcParam::BATCHRESULTSFILE]->fileName();
+            CbcBatchSummary summary;
+            int returnCode = CbcBatchSolve(fileName, batchOptions,
+               parameters[CbcParam::BATCHWORKERS]->intVal(), resultsFile,
+               summary);
+            buffer.str("");
+            if (returnCode == 1) {
+               buffer << "Unable to read model list " << fileName.c_str();
+            } else if (returnCode == 2) {
+               buffer << "Unable to open batch results file "
+                      << resultsFile.c_str();
+            } else {
+               buffer << "Batch of " << summary.numberModels << " models ("
+                      << summary.numberOptimal << " optimal, "
+                      << summary.numberInfeasible << " infeasible, "
+                      << summary.numberStopped << " stopped, "
+                      << summary.numberFailed << " failed) took "
+                      << summary.wallTime << " seconds with "
+                      << summary.numberWorkers << " workers - "
+                      << summary.numberModels / CoinMax(summary.wallTime, 1.0e-6)
+                      << " models per second, average "
+                      << summary.sumTime / summary.numberModels
+                      << " seconds per model, results in "
+                      << resultsFile.c_str();
+            }
+            printGeneralMessage(model_, buffer.str());
+          } break;
+          case CbcParam::BENCHCOMPARE: {
+            cbcParam->readValue(inputQueue, fileName, &message);
+            CoinParamUtils::processFile(fileName,
+                                 parameters[CbcParam::DIRECTORY]->dirName());
+            std::string resultsFile =
+               parameters[CbcParam::BENCHRESULTSFILE]->fileName();
+            if (resultsFile == "") {
+               buffer.str("");
+               buffer << "benchCompare needs benchResults to be set";
+               printGeneralMessage(model_, buffer.str());
+               break;
+            }
+            int returnCode = CbcBenchmarkCompare(fileName, resultsFile, 0.1);
+            babModel_ = NULL;
+            return returnCode < 0 ? 1 : returnCode;
+          }
+          case CbcParam::SERVE: {
+            cbcParam->readValue(inputQueue, fileName, &message);
+            // everything else on command line is for each model
+            std::deque<std::string> serveOptions;
+            while (!inputQueue.empty()) {
+               serveOptions.push_back(inputQueue.front());
+               inputQueue.pop_front();
+            }
+            int numberWorkers = parameters[CbcParam::BATCHWORKERS]->intVal();
+            buffer.str("");
+            buffer << "Serving on " << fileName.c_str() << " with "
+                   << numberWorkers << " workers";
+            printGeneralMessage(model_, buffer.str());
+            int returnCode = CbcDaemonServe(fileName, serveOptions,
+                                            numberWorkers);
+            buffer.str("");
+            if (returnCode < 0)
+               buffer << "serve needs cbc built with threads on a POSIX system";
+            else if (returnCode)
+               buffer << "Unable to listen on socket " << fileName.c_str();
+            else
+               buffer << "Server on " << fileName.c_str() << " shut down";
+            printGeneralMessage(model_, buffer.str());
+          } break;
           case CbcParam::STDIN:
             interactiveMode = true;
             while (!inputQueue.empty())
@@ -10414,6 +10775,22 @@ clp watson.mps -\nscaling off\nprimalsimplex");
                        parameters[CbcParam::GMPLSOLFILE]->setFileName(fileName);
                     }
                  }
+                 if (cbcParamCode == CbcParam::WRITESOL &&
+                     CbcMipStartIO::isBinaryFileName(fileName.c_str())) {
+                    // compact binary mipstart
+                    buffer.str("");
+                    if (!model_.bestSolution()) {
+                       buffer << "No integer solution to write to " << fileName.c_str();
+                    } else if (CbcMipStartIO::writeBinary(model_.solver(), fileName.c_str(),
+                                                          model_.bestSolution(),
+                                                          model_.getObjValue())) {
+                       buffer << "Unable to write file " << fileName.c_str();
+                    } else {
+                       buffer << "Binary mipstart written to " << fileName.c_str();
+                    }
+                    printGeneralMessage(model_, buffer.str());
+                    continue;
+                 }
                  if (!append){
                     fp = fopen(fileName.c_str(), "w");
                  } else {
@@ -0,0 +1,463 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+/*! \file CbcSolverBatch.cpp
+
+  Batch mode for the cbc executable.  Launching cbc once per model costs
+  process startup, CbcMain0 parameter setup and model construction for
+  every model - for small models that dominates.  Here a number of
+  workers each set those up once and then take models off a shared list
+  until it is empty.  CbcMain1 is not safe to run twice at once in one
+  process, so with more than one worker each is a forked process.
+*/
+
+#include "CbcConfig.h"
+#include "CoinPragma.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifndef _MSC_VER
+#include <dirent.h>
+#endif
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+#define CBC_BATCH_FORK
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
+
+#include "CoinTime.hpp"
+#include "CoinError.hpp"
+#include "OsiClpSolverInterface.hpp"
+#include "CbcModel.hpp"
+#include "CbcSolver.hpp"
+#include "CbcSolverBatch.hpp"
+
+namespace {
+
+// Result of one model - fixed size so it can go down a pipe
+struct BatchResult {
+  int job;
+  char status[20];
+  double objective;
+  double bound;
+  double seconds;
+  int nodes;
+  bool hasSolution;
+};
+
+// What every model needs and where results go
+struct BatchShared {
+  const std::vector< std::string > *files;
+  const std::deque< std::string > *options;
+  FILE *results;
+  CbcBatchSummary *summary;
+};
+
+bool hasEnding(const std::string &value, const char *ending)
+{
+  size_t length = strlen(ending);
+  return value.size() >= length && !value.compare(value.size() - length, length, ending);
+}
+
+bool isModelFile(const std::string &name)
+{
+  static const char *endings[] = { ".mps", ".mps.gz", ".mps.bz2", ".lp",
+    ".lp.gz", ".lp.bz2", ".cbcb" };
+  for (size_t i = 0; i < sizeof(endings) / sizeof(endings[0]); i++) {
+    if (hasEnding(name, endings[i]))
+      return true;
+  }
+  return false;
+}
+
+bool isDirectory(const std::string &name)
+{
+  struct stat info;
+  if (stat(name.c_str(), &info))
+    return false;
+  return (info.st_mode & S_IFMT) == S_IFDIR;
+}
+
+// Fills files from manifest or directory - returns false if unreadable
+bool batchFiles(const std::string &manifest, std::vector< std::string > &files)
+{
+  files.clear();
+  if (isDirectory(manifest)) {
+#ifndef _MSC_VER
+    DIR *dir = opendir(manifest.c_str());
+    if (!dir)
+      return false;
+    struct dirent *entry;
+    while ((entry = readdir(dir))) {
+      std::string name = entry->d_name;
+      if (isModelFile(name))
+        files.push_back(manifest + "/" + name);
+    }
+    closedir(dir);
+    // so results come in predictable order
+    std::sort(files.begin(), files.end());
+    return true;
+#else
+    return false;
+#endif
+  }
+  FILE *fp = fopen(manifest.c_str(), "r");
+  if (!fp)
+    return false;
+  std::string prefix;
+  size_t slash = manifest.find_last_of("/\\");
+  if (slash != std::string::npos)
+    prefix = manifest.substr(0, slash + 1);
+  char line[4096];
+  while (fgets(line, sizeof(line), fp)) {
+    char *start = line;
+    while (*start == ' ' || *start == '\t')
+      start++;
+    char *end = start + strlen(start);
+    while (end > start && (end[-1] == '\n' || end[-1] == '\r' || end[-1] == ' ' || end[-1] == '\t'))
+      end--;
+    *end = '\0';
+    if (!*start || *start == '#')
+      continue;
+    if (*start == '/' || *start == '\\' || (start[0] && start[1] == ':'))
+      files.push_back(start);
+    else
+      files.push_back(prefix + start);
+  }
+  fclose(fp);
+  return true;
+}
+
+// Writes result line and updates totals
+void reportResult(BatchShared *shared, const BatchResult &result)
+{
+  CbcBatchSummary &summary = *shared->summary;
+  const std::string &file = (*shared->files)[result.job];
+  if (!strcmp(result.status, "optimal"))
+    summary.numberOptimal++;
+  else if (!strcmp(result.status, "infeasible") || !strcmp(result.status, "unbounded"))
+    summary.numberInfeasible++;
+  else if (!strcmp(result.status, "error"))
+    summary.numberFailed++;
+  else
+    summary.numberStopped++;
+  summary.sumTime += result.seconds;
+  fprintf(shared->results, "%d,\"%s\",%s,", result.job, file.c_str(), result.status);
+  if (result.hasSolution)
+    fprintf(shared->results, "%.12g", result.objective);
+  fprintf(shared->results, ",%.12g,%.3f,%d\n", result.bound, result.seconds,
+    result.nodes);
+  fflush(shared->results);
+}
+
+// Set up once and reused for every model a worker takes
+void setupWorker(CbcModel &model, CbcParameters &parameters)
+{
+  CbcMain0(model, parameters);
+  parameters.disableWelcomePrinting();
+  parameters.disablePrinting();
+  model.setLogLevel(0);
+}
+
+void solveJob(BatchShared *shared, int iJob, CbcModel &model,
+  CbcParameters &parameters, BatchResult &result)
+{
+  model.resetModel();
+  // quiet unless options say otherwise
+  std::deque< std::string > inputQueue;
+  inputQueue.push_back("-log");
+  inputQueue.push_back("0");
+  inputQueue.push_back("-import");
+  inputQueue.push_back((*shared->files)[iJob]);
+  inputQueue.insert(inputQueue.end(), shared->options->begin(),
+    shared->options->end());
+  inputQueue.push_back("-solve");
+  inputQueue.push_back("-quit");
+  double startTime = CoinGetTimeOfDay();
+  int returnCode;
+  try {
+    returnCode = CbcMain1(inputQueue, model, parameters);
+  } catch (CoinError &e) {
+    returnCode = -1;
+  }
+  memset(&result, 0, sizeof(result));
+  result.job = iJob;
+  strncpy(result.status, CbcBatchStatus(model, returnCode), sizeof(result.status) - 1);
+  result.hasSolution = model.bestSolution() != NULL;
+  result.objective = model.getObjValue();
+  result.bound = model.getBestPossibleObjValue();
+  result.seconds = CoinGetTimeOfDay() - startTime;
+  result.nodes = model.getNodeCount();
+}
+
+// All models in this process one after another
+void solveSerial(BatchShared *shared, int firstJob)
+{
+  OsiClpSolverInterface solver;
+  CbcModel model(solver);
+  CbcParameters parameters;
+  setupWorker(model, parameters);
+  int numberJobs = static_cast< int >(shared->files->size());
+  for (int iJob = firstJob; iJob < numberJobs; iJob++) {
+    BatchResult result;
+    solveJob(shared, iJob, model, parameters, result);
+    reportResult(shared, result);
+  }
+}
+
+#ifdef CBC_BATCH_FORK
+/* CbcMain1 keeps state in globals (pump tuning, the model the SIGINT
+   handler stops, the preprocessing pointer, signal handlers) as do
+   some CbcModel statics and the random number seed, so concurrent
+   workers are separate processes.  The parent hands out job numbers
+   on one pipe per worker and reads results back on another. */
+struct BatchWorker {
+  pid_t pid;
+  int jobPipe;
+  int resultPipe;
+  int job;
+};
+
+bool writeAll(int fd, const void *data, size_t length)
+{
+  const char *put = reinterpret_cast< const char * >(data);
+  while (length) {
+    ssize_t n = write(fd, put, length);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    put += n;
+    length -= n;
+  }
+  return true;
+}
+
+// False on end of file or error
+bool readAll(int fd, void *data, size_t length)
+{
+  char *get = reinterpret_cast< char * >(data);
+  while (length) {
+    ssize_t n = read(fd, get, length);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    get += n;
+    length -= n;
+  }
+  return true;
+}
+
+void workerProcess(BatchShared *shared, int jobPipe, int resultPipe)
+{
+  OsiClpSolverInterface solver;
+  CbcModel model(solver);
+  CbcParameters parameters;
+  setupWorker(model, parameters);
+  int iJob;
+  while (readAll(jobPipe, &iJob, sizeof(iJob)) && iJob >= 0) {
+    BatchResult result;
+    solveJob(shared, iJob, model, parameters, result);
+    if (!writeAll(resultPipe, &result, sizeof(result)))
+      break;
+  }
+}
+
+// Sends next job (or -1 to stop) - returns job sent
+int sendJob(BatchWorker &worker, int &nextJob, int numberJobs)
+{
+  int iJob = (nextJob < numberJobs) ? nextJob++ : -1;
+  if (!writeAll(worker.jobPipe, &iJob, sizeof(iJob)))
+    iJob = -1;
+  worker.job = iJob;
+  if (iJob < 0) {
+    close(worker.jobPipe);
+    worker.jobPipe = -1;
+  }
+  return iJob;
+}
+
+// Returns number of workers started (if none nothing has been solved)
+int solveForked(BatchShared *shared, int numberWorkers)
+{
+  int numberJobs = static_cast< int >(shared->files->size());
+  std::vector< BatchWorker > workers;
+  // nothing buffered may be written twice
+  fflush(NULL);
+  for (int i = 0; i < numberWorkers; i++) {
+    int toWorker[2];
+    int fromWorker[2];
+    if (pipe(toWorker))
+      break;
+    if (pipe(fromWorker)) {
+      close(toWorker[0]);
+      close(toWorker[1]);
+      break;
+    }
+    pid_t pid = fork();
+    if (pid < 0) {
+      close(toWorker[0]);
+      close(toWorker[1]);
+      close(fromWorker[0]);
+      close(fromWorker[1]);
+      break;
+    }
+    if (!pid) {
+      // worker - drop ends belonging to parent and earlier workers
+      close(toWorker[1]);
+      close(fromWorker[0]);
+      for (size_t j = 0; j < workers.size(); j++) {
+        if (workers[j].jobPipe >= 0)
+          close(workers[j].jobPipe);
+        close(workers[j].resultPipe);
+      }
+      workerProcess(shared, toWorker[0], fromWorker[1]);
+      _exit(0);
+    }
+    close(toWorker[0]);
+    close(fromWorker[1]);
+    BatchWorker worker;
+    worker.pid = pid;
+    worker.jobPipe = toWorker[1];
+    worker.resultPipe = fromWorker[0];
+    worker.job = -1;
+    workers.push_back(worker);
+  }
+  int numberStarted = static_cast< int >(workers.size());
+  if (!numberStarted)
+    return 0;
+  int nextJob = 0;
+  for (int i = 0; i < numberStarted; i++)
+    sendJob(workers[i], nextJob, numberJobs);
+  int numberActive = numberStarted;
+  std::vector< struct pollfd > polls(numberStarted);
+  while (numberActive) {
+    for (int i = 0; i < numberStarted; i++) {
+      polls[i].fd = workers[i].resultPipe;
+      polls[i].events = POLLIN;
+      polls[i].revents = 0;
+    }
+    if (poll(&polls[0], numberStarted, -1) < 0) {
+      if (errno == EINTR)
+        continue;
+      break;
+    }
+    for (int i = 0; i < numberStarted; i++) {
+      BatchWorker &worker = workers[i];
+      if (worker.resultPipe < 0 || !polls[i].revents)
+        continue;
+      BatchResult result;
+      if (readAll(worker.resultPipe, &result, sizeof(result)) && result.job == worker.job) {
+        reportResult(shared, result);
+        sendJob(worker, nextJob, numberJobs);
+        continue;
+      }
+      // worker finished or died - a job it had counts as failed
+      if (worker.job >= 0) {
+        memset(&result, 0, sizeof(result));
+        result.job = worker.job;
+        strcpy(result.status, "error");
+        reportResult(shared, result);
+      }
+      if (worker.jobPipe >= 0)
+        close(worker.jobPipe);
+      worker.jobPipe = -1;
+      close(worker.resultPipe);
+      worker.resultPipe = -1;
+      polls[i].fd = -1;
+      numberActive--;
+    }
+  }
+  for (int i = 0; i < numberStarted; i++) {
+    if (workers[i].jobPipe >= 0)
+      close(workers[i].jobPipe);
+    if (workers[i].resultPipe >= 0)
+      close(workers[i].resultPipe);
+    int status;
+    while (waitpid(workers[i].pid, &status, 0) < 0 && errno == EINTR)
+      ;
+  }
+  // anything never handed out (all workers died early)
+  if (nextJob < numberJobs)
+    solveSerial(shared, nextJob);
+  return numberStarted;
+}
+#endif
+
+} // namespace
+
+const char *CbcBatchStatus(CbcModel &model, int returnCode)
+{
+  if (returnCode && returnCode != 777)
+    return "error";
+  if (!model.getNumCols())
+    return "error";
+  if (model.isProvenOptimal())
+    return "optimal";
+  if (model.isProvenInfeasible())
+    return "infeasible";
+  if (model.isContinuousUnbounded())
+    return "unbounded";
+  if (model.isSecondsLimitReached())
+    return "time limit";
+  if (model.isNodeLimitReached())
+    return "node limit";
+  if (model.isSolutionLimitReached())
+    return "solution limit";
+  return "stopped";
+}
+
+int CbcBatchSolve(const std::string &manifest,
+  const std::deque< std::string > &options, int numberWorkers,
+  const std::string &resultsFile, CbcBatchSummary &summary)
+{
+  memset(&summary, 0, sizeof(summary));
+  std::vector< std::string > files;
+  if (!batchFiles(manifest, files) || !files.size())
+    return 1;
+  FILE *results = fopen(resultsFile.c_str(), "w");
+  if (!results)
+    return 2;
+  fprintf(results, "index,file,status,objective,bound,seconds,nodes\n");
+  double startTime = CoinGetTimeOfDay();
+  summary.numberModels = static_cast< int >(files.size());
+#ifdef CBC_BATCH_FORK
+  numberWorkers = std::max(1, std::min(numberWorkers, summary.numberModels));
+#else
+  numberWorkers = 1;
+#endif
+
+  BatchShared shared;
+  shared.files = &files;
+  shared.options = &options;
+  shared.results = results;
+  shared.summary = &summary;
+#ifdef CBC_BATCH_FORK
+  int numberStarted = 0;
+  if (numberWorkers > 1)
+    numberStarted = solveForked(&shared, numberWorkers);
+  if (numberStarted) {
+    numberWorkers = numberStarted;
+  } else {
+    numberWorkers = 1;
+    solveSerial(&shared, 0);
+  }
+#else
+  solveSerial(&shared, 0);
+#endif
+  summary.numberWorkers = numberWorkers;
+  summary.wallTime = CoinGetTimeOfDay() - startTime;
+  fclose(results);
+  return 0;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,69 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+/*! \file CbcSolverBatch.hpp
+    \brief Batch solve of many (small) models from the cbc command line.
+*/
+
+#ifndef CbcSolverBatch_H
+#define CbcSolverBatch_H
+
+#include <deque>
+#include <string>
+
+#include "CbcConfig.h"
+
+class CbcModel;
+
+/// Totals over a batch run
+typedef struct {
+  /// Number of models in batch
+  int numberModels;
+  /// Number proven optimal
+  int numberOptimal;
+  /// Number proven infeasible (or unbounded)
+  int numberInfeasible;
+  /// Number stopped on a limit
+  int numberStopped;
+  /// Number which could not be read or failed
+  int numberFailed;
+  /// Number of workers actually used
+  int numberWorkers;
+  /// Wall clock seconds for whole batch
+  double wallTime;
+  /// Sum over models of wall clock seconds
+  double sumTime;
+} CbcBatchSummary;
+
+/** Solves every model listed in manifest (one file name per line,
+    blank lines and lines starting with # ignored, relative names are
+    relative to manifest) or, if manifest is a directory, every model
+    file in it.
+
+    Each worker owns one solver, CbcModel and set of parameters, set up
+    once and reused for all the models it takes.  More than one worker
+    needs fork - each worker is then its own process, as CbcMain1 keeps
+    some state in globals.  A model is solved as
+    "-import file options -solve" so options are any cbc commands.
+
+    One line per model (index, file, status, objective, bound, seconds,
+    nodes) is appended to resultsFile as each model finishes.
+
+    Returns 0 if batch ran (whatever the model results), 1 if manifest
+    could not be read or was empty, 2 if results file could not be opened.
+*/
+int CbcBatchSolve(const std::string &manifest,
+  const std::deque< std::string > &options, int numberWorkers,
+  const std::string &resultsFile, CbcBatchSummary &summary);
+
+/** Short status of model after CbcMain1 returned returnCode -
+    "optimal", "infeasible", "unbounded", "time limit", "node limit",
+    "solution limit", "stopped" or "error".
+*/
+const char *CbcBatchStatus(CbcModel &model, int returnCode);
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
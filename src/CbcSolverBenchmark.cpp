@@ -0,0 +1,389 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+/*! \file CbcSolverBenchmark.cpp
+
+  Benchmark support for the miplib test (CbcClpUnitTest).  Each model
+  solved appends one CSV line to the file set by benchResults and
+  benchCompare reports the differences between two such files.
+*/
+
+#include "CbcConfig.h"
+#include "CoinPragma.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#if defined(__linux__)
+#include <unistd.h>
+#elif !defined(_MSC_VER)
+#include <sys/resource.h>
+#endif
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinTime.hpp"
+#include "CbcModel.hpp"
+#include "CbcSolverBatch.hpp"
+#include "CbcSolverBenchmark.hpp"
+
+namespace {
+
+#if defined(__linux__)
+// Peak resident memory (VmHWM) in megabytes
+double peakMemory()
+{
+  double value = 0.0;
+  FILE *fp = fopen("/proc/self/status", "r");
+  if (fp) {
+    char line[200];
+    while (fgets(line, sizeof(line), fp)) {
+      if (!strncmp(line, "VmHWM:", 6)) {
+        value = atof(line + 6) / 1024.0;
+        break;
+      }
+    }
+    fclose(fp);
+  }
+  return value;
+}
+
+// So peak is for this model only (ignored by old kernels)
+void resetPeakMemory()
+{
+  FILE *fp = fopen("/proc/self/clear_refs", "w");
+  if (fp) {
+    fputs("5", fp);
+    fclose(fp);
+  }
+}
+#elif !defined(_MSC_VER)
+// Peak for whole process as can not be reset
+double peakMemory()
+{
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage))
+    return 0.0;
+#if defined(__APPLE__)
+  return usage.ru_maxrss / 1048576.0;
+#else
+  return usage.ru_maxrss / 1024.0;
+#endif
+}
+
+void resetPeakMemory()
+{
+}
+#else
+double peakMemory()
+{
+  return 0.0;
+}
+
+void resetPeakMemory()
+{
+}
+#endif
+
+// Primal gap of value against optimum
+double primalGap(double value, double optimum)
+{
+  if (fabs(value - optimum) < 1.0e-9)
+    return 0.0;
+  if (value * optimum < 0.0)
+    return 1.0;
+  return CoinMin(1.0, fabs(value - optimum) / CoinMax(fabs(value), fabs(optimum)));
+}
+
+// Writes number or nothing if huge
+void writeNumber(FILE *fp, double value)
+{
+  if (value == value && fabs(value) < 1.0e50)
+    fprintf(fp, ",%.10g", value);
+  else
+    fprintf(fp, ",");
+}
+
+// Splits CSV line (no quoting is used)
+void splitLine(char *line, std::vector< char * > &fields)
+{
+  fields.clear();
+  char *start = line;
+  for (char *c = line;; c++) {
+    if (*c == ',' || *c == '\n' || *c == '\r' || !*c) {
+      bool last = *c != ',';
+      *c = '\0';
+      fields.push_back(start);
+      if (last)
+        break;
+      start = c + 1;
+    }
+  }
+}
+
+bool sameRun(const CbcBenchmarkResult &a, const CbcBenchmarkResult &b)
+{
+  return a.name == b.name && a.seed == b.seed && a.threads == b.threads;
+}
+
+// Shifted geometric mean accumulated as sum of logs
+struct ShiftedMean {
+  double shift;
+  double sumBase;
+  double sumNew;
+  int number;
+  void add(double base, double value)
+  {
+    sumBase += log(CoinMax(base, 0.0) + shift);
+    sumNew += log(CoinMax(value, 0.0) + shift);
+    number++;
+  }
+  double mean(double sum) const
+  {
+    return number ? exp(sum / number) - shift : 0.0;
+  }
+  double ratio() const
+  {
+    return number ? exp((sumNew - sumBase) / number) : 1.0;
+  }
+};
+
+} // namespace
+
+CbcBenchmarkRecorder::CbcBenchmarkRecorder()
+  : startTime_(0.0)
+  , startCpu_(0.0)
+{
+}
+
+CbcBenchmarkRecorder::~CbcBenchmarkRecorder()
+{
+}
+
+void CbcBenchmarkRecorder::start(CbcModel *)
+{
+  resetPeakMemory();
+  startTime_ = CoinGetTimeOfDay();
+  startCpu_ = CoinCpuTime() + CoinCpuTimeJustChildren();
+}
+
+void CbcBenchmarkRecorder::finish(CbcModel *model, const std::string &name,
+  double optimum, int returnCode, CbcBenchmarkResult &result)
+{
+  result.seconds = CoinGetTimeOfDay() - startTime_;
+  result.cpuSeconds = CoinCpuTime() + CoinCpuTimeJustChildren() - startCpu_;
+  result.name = name;
+  result.status = CbcBatchStatus(*model, returnCode);
+  result.seed = static_cast< int >(model->getRandomSeed());
+  result.threads = model->getNumberThreads();
+  result.hasSolution = model->bestSolution() != NULL;
+  result.objective = result.hasSolution ? model->getObjValue() : COIN_DBL_MAX;
+  result.nodes = model->getNodeCount();
+  result.iterations = model->getIterationCount();
+  result.strongIterations = model->numberStrongIterations();
+  result.checkSeconds = model->safeCheck().active() ? model->safeCheck().seconds() : -1.0;
+  result.rootBound = model->rootObjectiveAfterCuts() * model->getObjSense();
+  result.memory = peakMemory();
+  const CbcBoundHistory &history = model->boundHistory();
+  result.dualIntegral = history.dualIntegral();
+  result.firstSolution = history.timeToFirstSolution();
+  // primal integral against optimum (history is for minimization)
+  double endTime = history.searchTime();
+  if (optimum == -1.0e50 || fabs(optimum) >= 1.0e50) {
+    result.primalIntegral = history.primalIntegral();
+    return;
+  }
+  optimum *= model->getObjSense();
+  double integral = 0.0;
+  double lastTime = 0.0;
+  double lastGap = 1.0;
+  for (int i = 0; i < history.numberPrimal(); i++) {
+    double time = CoinMin(history.primalTime(i), endTime);
+    integral += lastGap * CoinMax(time - lastTime, 0.0);
+    lastTime = CoinMax(time, lastTime);
+    lastGap = primalGap(history.primalValue(i), optimum);
+  }
+  integral += lastGap * CoinMax(endTime - lastTime, 0.0);
+  result.primalIntegral = integral;
+}
+
+int CbcBenchmarkWrite(const std::string &fileName,
+  const CbcBenchmarkResult &result)
+{
+  bool needHeader = true;
+  FILE *fp = fopen(fileName.c_str(), "r");
+  if (fp) {
+    needHeader = fgetc(fp) == EOF;
+    fclose(fp);
+  }
+  fp = fopen(fileName.c_str(), "a");
+  if (!fp)
+    return 1;
+  if (needHeader)
+    fprintf(fp, "name,status,seed,threads,objective,seconds,cpu,nodes,"
+                "iterations,rootBound,primalIntegral,dualIntegral,firstSolution,"
+                "memory,strongIterations,checkSeconds\n");
+  fprintf(fp, "%s,%s,%d,%d", result.name.c_str(), result.status.c_str(),
+    result.seed, result.threads);
+  writeNumber(fp, result.hasSolution ? result.objective : COIN_DBL_MAX);
+  fprintf(fp, ",%.4f,%.4f,%d,%d", result.seconds, result.cpuSeconds,
+    result.nodes, result.iterations);
+  writeNumber(fp, result.rootBound);
+  fprintf(fp, ",%.6g,%.6g,%.4f,%.1f,%d,%.4f\n", result.primalIntegral,
+    result.dualIntegral, result.firstSolution, result.memory,
+    result.strongIterations, result.checkSeconds);
+  fclose(fp);
+  return 0;
+}
+
+bool CbcBenchmarkRead(const std::string &fileName,
+  std::vector< CbcBenchmarkResult > &results)
+{
+  results.clear();
+  FILE *fp = fopen(fileName.c_str(), "r");
+  if (!fp)
+    return false;
+  char line[1000];
+  std::vector< char * > fields;
+  while (fgets(line, sizeof(line), fp)) {
+    splitLine(line, fields);
+    if (fields.size() < 14 || !strcmp(fields[0], "name"))
+      continue;
+    CbcBenchmarkResult result;
+    result.name = fields[0];
+    result.status = fields[1];
+    result.seed = atoi(fields[2]);
+    result.threads = atoi(fields[3]);
+    result.hasSolution = fields[4][0] != '\0';
+    result.objective = result.hasSolution ? atof(fields[4]) : COIN_DBL_MAX;
+    result.seconds = atof(fields[5]);
+    result.cpuSeconds = atof(fields[6]);
+    result.nodes = atoi(fields[7]);
+    result.iterations = atoi(fields[8]);
+    result.rootBound = fields[9][0] ? atof(fields[9]) : -COIN_DBL_MAX;
+    result.primalIntegral = atof(fields[10]);
+    result.dualIntegral = atof(fields[11]);
+    result.firstSolution = atof(fields[12]);
+    result.memory = atof(fields[13]);
+    // older files do not have strong branching iterations
+    result.strongIterations = fields.size() > 14 ? atoi(fields[14]) : -1;
+    result.checkSeconds = fields.size() > 15 ? atof(fields[15]) : -1.0;
+    size_t i;
+    for (i = 0; i < results.size(); i++) {
+      if (sameRun(results[i], result))
+        break;
+    }
+    if (i < results.size())
+      results[i] = result;
+    else
+      results.push_back(result);
+  }
+  fclose(fp);
+  return true;
+}
+
+int CbcBenchmarkCompare(const std::string &baselineFile,
+  const std::string &resultsFile, double tolerance)
+{
+  std::vector< CbcBenchmarkResult > baseline;
+  std::vector< CbcBenchmarkResult > results;
+  if (!CbcBenchmarkRead(baselineFile, baseline)) {
+    printf("Unable to read benchmark baseline %s\n", baselineFile.c_str());
+    return -1;
+  }
+  if (!CbcBenchmarkRead(resultsFile, results)) {
+    printf("Unable to read benchmark results %s\n", resultsFile.c_str());
+    return -1;
+  }
+  ShiftedMean time = { 1.0, 0.0, 0.0, 0 };
+  ShiftedMean nodes = { 100.0, 0.0, 0.0, 0 };
+  ShiftedMean iterations = { 1000.0, 0.0, 0.0, 0 };
+  ShiftedMean strong = { 1000.0, 0.0, 0.0, 0 };
+  ShiftedMean integral = { 1.0, 0.0, 0.0, 0 };
+  int numberRegressions = 0;
+  int numberMissing = 0;
+  // overhead of safe checks in new runs
+  int numberChecked = 0;
+  double checkSeconds = 0.0;
+  double checkedSeconds = 0.0;
+  printf("%-16s %4s %3s %10s %10s %7s %7s %7s %7s %7s\n", "name", "seed", "thr",
+    "base s", "new s", "time", "nodes", "iters", "strong", "primal");
+  for (size_t i = 0; i < baseline.size(); i++) {
+    const CbcBenchmarkResult &base = baseline[i];
+    size_t j;
+    for (j = 0; j < results.size(); j++) {
+      if (sameRun(base, results[j]))
+        break;
+    }
+    if (j == results.size()) {
+      numberMissing++;
+      continue;
+    }
+    const CbcBenchmarkResult &now = results[j];
+    time.add(base.seconds, now.seconds);
+    nodes.add(base.nodes, now.nodes);
+    iterations.add(base.iterations, now.iterations);
+    double strongRatio = 1.0;
+    if (base.strongIterations >= 0 && now.strongIterations >= 0) {
+      strong.add(base.strongIterations, now.strongIterations);
+      strongRatio = (now.strongIterations + strong.shift) / (base.strongIterations + strong.shift);
+    }
+    integral.add(base.primalIntegral, now.primalIntegral);
+    if (now.checkSeconds >= 0.0) {
+      numberChecked++;
+      checkSeconds += now.checkSeconds;
+      checkedSeconds += now.seconds;
+    }
+    double timeRatio = (now.seconds + time.shift) / (base.seconds + time.shift);
+    const char *flag = "";
+    if (base.status == "optimal" && now.status != "optimal") {
+      flag = "  REGRESSION - not optimal";
+    } else if (base.hasSolution && !now.hasSolution) {
+      flag = "  REGRESSION - no solution";
+    } else if (base.status == "optimal" && now.status == "optimal" && fabs(base.objective - now.objective) > 1.0e-6 * CoinMax(1.0, fabs(base.objective))) {
+      flag = "  REGRESSION - different optimum";
+    } else if (timeRatio > 1.0 + tolerance) {
+      flag = "  REGRESSION - slower";
+    }
+    if (flag[0])
+      numberRegressions++;
+    printf("%-16s %4d %3d %10.2f %10.2f %7.3f %7.3f %7.3f %7.3f %7.3f%s\n",
+      base.name.c_str(), base.seed, base.threads, base.seconds, now.seconds,
+      timeRatio,
+      (now.nodes + nodes.shift) / (base.nodes + nodes.shift),
+      (now.iterations + iterations.shift) / (base.iterations + iterations.shift),
+      strongRatio,
+      (now.primalIntegral + integral.shift) / (base.primalIntegral + integral.shift),
+      flag);
+  }
+  printf("Shifted geometric means over %d runs (baseline, new, ratio)\n",
+    time.number);
+  printf("  time %.3f %.3f %.3f\n", time.mean(time.sumBase),
+    time.mean(time.sumNew), time.ratio());
+  printf("  nodes %.1f %.1f %.3f\n", nodes.mean(nodes.sumBase),
+    nodes.mean(nodes.sumNew), nodes.ratio());
+  printf("  iterations %.1f %.1f %.3f\n", iterations.mean(iterations.sumBase),
+    iterations.mean(iterations.sumNew), iterations.ratio());
+  if (strong.number)
+    printf("  strong branching iterations %.1f %.1f %.3f\n",
+      strong.mean(strong.sumBase), strong.mean(strong.sumNew), strong.ratio());
+  printf("  primal integral %.3f %.3f %.3f\n", integral.mean(integral.sumBase),
+    integral.mean(integral.sumNew), integral.ratio());
+  if (numberChecked)
+    printf("  safe checks in %d runs took %.3f seconds (%.2f%% of time)\n",
+      numberChecked, checkSeconds,
+      checkedSeconds > 0.0 ? 100.0 * checkSeconds / checkedSeconds : 0.0);
+  if (time.ratio() > 1.0 + tolerance) {
+    printf("REGRESSION - shifted geometric mean of time up by %.1f%%\n",
+      100.0 * (time.ratio() - 1.0));
+    numberRegressions++;
+  }
+  if (numberMissing)
+    printf("%d baseline runs not in %s\n", numberMissing, resultsFile.c_str());
+  printf("%d regressions\n", numberRegressions);
+  return numberRegressions;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
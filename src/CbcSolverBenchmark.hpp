@@ -0,0 +1,117 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+/*! \file CbcSolverBenchmark.hpp
+    \brief Benchmark results of the miplib test and comparison of two runs.
+*/
+
+#ifndef CbcSolverBenchmark_H
+#define CbcSolverBenchmark_H
+
+#include <string>
+#include <vector>
+
+#include "CbcConfig.h"
+
+class CbcModel;
+
+/// Result of one model in a benchmark run
+typedef struct {
+  /// Model name (as in miplib list)
+  std::string name;
+  /// "optimal", "time limit" etc as CbcBatchStatus
+  std::string status;
+  /// Random seed of model
+  int seed;
+  /// Number of threads
+  int threads;
+  /// Best objective (null in file if no solution)
+  double objective;
+  /// Wall clock seconds
+  double seconds;
+  /// Cpu seconds
+  double cpuSeconds;
+  /// Nodes
+  int nodes;
+  /// LP iterations
+  int iterations;
+  /// Objective at root after cuts
+  double rootBound;
+  /// Primal integral (gap seconds)
+  double primalIntegral;
+  /// Dual integral (gap seconds)
+  double dualIntegral;
+  /// Seconds to first solution (-1.0 if none)
+  double firstSolution;
+  /// Peak resident memory in megabytes (0.0 if not known)
+  double memory;
+  /// LP iterations in strong branching (-1 if not in file)
+  int strongIterations;
+  /// Seconds in safe checks (-1.0 if not done or not in file)
+  double checkSeconds;
+  /// True if solution found
+  bool hasSolution;
+} CbcBenchmarkResult;
+
+/** Collects what CbcModel does not keep for one model.
+
+    start resets peak memory where the system allows and finish fills in
+    the result.  The primal integral is from the incumbents in the model's
+    bound history but against the known optimum (if any) rather than the
+    final objective, so runs which stop early are not flattered.
+*/
+class CbcBenchmarkRecorder {
+public:
+  CbcBenchmarkRecorder();
+  ~CbcBenchmarkRecorder();
+
+  /// Before solve
+  void start(CbcModel *model);
+  /** After solve - optimum is known optimal value (-1.0e50 if not known)
+      and returnCode as from CbcMain1 (0 if not used) */
+  void finish(CbcModel *model, const std::string &name, double optimum,
+    int returnCode, CbcBenchmarkResult &result);
+
+private:
+  CbcBenchmarkRecorder(const CbcBenchmarkRecorder &);
+  CbcBenchmarkRecorder &operator=(const CbcBenchmarkRecorder &);
+  /// Wall clock at start
+  double startTime_;
+  /// Cpu at start
+  double startCpu_;
+};
+
+/** Appends result to CSV file, writing a header if file is new or empty.
+    Returns 0 if OK, 1 if file could not be opened. */
+int CbcBenchmarkWrite(const std::string &fileName,
+  const CbcBenchmarkResult &result);
+
+/** Reads results written by CbcBenchmarkWrite (for repeated name, seed and
+    threads the last line wins).  Returns false if file could not be read. */
+bool CbcBenchmarkRead(const std::string &fileName,
+  std::vector< CbcBenchmarkResult > &results);
+
+/** Compares results against baseline.
+
+    Runs are matched on name, seed and threads.  For each match the time,
+    node, iteration, strong branching iteration and primal integral ratios
+    are printed, and over all matches the ratios of shifted geometric means
+    (shifts 1 second, 100 nodes, 1000 iterations, 1000 strong branching
+    iterations and 1 for the primal integral) which is the usual way to
+    stop easy models dominating.  Strong branching iterations are there so
+    that two strong branching settings can be compared on the same models.
+
+    A model is flagged as a regression if it lost optimality, found a worse
+    objective or its shifted time grew by more than tolerance (e.g. 0.1 for
+    10%); so is the run if the shifted geometric mean of time did.
+
+    Returns number of regressions, -1 if either file could not be read.
+*/
+int CbcBenchmarkCompare(const std::string &baselineFile,
+  const std::string &resultsFile, double tolerance);
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
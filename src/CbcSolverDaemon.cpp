@@ -0,0 +1,853 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+/*! \file CbcSolverDaemon.cpp
+
+  Solver daemon for the cbc executable ("cbc -serve socket").  Small
+  models that need an answer quickly cannot afford exec, library load and
+  CbcMain0 setup per request.  Here one solver process per worker is
+  forked at start, while the daemon still has only one thread, and does
+  that setup once.  Worker threads take requests from a queue fed by one
+  thread per client connection and pass each to their solver process,
+  which solves it in a forked copy of itself - so it starts from the set
+  up model and solves are kept apart.  As the solver process has only
+  one thread it is safe to fork.  Progress comes from an event handler
+  which also stops the search if the client cancels, and is passed back
+  through the worker.  See CbcSolverDaemon.hpp for protocol.
+*/
+
+#include "CbcConfig.h"
+#include "CoinPragma.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <deque>
+#include <vector>
+
+#include "CbcSolverDaemon.hpp"
+
+#if defined(CBC_THREAD) && !defined(_WIN32)
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+
+#include "CoinTime.hpp"
+#include "CoinError.hpp"
+#include "OsiClpSolverInterface.hpp"
+#include "CbcModel.hpp"
+#include "CbcEventHandler.hpp"
+#include "CbcSolver.hpp"
+#include "CbcSolverBatch.hpp"
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+namespace {
+
+// One client connection
+struct DaemonConnection {
+  int socket;
+  // worker and connection thread both write
+  pthread_mutex_t writeMutex;
+};
+
+// One solve request
+struct DaemonJob {
+  int number;
+  DaemonConnection *connection;
+  std::string fileName;
+  std::deque< std::string > options;
+  // set by connection thread if client cancels or goes away
+  volatile bool cancelled;
+  // set by worker (under server mutex) when result has been sent
+  bool finished;
+  double startTime;
+};
+
+/* CbcMain1 keeps state in globals (as do some CbcModel statics and the
+   random number seed) so each solve runs in a process forked from the
+   solver process.  This is shared between the worker and the solve - the
+   worker sets cancelled, the solve fills in the rest. */
+struct DaemonOutcome {
+  volatile int cancelled;
+  int finished;
+  char status[20];
+  double objective;
+  double bound;
+  int nodes;
+  bool hasSolution;
+};
+
+// Solver process as seen from its worker
+struct DaemonSolver {
+  pid_t pid;
+  // socket to solver process - -1 if it has gone
+  int channel;
+  DaemonOutcome *outcome;
+};
+
+struct DaemonServer {
+  const std::deque< std::string > *options;
+  // only used to look up names of options sent by clients
+  CbcParameters *parameters;
+  std::string directory;
+  std::deque< DaemonJob * > queue;
+  std::vector< DaemonConnection * > connections;
+  pthread_mutex_t mutex;
+  // queue not empty or stopping
+  pthread_cond_t jobReady;
+  // job finished or connection closed
+  pthread_cond_t jobDone;
+  bool stopping;
+  int numberJobs;
+};
+
+// Worker thread argument
+struct DaemonWorkerInfo {
+  DaemonServer *server;
+  DaemonSolver *solver;
+};
+
+// Connection thread argument
+struct DaemonConnectionInfo {
+  DaemonServer *server;
+  DaemonConnection *connection;
+};
+
+bool sendSocket(int socket, const char *text)
+{
+  size_t length = strlen(text);
+  while (length) {
+    ssize_t n = send(socket, text, length, MSG_NOSIGNAL);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    text += n;
+    length -= n;
+  }
+  return true;
+}
+
+bool sendText(DaemonConnection *connection, const char *text)
+{
+  pthread_mutex_lock(&connection->writeMutex);
+  bool ok = sendSocket(connection->socket, text);
+  pthread_mutex_unlock(&connection->writeMutex);
+  return ok;
+}
+
+/* Reads up to newline (not stored) - buffer keeps anything read after it.
+   Returns false on end of file or error. */
+bool readLine(int socket, std::string &buffer, std::string &line)
+{
+  while (true) {
+    size_t newline = buffer.find('\n');
+    if (newline != std::string::npos) {
+      line = buffer.substr(0, newline);
+      if (line.size() && line[line.size() - 1] == '\r')
+        line.resize(line.size() - 1);
+      buffer.erase(0, newline + 1);
+      return true;
+    }
+    char chunk[4096];
+    ssize_t n = recv(socket, chunk, sizeof(chunk), 0);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    buffer.append(chunk, n);
+  }
+}
+
+// Progress and cancellation
+class CbcDaemonEventHandler : public CbcEventHandler {
+public:
+  CbcDaemonEventHandler(int number = 0, double startTime = 0.0,
+    int channel = -1, DaemonOutcome *outcome = NULL)
+    : CbcEventHandler()
+    , number_(number)
+    , startTime_(startTime)
+    , channel_(channel)
+    , outcome_(outcome)
+    , lastTime_(0.0)
+  {
+  }
+  CbcDaemonEventHandler(const CbcDaemonEventHandler &rhs)
+    : CbcEventHandler(rhs)
+    , number_(rhs.number_)
+    , startTime_(rhs.startTime_)
+    , channel_(rhs.channel_)
+    , outcome_(rhs.outcome_)
+    , lastTime_(rhs.lastTime_)
+  {
+  }
+  virtual CbcEventHandler *clone() const
+  {
+    return new CbcDaemonEventHandler(*this);
+  }
+  virtual CbcAction event(CbcEvent whichEvent)
+  {
+    // ignore small branch and bounds inside heuristics
+    if (!outcome_ || (model_->specialOptions() & 2048) != 0)
+      return noAction;
+    if (outcome_->cancelled)
+      return (whichEvent == node || whichEvent == treeStatus) ? stop : noAction;
+    bool newSolution = (whichEvent == solution || whichEvent == heuristicSolution);
+    double now = CoinGetTimeOfDay();
+    if (newSolution || ((whichEvent == node || whichEvent == treeStatus || whichEvent == afterRootCuts) && now > lastTime_ + 0.1)) {
+      lastTime_ = now;
+      char line[200];
+      char incumbent[40] = "-";
+      if (newSolution || model_->bestSolution())
+        sprintf(incumbent, "%.12g", model_->getObjValue());
+      sprintf(line, "progress %d %.3f %d %s %.12g\n", number_,
+        now - startTime_, model_->getNodeCount(), incumbent,
+        model_->getBestPossibleObjValue());
+      // worker passes it on
+      if (!sendSocket(channel_, line))
+        outcome_->cancelled = 1; // worker has gone
+    }
+    return noAction;
+  }
+
+private:
+  int number_;
+  double startTime_;
+  int channel_;
+  DaemonOutcome *outcome_;
+  double lastTime_;
+};
+
+// Runs in process forked from solver process - fills in outcome
+void solveRequest(int number, double startTime, const std::string &fileName,
+  const std::deque< std::string > &options,
+  const std::deque< std::string > &jobOptions, CbcModel &model,
+  CbcParameters &parameters, int channel, DaemonOutcome *outcome)
+{
+  model.resetModel();
+  CbcDaemonEventHandler handler(number, startTime, channel, outcome);
+  model.passInEventHandler(&handler);
+  std::deque< std::string > inputQueue;
+  inputQueue.push_back("-log");
+  inputQueue.push_back("0");
+  inputQueue.push_back("-import");
+  inputQueue.push_back(fileName);
+  inputQueue.insert(inputQueue.end(), options.begin(), options.end());
+  inputQueue.insert(inputQueue.end(), jobOptions.begin(), jobOptions.end());
+  inputQueue.push_back("-solve");
+  inputQueue.push_back("-quit");
+  int returnCode;
+  try {
+    returnCode = CbcMain1(inputQueue, model, parameters);
+  } catch (CoinError &e) {
+    returnCode = -1;
+  }
+  model.passInEventHandler(NULL);
+  strncpy(outcome->status, CbcBatchStatus(model, returnCode),
+    sizeof(outcome->status) - 1);
+  outcome->hasSolution = model.bestSolution() != NULL;
+  outcome->objective = model.getObjValue();
+  outcome->bound = model.getBestPossibleObjValue();
+  outcome->nodes = model.getNodeCount();
+  outcome->finished = 1;
+}
+
+/* Solver process - forked before any threads are started so it has only
+   one thread and may itself fork.  Reads requests from its worker
+
+     job <number> <start time>
+     <model file>
+     <option>
+     ...
+     (empty line)
+
+   and solves each in a forked copy of itself so every solve starts from
+   the model set up here.  The copy sends progress lines to the worker,
+   then this sends done once the copy has gone.  Exits when the worker
+   closes channel. */
+void runSolver(int channel, const std::deque< std::string > &options,
+  DaemonOutcome *outcome)
+{
+  // set up once and reused for every request
+  OsiClpSolverInterface solver;
+  CbcModel model(solver);
+  CbcParameters parameters;
+  CbcMain0(model, parameters);
+  parameters.disableWelcomePrinting();
+  parameters.disablePrinting();
+  model.setLogLevel(0);
+  std::string buffer;
+  std::string line;
+  while (readLine(channel, buffer, line)) {
+    int number = 0;
+    double startTime = 0.0;
+    std::string fileName;
+    std::deque< std::string > jobOptions;
+    if (sscanf(line.c_str(), "job %d %lf", &number, &startTime) != 2
+      || !readLine(channel, buffer, fileName))
+      break;
+    bool ok = true;
+    while ((ok = readLine(channel, buffer, line)) && line.size())
+      jobOptions.push_back(line);
+    if (!ok)
+      break;
+    pid_t pid = fork();
+    if (!pid) {
+      solveRequest(number, startTime, fileName, options, jobOptions,
+        model, parameters, channel, outcome);
+      _exit(0);
+    }
+    if (pid > 0) {
+      while (waitpid(pid, NULL, 0) < 0 && errno == EINTR)
+        ;
+    }
+    // outcome not finished if fork failed or solve died
+    if (!sendSocket(channel, "done\n"))
+      break;
+  }
+}
+
+void *doDaemonWorker(void *voidInfo)
+{
+  DaemonWorkerInfo *info = reinterpret_cast< DaemonWorkerInfo * >(voidInfo);
+  DaemonServer *server = info->server;
+  DaemonSolver *solver = info->solver;
+  std::string buffer;
+  while (true) {
+    pthread_mutex_lock(&server->mutex);
+    while (!server->queue.size() && !server->stopping)
+      pthread_cond_wait(&server->jobReady, &server->mutex);
+    if (!server->queue.size()) {
+      pthread_mutex_unlock(&server->mutex);
+      break;
+    }
+    DaemonJob *job = server->queue.front();
+    server->queue.pop_front();
+    pthread_mutex_unlock(&server->mutex);
+    char status[20] = "cancelled";
+    bool hasSolution = false;
+    double objectiveValue = 0.0;
+    double bound = -COIN_DBL_MAX;
+    int nodes = 0;
+    if (!job->cancelled) {
+      strcpy(status, "error");
+      DaemonOutcome *outcome = solver->outcome;
+      // solver process is idle so outcome can be reset
+      memset(outcome, 0, sizeof(DaemonOutcome));
+      char text[100];
+      sprintf(text, "job %d %.6f\n", job->number, job->startTime);
+      std::string request = text;
+      request += job->fileName + "\n";
+      for (size_t i = 0; i < job->options.size(); i++)
+        request += job->options[i] + "\n";
+      request += "\n";
+      bool done = false;
+      if (solver->channel >= 0 && sendSocket(solver->channel, request.c_str())) {
+        buffer.clear();
+        while (!done) {
+          if (job->cancelled)
+            outcome->cancelled = 1;
+          struct pollfd poller;
+          poller.fd = solver->channel;
+          poller.events = POLLIN;
+          poller.revents = 0;
+          int numberReady = poll(&poller, 1, 20);
+          if (numberReady < 0 && errno != EINTR)
+            break;
+          if (numberReady <= 0)
+            continue;
+          char chunk[4096];
+          ssize_t n = recv(solver->channel, chunk, sizeof(chunk), 0);
+          if (n < 0 && errno == EINTR)
+            continue;
+          if (n <= 0)
+            break;
+          buffer.append(chunk, n);
+          size_t newline;
+          while ((newline = buffer.find('\n')) != std::string::npos) {
+            std::string line = buffer.substr(0, newline + 1);
+            buffer.erase(0, newline + 1);
+            if (line == "done\n") {
+              done = true;
+              break;
+            }
+            if (!sendText(job->connection, line.c_str()))
+              job->cancelled = true; // client has gone
+          }
+        }
+      }
+      if (!done && solver->channel >= 0) {
+        // solver process has gone - nothing more can be solved here
+        close(solver->channel);
+        solver->channel = -1;
+      }
+      if (done && outcome->finished) {
+        if (!job->cancelled && !outcome->cancelled)
+          strcpy(status, outcome->status);
+        else
+          strcpy(status, "cancelled");
+        hasSolution = outcome->hasSolution;
+        objectiveValue = outcome->objective;
+        bound = outcome->bound;
+        nodes = outcome->nodes;
+      }
+    }
+    char line[300];
+    char objective[40] = "-";
+    if (hasSolution)
+      sprintf(objective, "%.12g", objectiveValue);
+    // bound as for minimization with nothing known if never started
+    sprintf(line, "result %d %s %s %.12g %.3f %d\n", job->number,
+      status, objective, bound, CoinGetTimeOfDay() - job->startTime, nodes);
+    sendText(job->connection, line);
+    pthread_mutex_lock(&server->mutex);
+    job->finished = true;
+    pthread_cond_broadcast(&server->jobDone);
+    pthread_mutex_unlock(&server->mutex);
+  }
+  // solver process exits when it sees end of file
+  if (solver->channel >= 0) {
+    close(solver->channel);
+    solver->channel = -1;
+  }
+  return NULL;
+}
+
+/* Options from a client may only set values - anything which reads or
+   writes files or runs an action (import, export, solu, batch, serve,
+   stdin ...) would do so as the daemon user.  So every option must be
+   a known parameter of double, integer or keyword type followed by
+   its value.  Returns false (with offending option) if not allowed. */
+bool allowedOptions(DaemonServer *server,
+  const std::deque< std::string > &options, std::string &bad)
+{
+  CbcParameters &parameters = *server->parameters;
+  ClpParameters &clpParameters = parameters.clpParameters();
+  for (size_t i = 0; i < options.size(); i++) {
+    bad = options[i];
+    if (bad.size() < 2 || bad[0] != '-' || bad.find('?') != std::string::npos)
+      return false;
+    std::string field = bad.substr(1);
+    int numberClpMatches = 0, numberClpShortMatches = 0, numberClpQuery = 0;
+    int clpParamCode = CoinParamUtils::lookupParam(field,
+      clpParameters.paramVec(), &numberClpMatches, &numberClpShortMatches,
+      &numberClpQuery);
+    int numberCbcMatches = 0, numberCbcShortMatches = 0, numberCbcQuery = 0;
+    int cbcParamCode = CoinParamUtils::lookupParam(field,
+      parameters.paramVec(), &numberCbcMatches, &numberCbcShortMatches,
+      &numberCbcQuery);
+    if (!(numberClpMatches + numberCbcMatches) || numberClpQuery + numberCbcQuery)
+      return false;
+    CoinParam::CoinParamType type;
+    if (cbcParamCode >= 0)
+      type = parameters[cbcParamCode]->type();
+    else if (clpParamCode >= 0)
+      type = clpParameters[clpParamCode]->type();
+    else
+      return false;
+    if (type != CoinParam::paramDbl && type != CoinParam::paramInt
+      && type != CoinParam::paramKwd)
+      return false;
+    // value - which must not look like another option
+    if (++i == options.size())
+      return false;
+    const char *value = options[i].c_str();
+    if (value[0] == '-') {
+      char *end;
+      strtod(value, &end);
+      if (*end) {
+        bad = options[i];
+        return false;
+      }
+    }
+  }
+  bad.clear();
+  return true;
+}
+
+// Reads model into a file of its own - returns false on failure
+bool receiveModel(DaemonServer *server, DaemonConnection *connection,
+  std::string &buffer, long bytes, const std::string &format, int number,
+  std::string &fileName)
+{
+  char name[80];
+  sprintf(name, "/cbcd-%d-%d.%s", static_cast< int >(getpid()), number,
+    format.c_str());
+  fileName = server->directory + name;
+  int fd = open(fileName.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0600);
+  if (fd < 0)
+    return false;
+  bool ok = true;
+  while (bytes > 0 && ok) {
+    if (!buffer.size()) {
+      char chunk[65536];
+      ssize_t n = recv(connection->socket, chunk, sizeof(chunk), 0);
+      if (n < 0 && errno == EINTR)
+        continue;
+      if (n <= 0) {
+        ok = false;
+        break;
+      }
+      buffer.append(chunk, n);
+    }
+    size_t use = bytes < static_cast< long >(buffer.size()) ? static_cast< size_t >(bytes) : buffer.size();
+    if (write(fd, buffer.data(), use) != static_cast< ssize_t >(use))
+      ok = false;
+    buffer.erase(0, use);
+    bytes -= use;
+  }
+  if (close(fd))
+    ok = false;
+  if (!ok)
+    unlink(fileName.c_str());
+  return ok;
+}
+
+void *doDaemonConnection(void *voidInfo)
+{
+  DaemonConnectionInfo *info = reinterpret_cast< DaemonConnectionInfo * >(voidInfo);
+  DaemonServer *server = info->server;
+  DaemonConnection *connection = info->connection;
+  delete info;
+  std::string buffer;
+  std::string line;
+  while (readLine(connection->socket, buffer, line)) {
+    char command[20] = "";
+    sscanf(line.c_str(), "%19s", command);
+    if (!strcmp(command, "ping")) {
+      sendText(connection, "pong\n");
+      continue;
+    } else if (!strcmp(command, "shutdown")) {
+      pthread_mutex_lock(&server->mutex);
+      server->stopping = true;
+      pthread_cond_broadcast(&server->jobReady);
+      pthread_mutex_unlock(&server->mutex);
+      break;
+    } else if (!strcmp(command, "cancel")) {
+      // nothing running on this connection
+      continue;
+    } else if (strcmp(command, "solve")) {
+      sendText(connection, "error unknown request\n");
+      continue;
+    }
+    // solve <bytes> <format> [options]
+    long bytes = -1;
+    char format[20] = "";
+    int used = 0;
+    sscanf(line.c_str(), "%*s %ld %19s %n", &bytes, format, &used);
+    std::string fileFormat = format;
+    if (bytes < 0 || !used || (fileFormat != "mps" && fileFormat != "mps.gz" && fileFormat != "lp" && fileFormat != "cbcb")) {
+      sendText(connection, "error expected solve <bytes> <mps|mps.gz|lp|cbcb> [options]\n");
+      break;
+    }
+    DaemonJob job;
+    pthread_mutex_lock(&server->mutex);
+    job.number = ++server->numberJobs;
+    bool stopping = server->stopping;
+    pthread_mutex_unlock(&server->mutex);
+    if (stopping) {
+      sendText(connection, "error shutting down\n");
+      break;
+    }
+    job.connection = connection;
+    job.cancelled = false;
+    job.finished = false;
+    job.startTime = CoinGetTimeOfDay();
+    if (!receiveModel(server, connection, buffer, bytes, fileFormat,
+          job.number, job.fileName)) {
+      sendText(connection, "error could not receive model\n");
+      break;
+    }
+    const char *options = line.c_str() + used;
+    char option[1024];
+    int length;
+    while (sscanf(options, "%1023s%n", option, &length) == 1) {
+      job.options.push_back(option);
+      options += length;
+    }
+    std::string badOption;
+    pthread_mutex_lock(&server->mutex);
+    bool allowed = allowedOptions(server, job.options, badOption);
+    pthread_mutex_unlock(&server->mutex);
+    if (!allowed) {
+      unlink(job.fileName.c_str());
+      std::string text = "error option not allowed " + badOption + "\n";
+      sendText(connection, text.c_str());
+      continue;
+    }
+    char accepted[40];
+    sprintf(accepted, "accepted %d\n", job.number);
+    sendText(connection, accepted);
+    pthread_mutex_lock(&server->mutex);
+    server->queue.push_back(&job);
+    pthread_cond_signal(&server->jobReady);
+    pthread_mutex_unlock(&server->mutex);
+    // wait for result - watching for cancel
+    bool finished = false;
+    bool clientGone = false;
+    // next request already here - leave it in buffer
+    bool nextRequest = false;
+    while (!finished) {
+      if (!clientGone && !nextRequest) {
+        struct pollfd poller;
+        poller.fd = connection->socket;
+        poller.events = POLLIN;
+        poller.revents = 0;
+        if (poll(&poller, 1, 20) > 0) {
+          char chunk[4096];
+          ssize_t n = recv(connection->socket, chunk, sizeof(chunk), 0);
+          if (n == 0 || (n < 0 && errno != EINTR)) {
+            clientGone = true;
+            job.cancelled = true;
+          } else if (n > 0) {
+            buffer.append(chunk, n);
+            size_t newline;
+            while ((newline = buffer.find('\n')) != std::string::npos) {
+              if (buffer.compare(0, 6, "cancel")) {
+                nextRequest = true;
+                break;
+              }
+              job.cancelled = true;
+              buffer.erase(0, newline + 1);
+            }
+          }
+        }
+      }
+      pthread_mutex_lock(&server->mutex);
+      if (job.cancelled && !job.finished) {
+        // if still queued move to front so result is sent at once
+        for (size_t i = 1; i < server->queue.size(); i++) {
+          if (server->queue[i] == &job) {
+            server->queue.erase(server->queue.begin() + i);
+            server->queue.push_front(&job);
+            break;
+          }
+        }
+      }
+      // nothing more to read so just wait
+      if ((clientGone || nextRequest) && !job.finished)
+        pthread_cond_wait(&server->jobDone, &server->mutex);
+      finished = job.finished;
+      pthread_mutex_unlock(&server->mutex);
+    }
+    unlink(job.fileName.c_str());
+    if (clientGone)
+      break;
+  }
+  shutdown(connection->socket, SHUT_RDWR);
+  close(connection->socket);
+  pthread_mutex_lock(&server->mutex);
+  for (size_t i = 0; i < server->connections.size(); i++) {
+    if (server->connections[i] == connection) {
+      server->connections.erase(server->connections.begin() + i);
+      break;
+    }
+  }
+  pthread_cond_broadcast(&server->jobDone);
+  pthread_mutex_unlock(&server->mutex);
+  pthread_mutex_destroy(&connection->writeMutex);
+  delete connection;
+  return NULL;
+}
+
+} // namespace
+
+int CbcDaemonServe(const std::string &socketPath,
+  const std::deque< std::string > &options, int numberWorkers)
+{
+  struct sockaddr_un address;
+  if (socketPath.size() >= sizeof(address.sun_path))
+    return 1;
+  int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listener < 0)
+    return 1;
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  strcpy(address.sun_path, socketPath.c_str());
+  // only ever remove an old socket - never some other file
+  struct stat info;
+  if (!lstat(socketPath.c_str(), &info)) {
+    if (!S_ISSOCK(info.st_mode)) {
+      close(listener);
+      return 1;
+    }
+    unlink(socketPath.c_str());
+  }
+  // only daemon user may connect
+  mode_t saveMask = umask(0177);
+  int bindStatus = bind(listener, reinterpret_cast< struct sockaddr * >(&address), sizeof(address));
+  umask(saveMask);
+  if (bindStatus || chmod(socketPath.c_str(), 0600)
+    || lstat(socketPath.c_str(), &info) || listen(listener, 64)) {
+    close(listener);
+    return 1;
+  }
+  ino_t socketInode = info.st_ino;
+  signal(SIGPIPE, SIG_IGN);
+
+  CbcParameters parameters;
+  DaemonServer server;
+  server.options = &options;
+  server.parameters = &parameters;
+  // temporary model files next to socket
+  size_t slash = socketPath.find_last_of('/');
+  server.directory = slash != std::string::npos ? socketPath.substr(0, slash) : std::string(".");
+  if (!server.directory.size())
+    server.directory = "/";
+  server.stopping = false;
+  server.numberJobs = 0;
+  numberWorkers = numberWorkers > 0 ? numberWorkers : 1;
+  /* solver processes must be forked now - forking once other threads
+     are running could leave a lock held in the copy */
+  std::vector< DaemonSolver > solvers(numberWorkers);
+  for (int i = 0; i < numberWorkers; i++) {
+    solvers[i].pid = -1;
+    solvers[i].channel = -1;
+    solvers[i].outcome = NULL;
+  }
+  bool solversOk = true;
+  for (int i = 0; i < numberWorkers; i++) {
+    DaemonSolver &solver = solvers[i];
+    solver.outcome = reinterpret_cast< DaemonOutcome * >(
+      mmap(NULL, sizeof(DaemonOutcome), PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_ANONYMOUS, -1, 0));
+    int channels[2];
+    if (solver.outcome == MAP_FAILED || socketpair(AF_UNIX, SOCK_STREAM, 0, channels)) {
+      solversOk = false;
+      break;
+    }
+    memset(solver.outcome, 0, sizeof(DaemonOutcome));
+    solver.pid = fork();
+    if (!solver.pid) {
+      // only keep own end of own channel
+      close(listener);
+      for (int j = 0; j < i; j++)
+        close(solvers[j].channel);
+      close(channels[0]);
+      runSolver(channels[1], options, solver.outcome);
+      _exit(0);
+    }
+    close(channels[1]);
+    if (solver.pid < 0) {
+      close(channels[0]);
+      solversOk = false;
+      break;
+    }
+    solver.channel = channels[0];
+  }
+  if (!solversOk) {
+    for (int i = 0; i < numberWorkers; i++) {
+      DaemonSolver &solver = solvers[i];
+      if (solver.channel >= 0)
+        close(solver.channel);
+      if (solver.pid > 0) {
+        while (waitpid(solver.pid, NULL, 0) < 0 && errno == EINTR)
+          ;
+      }
+      if (solver.outcome && solver.outcome != MAP_FAILED)
+        munmap(solver.outcome, sizeof(DaemonOutcome));
+    }
+    close(listener);
+    unlink(socketPath.c_str());
+    return 1;
+  }
+  pthread_mutex_init(&server.mutex, NULL);
+  pthread_cond_init(&server.jobReady, NULL);
+  pthread_cond_init(&server.jobDone, NULL);
+  std::vector< DaemonWorkerInfo > workerInfo(numberWorkers);
+  std::vector< pthread_t > workers(numberWorkers);
+  for (int i = 0; i < numberWorkers; i++) {
+    workerInfo[i].server = &server;
+    workerInfo[i].solver = &solvers[i];
+    pthread_create(&workers[i], NULL, doDaemonWorker, &workerInfo[i]);
+  }
+
+  while (true) {
+    pthread_mutex_lock(&server.mutex);
+    bool stopping = server.stopping;
+    pthread_mutex_unlock(&server.mutex);
+    if (stopping)
+      break;
+    // wake up now and then to see if stopping
+    struct pollfd poller;
+    poller.fd = listener;
+    poller.events = POLLIN;
+    poller.revents = 0;
+    if (poll(&poller, 1, 200) <= 0)
+      continue;
+    int client = accept(listener, NULL, NULL);
+    if (client < 0)
+      continue;
+    DaemonConnection *connection = new DaemonConnection;
+    connection->socket = client;
+    pthread_mutex_init(&connection->writeMutex, NULL);
+    DaemonConnectionInfo *info = new DaemonConnectionInfo;
+    info->server = &server;
+    info->connection = connection;
+    pthread_mutex_lock(&server.mutex);
+    server.connections.push_back(connection);
+    pthread_mutex_unlock(&server.mutex);
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, doDaemonConnection, info)) {
+      pthread_mutex_lock(&server.mutex);
+      server.connections.pop_back();
+      pthread_mutex_unlock(&server.mutex);
+      close(client);
+      pthread_mutex_destroy(&connection->writeMutex);
+      delete connection;
+      delete info;
+    } else {
+      pthread_detach(thread);
+    }
+  }
+  close(listener);
+  // unless replaced meanwhile
+  if (!lstat(socketPath.c_str(), &info) && S_ISSOCK(info.st_mode)
+    && info.st_ino == socketInode)
+    unlink(socketPath.c_str());
+  // let running solves finish, close idle connections
+  for (int i = 0; i < numberWorkers; i++)
+    pthread_join(workers[i], NULL);
+  for (int i = 0; i < numberWorkers; i++) {
+    while (waitpid(solvers[i].pid, NULL, 0) < 0 && errno == EINTR)
+      ;
+    munmap(solvers[i].outcome, sizeof(DaemonOutcome));
+  }
+  pthread_mutex_lock(&server.mutex);
+  for (size_t i = 0; i < server.connections.size(); i++)
+    shutdown(server.connections[i]->socket, SHUT_RDWR);
+  while (server.connections.size())
+    pthread_cond_wait(&server.jobDone, &server.mutex);
+  pthread_mutex_unlock(&server.mutex);
+  pthread_cond_destroy(&server.jobDone);
+  pthread_cond_destroy(&server.jobReady);
+  pthread_mutex_destroy(&server.mutex);
+  return 0;
+}
+
+#else
+
+int CbcDaemonServe(const std::string &, const std::deque< std::string > &,
+  int)
+{
+  return -1;
+}
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
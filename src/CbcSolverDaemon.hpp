@@ -0,0 +1,64 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+/*! \file CbcSolverDaemon.hpp
+    \brief Long lived solver serving requests on a Unix-domain socket.
+
+  Protocol - all lines end in newline.  A connection can carry any number
+  of requests, one at a time.
+
+  Client sends
+
+    solve <bytes> <format> [cbc options]
+        followed by exactly <bytes> bytes of model.  format is one of
+        mps, mps.gz, lp or cbcb.  Options are cbc parameters applied
+        after import, e.g. "solve 1830 mps -sec 5 -cuts off".  Only
+        parameters which set a number or keyword are allowed - no
+        actions or file names.
+    cancel
+        while a solve is running - stops it at the next opportunity.
+    ping
+    shutdown
+        stops server once running solves have finished.
+
+  Server replies
+
+    accepted <job>
+    progress <job> <seconds> <nodes> <incumbent or -> <bound>
+        at most every 0.1 seconds and whenever a solution is found.
+    result <job> <status> <objective or -> <bound> <seconds> <nodes>
+        status is as CbcBatchStatus or "cancelled".
+    pong
+    error <message>
+*/
+
+#ifndef CbcSolverDaemon_H
+#define CbcSolverDaemon_H
+
+#include <deque>
+#include <string>
+
+#include "CbcConfig.h"
+
+/** Serves solve requests on socketPath (an existing socket there is
+    removed, any other file is left alone and an error returned) with
+    numberWorkers workers.  Each worker has a solver process, forked
+    before any threads are started, which owns a CbcModel and parameters
+    set up once and solves each request in a forked copy of itself.  The
+    socket is only accessible by the daemon user (mode 0600).  options
+    are applied to every model before the options in the request.
+    Returns when a shutdown request arrives.
+
+    Must be called before the program starts any threads.
+
+    Returns 0 after shutdown, 1 if socket or solver processes could not
+    be set up, -1 if not available (needs POSIX and CBC_THREAD).
+*/
+int CbcDaemonServe(const std::string &socketPath,
+  const std::deque< std::string > &options, int numberWorkers);
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -19,11 +19,16 @@
 #include <algorithm>
 #include <ostream>
 #include <iterator>
+#include <set>
 
 #include "CbcSymmetry.hpp"
 #include "CbcBranchingObject.hpp"
 #include "CbcSimpleInteger.hpp"
 #include "CoinTime.hpp"
+#ifdef CBC_NAUTY_BUILTIN
+// only used to estimate size of dense graph
+#define WORDSIZE 32
+#endif
 #define NAUTY_MAX_LEVEL 0
 #if NAUTY_MAX_LEVEL
 extern int nauty_maxalllevel;
@@ -57,7 +62,7 @@ static int maxLevel = 0;
 static char message_[200];
 static CbcSymmetry * baseSymmetry=NULL;
 static void
-userlevelproc(int *lab, int *ptn, int level, int *orbits, statsblk *stats,
+userlevelproc(int *lab, int *ptn, int level, int *orbits, CbcNautyStats *stats,
   int tv, int index, int tcellsize,
   int numcells, int childcount, int n)
 {
@@ -66,9 +71,12 @@ userlevelproc(int *lab, int *ptn, int level, int *orbits, statsblk *stats,
     sprintf(message_,"Nauty:: level %d after %d calls", level, calls);
     maxLevel = level;
   }
+  // built-in search has its own limit on work
+#ifndef CBC_NAUTY_BUILTIN
   if (level > 1500) {
     throw CoinError("May take too long", "", "CbcSymmetry");
   }
+#endif
   //}
   return;
 }
@@ -232,6 +240,17 @@ int CbcSymmetry::statsOrbits(CbcModel *model, int type) const
   bool printSomething = true;
   if (type == 1 && (model->moreSpecialOptions2()&(131072|262144)) != 131072) 
     return 0;
+  if (type && orbitopes_.size()) {
+    if (orbitopeSucceeded_ + orbitopeInfeasible_ > lastOrbitopeSucceeded_) {
+      sprintf(general, "Orbitopal fixing called %d times - fixed %g variables (%d to one) in %d calls, %d nodes infeasible",
+        orbitopeCalls_, orbitopeFixes_, orbitopeFixesToOne_,
+        orbitopeSucceeded_, orbitopeInfeasible_);
+      model->messageHandler()->message(CBC_GENERAL, model->messages())
+        << general << CoinMessageEol;
+      lastOrbitopeSucceeded_ = orbitopeSucceeded_ + orbitopeInfeasible_;
+    }
+    return 0;
+  }
   if (type) {
     double branchSuccess = 0.0;
     if (nautyBranchSucceeded_)
@@ -270,6 +289,12 @@ int CbcSymmetry::statsOrbits(CbcModel *model, int type) const
           nauty_info_->getNumGenerators(),
           nauty_info_->getGroupSize(),
           stats_[1], nautyTime_);
+#ifdef CBC_NAUTY_BUILTIN
+        strcat(general, " (built-in search");
+        if (nauty_info_->stats()->incomplete)
+          strcat(general, " - stopped early so group may be larger");
+        strcat(general, ")");
+#endif
       } else {
 	int options2 = model->moreSpecialOptions2();
         if ((options2 & (128 | 256)) != (128 | 256)) {
@@ -347,6 +372,11 @@ CbcSymmetry::adjustStats(const CbcSymmetry * other)
   nautyFixSucceeded_ += other->nautyFixSucceeded_;
   nautyBranchCalls_ += other->nautyBranchCalls_;
   nautyBranchSucceeded_ += other->nautyBranchSucceeded_;
+  orbitopeFixes_ += other->orbitopeFixes_;
+  orbitopeFixesToOne_ += other->orbitopeFixesToOne_;
+  orbitopeCalls_ += other->orbitopeCalls_;
+  orbitopeSucceeded_ += other->orbitopeSucceeded_;
+  orbitopeInfeasible_ += other->orbitopeInfeasible_;
 }
 
 void CbcSymmetry::Print_Orbits(int type) const
@@ -1565,6 +1595,385 @@ int CbcSymmetry::orbitalFixing(OsiSolverInterface *solver)
   }
   return n;
 }
+// Root of union-find tree (with path halving)
+static int orbitopeRoot(std::vector< int > &parent, int i)
+{
+  while (parent[i] != i) {
+    parent[i] = parent[parent[i]];
+    i = parent[i];
+  }
+  return i;
+}
+/* Looks for packing/partitioning orbitopes in stored generators.
+
+   Only generators which just swap pairs of variables are used.  Classes
+   of variables swapped by these are candidate rows and a row is kept if
+   its variables are 0-1 and in a constraint which allows at most one of
+   them to be one.  The first row gives column numbers and the action of
+   a generator on it is a swap of two columns (or nothing).  Another row
+   is kept if its variables can be matched to columns so that every
+   generator acts on it the same way.  As the swaps on the first row
+   connect all its variables they generate every permutation of columns.
+*/
+int CbcSymmetry::findOrbitopes(CbcModel *model)
+{
+  orbitopes_.clear();
+  OsiSolverInterface *solver = model->continuousSolver();
+  if (!solver)
+    solver = model->solver();
+  const double *columnLower = solver->getColLower();
+  const double *columnUpper = solver->getColUpper();
+  const double *rowLower = solver->getRowLower();
+  const double *rowUpper = solver->getRowUpper();
+  const CoinPackedMatrix *matrixByColumn = solver->getMatrixByCol();
+  const int *row = matrixByColumn->getIndices();
+  const CoinBigIndex *columnStart = matrixByColumn->getVectorStarts();
+  const int *columnLength = matrixByColumn->getVectorLengths();
+  const CoinPackedMatrix *matrixByRow = solver->getMatrixByRow();
+  const int *column = matrixByRow->getIndices();
+  const double *elementByRow = matrixByRow->getElements();
+  const CoinBigIndex *rowStart = matrixByRow->getVectorStarts();
+  const int *rowLength = matrixByRow->getVectorLengths();
+  std::vector< int > generators;
+  for (int iPerm = 0; iPerm < numberPermutations_; iPerm++) {
+    if (permutations_[iPerm].numberPerms && permutations_[iPerm].numberInPerm == 2)
+      generators.push_back(iPerm);
+  }
+  int numberGenerators = static_cast< int >(generators.size());
+  if (!numberGenerators)
+    return 0;
+  // variables in same class (row) and generators in same component
+  std::vector< int > rowParent(numberColumns_);
+  std::vector< int > parent(numberColumns_ + numberGenerators);
+  for (int i = 0; i < numberColumns_; i++)
+    rowParent[i] = i;
+  for (int i = 0; i < numberColumns_ + numberGenerators; i++)
+    parent[i] = i;
+  for (int k = 0; k < numberGenerators; k++) {
+    const int *orbit = permutations_[generators[k]].orbits;
+    for (int i = 0; i < numberColumns_; i++) {
+      if (orbit[i] > i) {
+        rowParent[orbitopeRoot(rowParent, i)] = orbitopeRoot(rowParent, orbit[i]);
+        parent[orbitopeRoot(parent, i)] = orbitopeRoot(parent, numberColumns_ + k);
+        parent[orbitopeRoot(parent, orbit[i])] = orbitopeRoot(parent, numberColumns_ + k);
+      }
+    }
+  }
+  // members of each class
+  std::vector< std::vector< int > > members(numberColumns_);
+  for (int i = 0; i < numberColumns_; i++)
+    members[orbitopeRoot(rowParent, i)].push_back(i);
+  for (int i = 0; i < numberColumns_; i++) {
+    if (members[i].size() == 1)
+      members[i].clear(); // not moved
+  }
+  // rows which are packing (1) or partitioning (2)
+  std::vector< int > rowType(numberColumns_, 0);
+  std::vector< int > mark(numberColumns_, -1);
+  for (int iClass = 0; iClass < numberColumns_; iClass++) {
+    const std::vector< int > &which = members[iClass];
+    int n = static_cast< int >(which.size());
+    if (!n)
+      continue;
+    bool binary = true;
+    for (int k = 0; k < n; k++) {
+      int iColumn = which[k];
+      if (!solver->isInteger(iColumn) || columnLower[iColumn] || columnUpper[iColumn] != 1.0)
+        binary = false;
+      mark[iColumn] = iClass;
+    }
+    if (!binary)
+      continue;
+    int iColumn = which[0];
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+      int iRow = row[j];
+      if (rowUpper[iRow] > 1.0 + 1.0e-9)
+        continue;
+      int nIn = 0;
+      bool good = true;
+      for (CoinBigIndex jj = rowStart[iRow];
+           jj < rowStart[iRow] + rowLength[iRow]; jj++) {
+        int jColumn = column[jj];
+        double value = elementByRow[jj];
+        if (mark[jColumn] == iClass && value == 1.0) {
+          nIn++;
+        } else if ((value > 0.0 && columnLower[jColumn] < 0.0) || (value < 0.0 && columnUpper[jColumn] > 0.0)) {
+          // rest of row could be negative
+          good = false;
+          break;
+        }
+      }
+      if (good && nIn == n) {
+        if (rowLength[iRow] == n && rowLower[iRow] >= 1.0 - 1.0e-9) {
+          rowType[iClass] = 2;
+          break;
+        }
+        rowType[iClass] = 1;
+      }
+    }
+  }
+  // look at each component
+  std::vector< bool > done(numberGenerators, false);
+  std::vector< int > position(numberColumns_, -1);
+  for (int k0 = 0; k0 < numberGenerators; k0++) {
+    if (done[k0])
+      continue;
+    int component = orbitopeRoot(parent, numberColumns_ + k0);
+    std::vector< int > gens;
+    for (int k = k0; k < numberGenerators; k++) {
+      if (orbitopeRoot(parent, numberColumns_ + k) == component) {
+        done[k] = true;
+        gens.push_back(k);
+      }
+    }
+    // first row is packing row with smallest index
+    int firstRow = -1;
+    for (int i = 0; i < numberColumns_; i++) {
+      if (members[i].size() && rowType[i] && orbitopeRoot(parent, i) == component) {
+        int iClass = orbitopeRoot(rowParent, i);
+        if (firstRow < 0 || members[iClass][0] < members[firstRow][0])
+          firstRow = iClass;
+      }
+    }
+    if (firstRow < 0)
+      continue;
+    const std::vector< int > &first = members[firstRow];
+    int numberOrbitColumns = static_cast< int >(first.size());
+    // action on columns (-1 if does not move first row)
+    int numberGens = static_cast< int >(gens.size());
+    std::vector< int > swap1(numberGens, -1);
+    std::vector< int > swap2(numberGens, -1);
+    bool good = true;
+    for (int k = 0; k < numberOrbitColumns; k++)
+      position[first[k]] = k;
+    for (int k = 0; k < numberGens && good; k++) {
+      const int *orbit = permutations_[generators[gens[k]]].orbits;
+      for (int j = 0; j < numberOrbitColumns; j++) {
+        if (orbit[first[j]] >= 0) {
+          if (swap1[k] < 0) {
+            swap1[k] = j;
+            swap2[k] = position[orbit[first[j]]];
+          } else if (j != swap2[k]) {
+            good = false; // moves more than two columns
+            break;
+          }
+        }
+      }
+    }
+    for (int k = 0; k < numberOrbitColumns; k++)
+      position[first[k]] = -1;
+    if (!good)
+      continue;
+    cbc_orbitope orbitope;
+    orbitope.numberRows = 0;
+    orbitope.numberColumns = numberOrbitColumns;
+    orbitope.partitioning = true;
+    // rows in order of first variable
+    std::vector< std::pair< int, int > > rows;
+    for (int iClass = 0; iClass < numberColumns_; iClass++) {
+      if (rowType[iClass] && members[iClass].size() == first.size() && orbitopeRoot(parent, iClass) == component)
+        rows.push_back(std::pair< int, int >(members[iClass][0], iClass));
+    }
+    std::sort(rows.begin(), rows.end());
+    std::vector< int > phi(numberOrbitColumns);
+    std::vector< int > queue(numberOrbitColumns);
+    for (size_t r = 0; r < rows.size(); r++) {
+      const std::vector< int > &which = members[rows[r].second];
+      bool matched = false;
+      // try each variable as column 0
+      for (int w = 0; w < numberOrbitColumns && !matched; w++) {
+        for (int j = 0; j < numberOrbitColumns; j++)
+          phi[j] = -1;
+        phi[0] = which[w];
+        position[which[w]] = 0;
+        int nQueue = 1;
+        queue[0] = 0;
+        matched = true;
+        for (int iQueue = 0; iQueue < nQueue && matched; iQueue++) {
+          int j = queue[iQueue];
+          for (int k = 0; k < numberGens; k++) {
+            const int *orbit = permutations_[generators[gens[k]]].orbits;
+            int image = orbit[phi[j]] >= 0 ? orbit[phi[j]] : phi[j];
+            int jImage = j;
+            if (swap1[k] == j)
+              jImage = swap2[k];
+            else if (swap2[k] == j)
+              jImage = swap1[k];
+            if (phi[jImage] < 0 && position[image] < 0) {
+              phi[jImage] = image;
+              position[image] = jImage;
+              queue[nQueue++] = jImage;
+            } else if (phi[jImage] != image) {
+              matched = false;
+              break;
+            }
+          }
+        }
+        if (nQueue < numberOrbitColumns)
+          matched = false;
+        for (int j = 0; j < numberOrbitColumns; j++) {
+          if (phi[j] >= 0)
+            position[phi[j]] = -1;
+        }
+      }
+      if (matched) {
+        orbitope.numberRows++;
+        if (rowType[rows[r].second] != 2)
+          orbitope.partitioning = false;
+        for (int j = 0; j < numberOrbitColumns; j++)
+          orbitope.variables.push_back(phi[j]);
+      }
+    }
+    if (orbitope.numberRows)
+      orbitopes_.push_back(orbitope);
+  }
+  int numberOrbitopes = static_cast< int >(orbitopes_.size());
+  if (numberOrbitopes) {
+    char general[200];
+    for (int k = 0; k < numberOrbitopes; k++) {
+      sprintf(general, "Orbitope %d - %d rows x %d columns (%s)", k,
+        orbitopes_[k].numberRows, orbitopes_[k].numberColumns,
+        orbitopes_[k].partitioning ? "partitioning" : "packing");
+      model->messageHandler()->message(CBC_GENERAL, model->messages())
+        << general << CoinMessageEol;
+    }
+    model->messageHandler()->message(CBC_GENERAL, model->messages())
+      << "Orbitopal fixing will be used instead of orbital fixing and branching"
+      << CoinMessageEol;
+    // switch off orbits
+    for (int i = 0; i < numberColumns_; i++)
+      whichOrbit_[i] = -1;
+    for (int i = 0; i < numberPermutations_; i++)
+      delete[] permutations_[i].orbits;
+    delete[] permutations_;
+    permutations_ = NULL;
+    numberPermutations_ = 0;
+    lastOrbitopeSucceeded_ = -1;
+  }
+  return numberOrbitopes;
+}
+/* Fixes variables so columns of orbitopes are in lexicographically
+   decreasing order.  As at most one variable in a row can be one this is
+   the same as the first one in each column being in an earlier row than
+   the first one in next column (with empty columns last).  So if first[j]
+   is the earliest row that can be first one of column j and last[j] the
+   latest (if column can not be empty) then variables above first[j] are
+   zero and if only first[j] in first[j]..last[j] is free it is one.
+*/
+int CbcSymmetry::orbitopalFixing(OsiSolverInterface *solver)
+{
+  const double *columnLower = solver->getColLower();
+  const double *columnUpper = solver->getColUpper();
+  int nFixed = 0;
+  int nFixedToOne = 0;
+  int infeasibleColumn = -1;
+  orbitopeCalls_++;
+  for (size_t k = 0; k < orbitopes_.size() && infeasibleColumn < 0; k++) {
+    const cbc_orbitope &orbitope = orbitopes_[k];
+    int numberRows = orbitope.numberRows;
+    int numberColumns = orbitope.numberColumns;
+    const int *variables = &orbitope.variables[0];
+    std::vector< int > first(numberColumns);
+    bool changed = true;
+    while (changed && infeasibleColumn < 0) {
+      changed = false;
+      // rest of row zero if one at one
+      for (int i = 0; i < numberRows; i++) {
+        const int *rowVariables = variables + i * numberColumns;
+        int jOne = -1;
+        for (int j = 0; j < numberColumns; j++) {
+          if (columnLower[rowVariables[j]] > 0.5) {
+            if (jOne >= 0)
+              infeasibleColumn = rowVariables[j];
+            jOne = j;
+          }
+        }
+        if (jOne >= 0) {
+          for (int j = 0; j < numberColumns; j++) {
+            int iColumn = rowVariables[j];
+            if (j != jOne && columnUpper[iColumn] > 0.5) {
+              solver->setColUpper(iColumn, 0.0);
+              nFixed++;
+              changed = true;
+            }
+          }
+        }
+      }
+      // earliest rows
+      int previous = -1;
+      for (int j = 0; j < numberColumns; j++) {
+        int i;
+        for (i = previous + 1; i < numberRows; i++) {
+          if (columnUpper[variables[i * numberColumns + j]] > 0.5)
+            break;
+        }
+        first[j] = i;
+        // rows above must be zero (if empty whole column)
+        int iLast = (i < numberRows) ? previous : numberRows - 1;
+        for (int i2 = 0; i2 <= iLast; i2++) {
+          int iColumn = variables[i2 * numberColumns + j];
+          if (columnUpper[iColumn] > 0.5) {
+            if (columnLower[iColumn] > 0.5) {
+              infeasibleColumn = iColumn;
+            } else {
+              solver->setColUpper(iColumn, 0.0);
+              nFixed++;
+              changed = true;
+            }
+          }
+        }
+        previous = i;
+      }
+      // latest rows (numberRows if column may be empty)
+      int next = numberRows;
+      for (int j = numberColumns - 1; j >= 0 && infeasibleColumn < 0; j--) {
+        int last;
+        for (last = 0; last < numberRows; last++) {
+          if (columnLower[variables[last * numberColumns + j]] > 0.5)
+            break;
+        }
+        if (next < numberRows)
+          last = CoinMin(last, next - 1);
+        next = last;
+        if (last == numberRows)
+          continue;
+        if (first[j] > last) {
+          infeasibleColumn = variables[j];
+          break;
+        }
+        int iColumn = variables[first[j] * numberColumns + j];
+        if (columnLower[iColumn] > 0.5)
+          continue;
+        bool onlyOne = true;
+        for (int i = first[j] + 1; i <= last; i++) {
+          if (columnUpper[variables[i * numberColumns + j]] > 0.5) {
+            onlyOne = false;
+            break;
+          }
+        }
+        if (onlyOne) {
+          solver->setColLower(iColumn, 1.0);
+          nFixedToOne++;
+          changed = true;
+          next = first[j];
+        }
+      }
+    }
+  }
+  int n = nFixed + nFixedToOne;
+  if (infeasibleColumn >= 0) {
+    orbitopeInfeasible_++;
+    solver->setColLower(infeasibleColumn, 1.0);
+    solver->setColUpper(infeasibleColumn, 0.0);
+    n++;
+  } else if (n) {
+    orbitopeSucceeded_++;
+    orbitopeFixes_ += n;
+    orbitopeFixesToOne_ += nFixedToOne;
+  }
+  return n;
+}
 // takes ownership of cbc_permute (orbits part)
 void
 CbcSymmetry::addPermutation(cbc_permute permutation)
@@ -1594,6 +2003,12 @@ CbcSymmetry::CbcSymmetry()
   , nautyFixCalls_(0)
   , lastNautyFixSucceeded_(0)
   , nautyFixSucceeded_(0)
+  , orbitopeFixes_(0.0)
+  , orbitopeFixesToOne_(0)
+  , orbitopeCalls_(0)
+  , orbitopeSucceeded_(0)
+  , orbitopeInfeasible_(0)
+  , lastOrbitopeSucceeded_(-1)
 {
 }
 // Copy constructor
@@ -1627,6 +2042,13 @@ CbcSymmetry::CbcSymmetry(const CbcSymmetry &rhs)
   nautyFixCalls_ = rhs.nautyFixCalls_;
   lastNautyFixSucceeded_ = rhs.lastNautyFixSucceeded_;
   nautyFixSucceeded_ = rhs.nautyFixSucceeded_;
+  orbitopes_ = rhs.orbitopes_;
+  orbitopeFixes_ = rhs.orbitopeFixes_;
+  orbitopeFixesToOne_ = rhs.orbitopeFixesToOne_;
+  orbitopeCalls_ = rhs.orbitopeCalls_;
+  orbitopeSucceeded_ = rhs.orbitopeSucceeded_;
+  orbitopeInfeasible_ = rhs.orbitopeInfeasible_;
+  lastOrbitopeSucceeded_ = rhs.lastOrbitopeSucceeded_;
 }
 // Assignment operator
 CbcSymmetry &
@@ -1669,6 +2091,13 @@ CbcSymmetry::operator=(const CbcSymmetry &rhs)
     nautyFixCalls_ = rhs.nautyFixCalls_;
     lastNautyFixSucceeded_ = rhs.lastNautyFixSucceeded_;
     nautyFixSucceeded_ = rhs.nautyFixSucceeded_;
+    orbitopes_ = rhs.orbitopes_;
+    orbitopeFixes_ = rhs.orbitopeFixes_;
+    orbitopeFixesToOne_ = rhs.orbitopeFixesToOne_;
+    orbitopeCalls_ = rhs.orbitopeCalls_;
+    orbitopeSucceeded_ = rhs.orbitopeSucceeded_;
+    orbitopeInfeasible_ = rhs.orbitopeInfeasible_;
+    lastOrbitopeSucceeded_ = rhs.lastOrbitopeSucceeded_;
   }
   return *this;
 }
@@ -1686,6 +2115,7 @@ CbcSymmetry::~CbcSymmetry()
   }
 }
 
+#ifndef CBC_NAUTY_BUILTIN
 CbcNauty::CbcNauty(int vertices, const size_t *v, const int *d, const int *e)
 {
   //printf("Need sparse nauty - wordsize %d\n",WORDSIZE);
@@ -1989,6 +2419,8 @@ void CbcNauty::addElement(int ix, int jx)
   }
 }
 
+#endif
+
 void CbcNauty::clearPartitions()
 {
   for (int j = 0; j < n_; j++) {
@@ -1999,6 +2431,7 @@ void CbcNauty::clearPartitions()
   autoComputed_ = false;
 }
 
+#ifndef CBC_NAUTY_BUILTIN
 void CbcNauty::computeAuto()
 {
 
@@ -2081,6 +2514,660 @@ void CbcNauty::deleteElement(int ix, int jx)
   autoComputed_ = false;
 }
 
+#else
+/*
+  Built-in search - used when Cbc is not built with nauty.
+
+  Vertices start coloured as in Compute_Symmetry.  The partition is made
+  equitable by colour refinement (split cells by number of neighbours in a
+  splitter cell until nothing changes).  A first path individualizes the
+  first vertex of the first non trivial cell until the partition is
+  discrete.  Then, from the deepest level up, every other vertex w of the
+  target cell not already in the orbit of the first path vertex v is
+  individualized and a leaf is looked for (trying first path vertices
+  first) whose partition matches the first leaf - the map between the two
+  leaves is then checked to be an automorphism.  Automorphisms found at
+  deeper levels fix all vertices above, so orbits are just kept by union
+  find and the group size is the product of the orbit sizes of the v.
+
+  Refinement only looks at cells in position order and new cells go in
+  position order so that the result does not depend on vertex numbering.
+  Work is limited - if search stops early the automorphisms found are
+  still correct (just a subgroup).
+*/
+namespace {
+class CbcSymmetrySearch {
+public:
+  CbcSymmetrySearch(int n, const size_t *start, const int *adjacency,
+    const int *color, CbcNautyOptions *options, CbcNautyStats *stats,
+    int *orbits, FILE *fp);
+  /// Does search
+  void search();
+
+private:
+  void refine(int level);
+  void individualize(int vertex, int level);
+  void backtrack(int level);
+  void addCell(int start, int level);
+  bool matchesFirst(int level) const
+  {
+    return numberCells_ == firstCells_[level] && cellHash_ == firstHash_[level];
+  }
+  bool tryImage(int level, int vertex);
+  bool leafIsAutomorphism();
+  void addAutomorphism();
+  int findOrbit(int vertex);
+  inline bool overBudget()
+  {
+    if (work_ > options_->maxWork)
+      stats_->incomplete = 1;
+    return stats_->incomplete != 0;
+  }
+
+  int n_;
+  const size_t *start_;
+  const int *adjacency_;
+  CbcNautyOptions *options_;
+  CbcNautyStats *stats_;
+  int *orbits_;
+  FILE *fp_;
+  /// vertex in each position
+  std::vector< int > lab_;
+  /// position of each vertex
+  std::vector< int > pos_;
+  /// start position of cell of each vertex
+  std::vector< int > cellOf_;
+  /// end of cell (valid at cell starts)
+  std::vector< int > cellEnd_;
+  /// cell starts with level created (so can be undone)
+  std::vector< int > splitStart_;
+  std::vector< int > splitLevel_;
+  int numberCells_;
+  /// order independent hash of cell starts
+  CoinUInt64 cellHash_;
+  /// work arrays for refinement
+  std::vector< int > count_;
+  std::vector< char > inQueue_;
+  std::vector< int > queue_;
+  std::vector< int > splitter_;
+  std::vector< int > touched_;
+  /// touched vertices as (cell, vertex)
+  std::vector< std::pair< int, int > > sortCell_;
+  /// first path
+  int depth_;
+  std::vector< int > firstVertex_;
+  std::vector< int > firstTarget_;
+  std::vector< int > firstCells_;
+  std::vector< CoinUInt64 > firstHash_;
+  std::vector< int > firstLeaf_;
+  /// automorphism found
+  std::vector< int > perm_;
+  std::vector< int > mark_;
+  int stamp_;
+  /// union find for orbits
+  std::vector< int > parent_;
+  std::vector< int > orbitSize_;
+  /// candidates for depth first search (by level)
+  std::vector< int > candidates_;
+  std::vector< int > frameStart_;
+  std::vector< int > frameNext_;
+  double work_;
+  unsigned long nodes_;
+  /// true if a try hit maxNodesPerTry - search goes on but may miss some
+  bool cutShort_;
+};
+
+// Orders (cell, vertex) by cell then count
+class SortByCellAndCount {
+public:
+  SortByCellAndCount(const std::vector< int > &count)
+    : count_(count)
+  {
+  }
+  inline bool operator()(const std::pair< int, int > &a,
+    const std::pair< int, int > &b) const
+  {
+    return a.first < b.first || (a.first == b.first && count_[a.second] < count_[b.second]);
+  }
+
+private:
+  const std::vector< int > &count_;
+};
+
+inline CoinUInt64 hashStart(int start)
+{
+  CoinUInt64 value = static_cast< CoinUInt64 >(start) + 1;
+  value *= 0x9e3779b97f4a7c15ULL;
+  return value ^ (value >> 29);
+}
+
+CbcSymmetrySearch::CbcSymmetrySearch(int n, const size_t *start,
+  const int *adjacency, const int *color, CbcNautyOptions *options,
+  CbcNautyStats *stats, int *orbits, FILE *fp)
+  : n_(n)
+  , start_(start)
+  , adjacency_(adjacency)
+  , options_(options)
+  , stats_(stats)
+  , orbits_(orbits)
+  , fp_(fp)
+  , lab_(n)
+  , pos_(n)
+  , cellOf_(n)
+  , cellEnd_(n)
+  , numberCells_(0)
+  , cellHash_(0)
+  , count_(n, 0)
+  , inQueue_(n, 0)
+  , depth_(0)
+  , perm_(n)
+  , mark_(n, 0)
+  , stamp_(0)
+  , parent_(n)
+  , orbitSize_(n, 1)
+  , work_(0.0)
+  , nodes_(0)
+  , cutShort_(false)
+{
+  // initial partition - cells of equal colour in colour order
+  std::vector< std::pair< int, int > > order(n);
+  for (int i = 0; i < n; i++)
+    order[i] = std::make_pair(color[i], i);
+  std::sort(order.begin(), order.end());
+  for (int i = 0; i < n; i++) {
+    lab_[i] = order[i].second;
+    pos_[lab_[i]] = i;
+    parent_[i] = i;
+  }
+  int cellStart = 0;
+  for (int i = 1; i <= n; i++) {
+    if (i == n || order[i].first != order[i - 1].first) {
+      addCell(cellStart, 0);
+      cellEnd_[cellStart] = i;
+      for (int j = cellStart; j < i; j++)
+        cellOf_[lab_[j]] = cellStart;
+      queue_.push_back(cellStart);
+      inQueue_[cellStart] = 1;
+      cellStart = i;
+    }
+  }
+}
+
+// Records new cell start
+void CbcSymmetrySearch::addCell(int start, int level)
+{
+  splitStart_.push_back(start);
+  splitLevel_.push_back(level);
+  numberCells_++;
+  cellHash_ += hashStart(start);
+}
+
+// Refines partition until equitable (splitters in queue_)
+void CbcSymmetrySearch::refine(int level)
+{
+  size_t iQueue = 0;
+  while (iQueue < queue_.size() && numberCells_ < n_) {
+    int splitStart = queue_[iQueue++];
+    inQueue_[splitStart] = 0;
+    splitter_.assign(lab_.begin() + splitStart,
+      lab_.begin() + cellEnd_[splitStart]);
+    // count neighbours in splitter
+    for (size_t i = 0; i < splitter_.size(); i++) {
+      int iVertex = splitter_[i];
+      for (size_t k = start_[iVertex]; k < start_[iVertex + 1]; k++) {
+        int jVertex = adjacency_[k];
+        if (!count_[jVertex]++)
+          touched_.push_back(jVertex);
+      }
+      work_ += static_cast< double >(start_[iVertex + 1] - start_[iVertex]);
+    }
+    // touched vertices by cell (so cells in position order - result does
+    // not depend on numbering) then by count
+    sortCell_.clear();
+    for (size_t i = 0; i < touched_.size(); i++) {
+      int iVertex = touched_[i];
+      int cell = cellOf_[iVertex];
+      if (cellEnd_[cell] > cell + 1)
+        sortCell_.push_back(std::make_pair(cell, iVertex));
+    }
+    std::sort(sortCell_.begin(), sortCell_.end(), SortByCellAndCount(count_));
+    work_ += static_cast< double >(sortCell_.size());
+    size_t iFirst = 0;
+    while (iFirst < sortCell_.size()) {
+      int cell = sortCell_[iFirst].first;
+      size_t iLast = iFirst;
+      while (iLast < sortCell_.size() && sortCell_[iLast].first == cell)
+        iLast++;
+      int cellEnd = cellEnd_[cell];
+      int numberTouched = static_cast< int >(iLast - iFirst);
+      int numberUntouched = cellEnd - cell - numberTouched;
+      if (!numberUntouched && count_[sortCell_[iFirst].second] == count_[sortCell_[iLast - 1].second]) {
+        iFirst = iLast;
+        continue;
+      }
+      // untouched (count zero) first then touched by ascending count
+      int largest = cell;
+      int largestSize = numberUntouched;
+      bool wasInQueue = inQueue_[cell] != 0;
+      int fragment = cell;
+      for (size_t i = iFirst; i < iLast; i++) {
+        int iVertex = sortCell_[i].second;
+        int where = cell + numberUntouched + static_cast< int >(i - iFirst);
+        int other = lab_[where];
+        int from = pos_[iVertex];
+        lab_[where] = iVertex;
+        pos_[iVertex] = where;
+        lab_[from] = other;
+        pos_[other] = from;
+        if (where == cell || (i > iFirst && count_[iVertex] == count_[sortCell_[i - 1].second])) {
+          if (where == cell)
+            largestSize = 0;
+          continue;
+        }
+        // new fragment starts here
+        cellEnd_[fragment] = where;
+        if (where - fragment > largestSize) {
+          largestSize = where - fragment;
+          largest = fragment;
+        }
+        fragment = where;
+        addCell(fragment, level);
+      }
+      cellEnd_[fragment] = cellEnd;
+      if (cellEnd - fragment > largestSize)
+        largest = fragment;
+      for (int j = cell; j < cellEnd; j = cellEnd_[j]) {
+        for (int k = j; k < cellEnd_[j]; k++)
+          cellOf_[lab_[k]] = j;
+        // all new cells are splitters except (if allowed) largest
+        if (!inQueue_[j] && (wasInQueue || j != largest)) {
+          inQueue_[j] = 1;
+          queue_.push_back(j);
+        }
+      }
+      iFirst = iLast;
+    }
+    for (size_t i = 0; i < touched_.size(); i++)
+      count_[touched_[i]] = 0;
+    touched_.clear();
+  }
+  for (size_t i = iQueue; i < queue_.size(); i++)
+    inQueue_[queue_[i]] = 0;
+  queue_.clear();
+}
+
+// Makes vertex a cell of its own and refines
+void CbcSymmetrySearch::individualize(int vertex, int level)
+{
+  int cell = cellOf_[vertex];
+  int cellEnd = cellEnd_[cell];
+  assert(cellEnd > cell + 1);
+  int other = lab_[cell];
+  int where = pos_[vertex];
+  lab_[cell] = vertex;
+  pos_[vertex] = cell;
+  lab_[where] = other;
+  pos_[other] = where;
+  addCell(cell + 1, level);
+  cellEnd_[cell] = cell + 1;
+  cellEnd_[cell + 1] = cellEnd;
+  for (int j = cell + 1; j < cellEnd; j++)
+    cellOf_[lab_[j]] = cell + 1;
+  queue_.push_back(cell);
+  inQueue_[cell] = 1;
+  refine(level);
+  nodes_++;
+}
+
+// Undoes all splits made after level
+void CbcSymmetrySearch::backtrack(int level)
+{
+  while (splitLevel_.size() && splitLevel_.back() > level) {
+    int cell = splitStart_.back();
+    splitStart_.pop_back();
+    splitLevel_.pop_back();
+    numberCells_--;
+    cellHash_ -= hashStart(cell);
+    // merge with cell before
+    int previous = cellOf_[lab_[cell - 1]];
+    int cellEnd = cellEnd_[cell];
+    cellEnd_[previous] = cellEnd;
+    for (int j = cell; j < cellEnd; j++)
+      cellOf_[lab_[j]] = previous;
+    work_ += static_cast< double >(cellEnd - cell);
+  }
+}
+
+// Looks for leaf below level (with vertex individualized) matching first
+bool CbcSymmetrySearch::tryImage(int level, int vertex)
+{
+  individualize(vertex, level);
+  if (!matchesFirst(level))
+    return false;
+  if (level == depth_)
+    return leafIsAutomorphism();
+  unsigned long maxNodes = nodes_ + 2 * (depth_ - level) + options_->maxNodesPerTry;
+  // depth first - one frame of candidates per level
+  candidates_.clear();
+  frameStart_.clear();
+  frameNext_.clear();
+  int iLevel = level + 1;
+  while (true) {
+    int iFrame = iLevel - level - 1;
+    if (iFrame == static_cast< int >(frameStart_.size())) {
+      // new frame - first path vertex first as often works at once
+      frameStart_.push_back(static_cast< int >(candidates_.size()));
+      frameNext_.push_back(static_cast< int >(candidates_.size()));
+      int cell = firstTarget_[iLevel];
+      int firstVertex = firstVertex_[iLevel];
+      if (cellOf_[firstVertex] == cell)
+        candidates_.push_back(firstVertex);
+      for (int j = cell; j < cellEnd_[cell]; j++) {
+        if (lab_[j] != firstVertex)
+          candidates_.push_back(lab_[j]);
+      }
+    }
+    // frame for iLevel is always last
+    int iNext = frameNext_[iFrame];
+    bool exhausted = iNext == static_cast< int >(candidates_.size());
+    if (!exhausted && nodes_ > maxNodes)
+      cutShort_ = true;
+    if (exhausted || nodes_ > maxNodes || overBudget()) {
+      // exhausted - go up a level
+      candidates_.resize(frameStart_[iFrame]);
+      frameStart_.pop_back();
+      frameNext_.pop_back();
+      if (!iFrame)
+        return false;
+      iLevel--;
+      backtrack(iLevel - 1);
+      continue;
+    }
+    frameNext_[iFrame]++;
+    individualize(candidates_[iNext], iLevel);
+    if (matchesFirst(iLevel)) {
+      if (iLevel == depth_) {
+        if (leafIsAutomorphism())
+          return true;
+      } else {
+        iLevel++;
+        continue;
+      }
+    }
+    backtrack(iLevel - 1);
+  }
+}
+
+// Sees if map from first leaf to current leaf is an automorphism
+bool CbcSymmetrySearch::leafIsAutomorphism()
+{
+  assert(numberCells_ == n_);
+  for (int i = 0; i < n_; i++)
+    perm_[firstLeaf_[i]] = lab_[i];
+  for (int iVertex = 0; iVertex < n_; iVertex++) {
+    int image = perm_[iVertex];
+    if (image == iVertex)
+      continue;
+    stamp_++;
+    if (stamp_ == COIN_INT_MAX) {
+      std::fill(mark_.begin(), mark_.end(), 0);
+      stamp_ = 1;
+    }
+    for (size_t k = start_[image]; k < start_[image + 1]; k++)
+      mark_[adjacency_[k]] = stamp_;
+    work_ += 2.0 * static_cast< double >(start_[image + 1] - start_[image]);
+    for (size_t k = start_[iVertex]; k < start_[iVertex + 1]; k++) {
+      if (mark_[perm_[adjacency_[k]]] != stamp_)
+        return false;
+    }
+  }
+  return true;
+}
+
+int CbcSymmetrySearch::findOrbit(int vertex)
+{
+  int root = vertex;
+  while (parent_[root] != root)
+    root = parent_[root];
+  while (parent_[vertex] != root) {
+    int next = parent_[vertex];
+    parent_[vertex] = root;
+    vertex = next;
+  }
+  return root;
+}
+
+// Adds perm_ to generators and merges orbits
+void CbcSymmetrySearch::addAutomorphism()
+{
+  stats_->numgenerators++;
+  for (int iVertex = 0; iVertex < n_; iVertex++) {
+    int root1 = findOrbit(iVertex);
+    int root2 = findOrbit(perm_[iVertex]);
+    if (root1 != root2) {
+      if (orbitSize_[root1] < orbitSize_[root2])
+        std::swap(root1, root2);
+      parent_[root2] = root1;
+      orbitSize_[root1] += orbitSize_[root2];
+    }
+  }
+  if (fp_) {
+    // in cycle notation
+    std::vector< char > done(n_, 0);
+    for (int iVertex = 0; iVertex < n_; iVertex++) {
+      if (done[iVertex] || perm_[iVertex] == iVertex)
+        continue;
+      fprintf(fp_, "(");
+      int jVertex = iVertex;
+      do {
+        done[jVertex] = 1;
+        fprintf(fp_, jVertex == iVertex ? "%d" : " %d", jVertex);
+        jVertex = perm_[jVertex];
+      } while (jVertex != iVertex);
+      fprintf(fp_, ")");
+    }
+    fprintf(fp_, "\n");
+  }
+  if (options_->userautomproc)
+    options_->userautomproc(stats_->numgenerators, &perm_[0], NULL, 0,
+      -1, n_);
+}
+
+void CbcSymmetrySearch::search()
+{
+  stats_->grpsize1 = 1.0;
+  stats_->grpsize2 = 0;
+  stats_->numgenerators = 0;
+  stats_->errstatus = 0;
+  stats_->incomplete = 0;
+  refine(0);
+  // first path
+  firstVertex_.push_back(-1);
+  firstTarget_.push_back(-1);
+  firstCells_.push_back(numberCells_);
+  firstHash_.push_back(cellHash_);
+  while (numberCells_ < n_) {
+    int cell = 0;
+    while (cellEnd_[cell] == cell + 1)
+      cell = cellEnd_[cell];
+    depth_++;
+    firstVertex_.push_back(lab_[cell]);
+    firstTarget_.push_back(cell);
+    individualize(lab_[cell], depth_);
+    firstCells_.push_back(numberCells_);
+    firstHash_.push_back(cellHash_);
+  }
+  firstLeaf_ = lab_;
+  // from bottom up look for images of first path vertex
+  std::vector< int > candidates;
+  std::vector< int > failed;
+  for (int level = depth_; level > 0; level--) {
+    backtrack(level - 1);
+    if (options_->userlevelproc)
+      options_->userlevelproc(&lab_[0], NULL, level, NULL, stats_,
+        firstVertex_[level], 0, cellEnd_[firstTarget_[level]] - firstTarget_[level],
+        numberCells_, 0, n_);
+    int firstVertex = firstVertex_[level];
+    int cell = firstTarget_[level];
+    candidates.assign(lab_.begin() + cell, lab_.begin() + cellEnd_[cell]);
+    failed.clear();
+    for (size_t i = 0; i < candidates.size(); i++) {
+      int iVertex = candidates[i];
+      int orbit = findOrbit(iVertex);
+      if (orbit == findOrbit(firstVertex))
+        continue;
+      // no image if one in same orbit had none
+      bool skip = false;
+      for (size_t j = 0; j < failed.size(); j++) {
+        if (findOrbit(failed[j]) == orbit) {
+          skip = true;
+          break;
+        }
+      }
+      if (skip)
+        continue;
+      if (tryImage(level, iVertex))
+        addAutomorphism();
+      else
+        failed.push_back(iVertex);
+      backtrack(level - 1);
+      if (overBudget())
+        break;
+    }
+    // orbit of first path vertex under stabilizer of those above
+    stats_->grpsize1 *= orbitSize_[findOrbit(firstVertex)];
+    while (stats_->grpsize1 >= 10.0) {
+      stats_->grpsize1 /= 10.0;
+      stats_->grpsize2++;
+    }
+    if (overBudget())
+      break;
+  }
+  // orbits as nauty - smallest vertex in orbit
+  std::vector< int > smallest(n_, -1);
+  stats_->numorbits = 0;
+  for (int iVertex = 0; iVertex < n_; iVertex++) {
+    int root = findOrbit(iVertex);
+    if (smallest[root] < 0) {
+      smallest[root] = iVertex;
+      stats_->numorbits++;
+    }
+    orbits_[iVertex] = smallest[root];
+  }
+  stats_->numnodes = nodes_;
+  if (cutShort_)
+    stats_->incomplete = 1;
+}
+} // namespace
+
+CbcNauty::CbcNauty(int vertices, const size_t *v, const int *d, const int *e)
+{
+  n_ = vertices;
+  nel_ = v ? v[n_] : 0;
+  // adjacency lists may have gaps (d less than space)
+  v_.resize(n_ + 1);
+  v_[0] = 0;
+  for (int i = 0; i < n_; i++) {
+    for (int k = 0; k < d[i]; k++)
+      e_.push_back(e[v[i] + k]);
+    v_[i + 1] = e_.size();
+  }
+  orbits_ = new int[n_];
+  options_ = new CbcNautyOptions;
+  stats_ = new CbcNautyStats;
+  memset(orbits_, 0, n_ * sizeof(int));
+  memset(options_, 0, sizeof(CbcNautyOptions));
+  memset(stats_, 0, sizeof(CbcNautyStats));
+  options_->maxWork = 5.0e8;
+  options_->maxNodesPerTry = 100;
+  vstat_ = new int[n_];
+  clearPartitions();
+  afp_ = NULL;
+  if (!n_)
+    stats_->errstatus = 1; // deliberate error
+}
+
+CbcNauty::~CbcNauty()
+{
+  delete[] orbits_;
+  delete options_;
+  delete stats_;
+  delete[] vstat_;
+}
+
+// Copy constructor
+CbcNauty::CbcNauty(const CbcNauty &rhs)
+  : v_(rhs.v_)
+  , e_(rhs.e_)
+  , n_(rhs.n_)
+  , nel_(rhs.nel_)
+  , autoComputed_(rhs.autoComputed_)
+{
+  orbits_ = CoinCopyOfArray(rhs.orbits_, n_);
+  options_ = new CbcNautyOptions(*rhs.options_);
+  stats_ = new CbcNautyStats(*rhs.stats_);
+  vstat_ = CoinCopyOfArray(rhs.vstat_, n_);
+  afp_ = rhs.afp_; // ? no copy ?
+}
+
+// Assignment operator
+CbcNauty &
+CbcNauty::operator=(const CbcNauty &rhs)
+{
+  if (this != &rhs) {
+    delete[] orbits_;
+    delete[] vstat_;
+    v_ = rhs.v_;
+    e_ = rhs.e_;
+    n_ = rhs.n_;
+    nel_ = rhs.nel_;
+    autoComputed_ = rhs.autoComputed_;
+    orbits_ = CoinCopyOfArray(rhs.orbits_, n_);
+    *options_ = *rhs.options_;
+    *stats_ = *rhs.stats_;
+    vstat_ = CoinCopyOfArray(rhs.vstat_, n_);
+    afp_ = rhs.afp_; // ? no copy ?
+  }
+  return *this;
+}
+
+void CbcNauty::addElement(int ix, int jx)
+{
+  // built-in search only takes sparse graphs
+  assert(ix < n_ && jx < n_);
+  abort();
+}
+
+void CbcNauty::deleteElement(int ix, int jx)
+{
+  assert(ix < n_ && jx < n_);
+  abort();
+}
+
+void CbcNauty::computeAuto()
+{
+  if (!n_)
+    return;
+  CbcSymmetrySearch search(n_, &v_[0], e_.size() ? &e_[0] : NULL, vstat_,
+    options_, stats_, orbits_, afp_);
+  search.search();
+  autoComputed_ = true;
+  if (afp_)
+    fflush(afp_);
+}
+
+void CbcNauty::setWriteAutoms(const std::string &fname)
+{
+  afp_ = fopen(fname.c_str(), "w");
+}
+
+void CbcNauty::unsetWriteAutoms()
+{
+  fclose(afp_);
+  afp_ = NULL;
+}
+#endif
+
 double
 CbcNauty::getGroupSize() const
 {
@@ -2190,6 +3277,7 @@ CbcNauty::isMixedFreeZeroOrbit(const std::vector<int> &orbit) const
 }
 */
 
+#ifndef CBC_NAUTY_BUILTIN
 void CbcNauty::setWriteAutoms(const std::string &fname)
 {
   afp_ = fopen(fname.c_str(), "w");
@@ -2205,6 +3293,7 @@ void CbcNauty::unsetWriteAutoms()
   fclose(afp_);
   options_->writeautoms = FALSE;
 }
+#endif
 
 // Default Constructor
 CbcOrbitalBranchingObject::CbcOrbitalBranchingObject()
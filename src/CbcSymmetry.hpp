@@ -21,6 +21,9 @@
 
   If you wish to use Traces rather than nauty then add -DNTY_TRACES
 
+  Without nauty CbcConfig.h defines CBC_NAUTY_BUILTIN and CbcNauty uses
+  its own search (colour refinement and partition backtracking) instead.
+
   To use it is -orbit on
 
  */
@@ -29,7 +32,7 @@
 
 #include "CbcConfig.h"
 
-#ifdef CBC_HAS_NAUTY
+#ifndef CBC_NAUTY_BUILTIN
 extern "C" {
 #include "nauty/nauty.h"
 #include "nauty/nausparse.h"
@@ -37,6 +40,38 @@ extern "C" {
 #include "nauty/traces.h"
 #endif
 }
+#ifndef NTY_TRACES
+typedef optionblk CbcNautyOptions;
+typedef statsblk CbcNautyStats;
+#else
+typedef TracesOptions CbcNautyOptions;
+typedef TracesStats CbcNautyStats;
+#endif
+#else
+/// What Cbc uses of nauty's statsblk - filled by built-in search
+typedef struct {
+  /// group size is grpsize1 * 10^grpsize2
+  double grpsize1;
+  int grpsize2;
+  int numorbits;
+  int numgenerators;
+  int errstatus;
+  /// Number of nodes in search tree
+  unsigned long numnodes;
+  /** Nonzero if search gave up or a try hit maxNodesPerTry (group
+      found may then be a subgroup) */
+  int incomplete;
+} CbcNautyStats;
+/// What Cbc uses of nauty's optionblk - for built-in search
+typedef struct {
+  void (*userlevelproc)(int *, int *, int, int *, CbcNautyStats *,
+    int, int, int, int, int, int);
+  void (*userautomproc)(int, int *, int *, int, int, int);
+  /// Give up after this many adjacency entries scanned
+  double maxWork;
+  /// Give up on one candidate image after this many extra nodes
+  int maxNodesPerTry;
+} CbcNautyOptions;
 #endif
 
 #include <vector>
@@ -56,6 +91,16 @@ typedef struct {
   int numberPerms;
   int * orbits;
 } cbc_permute;
+/** Packing or partitioning orbitope - numberRows x numberColumns 0-1
+    variables, at most (exactly if partitioning) one per row may be one
+    and any permutation of columns is a symmetry */
+typedef struct {
+  int numberRows;
+  int numberColumns;
+  bool partitioning;
+  /// variable in row i, column j is variables[i*numberColumns+j]
+  std::vector< int > variables;
+} cbc_orbitope;
 
 #define COUENNE_HACKED_EPS 1.e-07
 #define COUENNE_HACKED_EPS_SYMM 1e-8
@@ -208,6 +253,20 @@ public:
   { nautyOtherBranches_ += n;}
   inline void incrementBranchSucceeded()
   { nautyBranchSucceeded_ ++;}
+  /** Looks for packing/partitioning orbitopes in stored generators.
+      If any found they replace orbits (so no orbital fixing or
+      branching).  Returns number of orbitopes */
+  int findOrbitopes(CbcModel * model);
+  /// Number of orbitopes
+  inline int numberOrbitopes() const
+  { return static_cast<int>(orbitopes_.size());}
+  /// Orbitope
+  inline const cbc_orbitope & orbitope(int which) const
+  { return orbitopes_[which];}
+  /** Fixes variables so columns of orbitopes are in lexicographically
+      decreasing order (returns number fixed).  If node is infeasible
+      bounds of a variable are crossed so resolve will find that. */
+  int orbitopalFixing(OsiSolverInterface *solver);
 private:
   mutable std::vector< Node > node_info_;
   mutable CbcNauty *nauty_info_;
@@ -227,6 +286,13 @@ private:
   mutable int nautyFixCalls_;
   mutable int lastNautyFixSucceeded_;
   int nautyFixSucceeded_;
+  std::vector< cbc_orbitope > orbitopes_;
+  double orbitopeFixes_;
+  int orbitopeFixesToOne_;
+  int orbitopeCalls_;
+  int orbitopeSucceeded_;
+  int orbitopeInfeasible_;
+  mutable int lastOrbitopeSucceeded_;
 };
 
 class CbcNauty {
@@ -278,7 +344,11 @@ public:
   void getVstat(double *v, int nv);
   inline bool isSparse() const
   {
+#ifndef CBC_NAUTY_BUILTIN
     return GSparse_ != NULL;
+#else
+    return true;
+#endif
   }
   inline int errorStatus() const
 #ifndef NTY_TRACES
@@ -291,10 +361,15 @@ public:
   }
 #endif
   /// Pointer to options
-  inline optionblk *options() const
+  inline CbcNautyOptions *options() const
   {
     return options_;
   }
+  /// Pointer to statistics
+  inline const CbcNautyStats *stats() const
+  {
+    return stats_;
+  }
   /**
    * Methods to classify orbits.  Not horribly efficient, but gets the job done
    */
@@ -309,6 +384,7 @@ public:
   void unsetWriteAutoms();
 
 private:
+#ifndef CBC_NAUTY_BUILTIN
   // The base nauty stuff
   graph *G_;
   sparsegraph *GSparse_;
@@ -329,6 +405,16 @@ private:
   int n_;
   size_t nel_;
   graph *canonG_;
+#else
+  /// Graph as adjacency lists (v_ starts, e_ neighbours)
+  std::vector< size_t > v_;
+  std::vector< int > e_;
+  int *orbits_;
+  CbcNautyOptions *options_;
+  CbcNautyStats *stats_;
+  int n_;
+  size_t nel_;
+#endif
 
   bool autoComputed_;
 
@@ -20,6 +20,7 @@
 #include "OsiSolverInterface.hpp"
 #include "OsiRowCutDebugger.hpp"
 #include "CbcThread.hpp"
+#include "CbcTrace.hpp"
 #include "CbcTree.hpp"
 #include "CbcHeuristic.hpp"
 #include "CbcCutGenerator.hpp"
@@ -35,6 +36,11 @@
 static void *doNodesThread(void *voidInfo);
 static void *doCutsThread(void *voidInfo);
 static void *doHeurThread(void *voidInfo);
+// Arguments for doHeurThread (trace is that of thread starting it)
+typedef struct {
+  void *argBundle;
+  void *trace;
+} CbcHeurThreadInfo;
 // Default Constructor
 CbcSpecificThread::CbcSpecificThread()
   : basePointer_(NULL)
@@ -248,16 +254,19 @@ void parallelHeuristics(int numberThreads,
   void *argBundle)
 {
   Coin_pthread_t *threadId = new Coin_pthread_t[numberThreads];
+  CbcHeurThreadInfo *info = new CbcHeurThreadInfo[numberThreads];
   char *args = reinterpret_cast< char * >(argBundle);
   for (int i = 0; i < numberThreads; i++) {
-    pthread_create(&(threadId[i].thr), NULL, doHeurThread,
-      args + i * sizeOfData);
+    info[i].argBundle = args + i * sizeOfData;
+    info[i].trace = CbcTrace::current();
+    pthread_create(&(threadId[i].thr), NULL, doHeurThread, info + i);
   }
   // now wait
   for (int i = 0; i < numberThreads; i++) {
     pthread_join(threadId[i].thr, NULL);
   }
   delete[] threadId;
+  delete[] info;
 }
 // End of specific thread stuff
 
@@ -287,6 +296,7 @@ CbcThread::CbcThread()
   , nodesThisTime_(0)
   , iterationsThisTime_(0)
   , deterministic_(0)
+  , traceRun_(NULL)
 {
 }
 void CbcThread::gutsOfDelete()
@@ -328,6 +338,7 @@ void CbcThread::setUsefulStuff(CbcModel *model, int deterministic, CbcModel *bas
   nDeleteNode_ = 0;
   nodesThisTime_ = 0;
   iterationsThisTime_ = 0;
+  traceRun_ = CbcTrace::current();
   if (model != baseModel) {
     // thread
     thisModel_->setInfoInChild(-3, this);
@@ -347,7 +358,9 @@ void CbcThread::lockThread()
 {
   if (!locked_) {
     double time2 = getTime();
+    CbcTraceSpan traceSpan(CBC_TRACE_LOCK, "lock");
     threadStuff_.lockThread();
+    traceSpan.finish();
     locked_ = true;
     timeWhenLocked_ = getTime();
     timeWaitingToLock_ += timeWhenLocked_ - time2;
@@ -545,6 +558,8 @@ CbcBaseModel::CbcBaseModel(CbcModel &model, int type)
       //threadModel_[i] = new CbcModel(model, true);
       threadModel_[i] = model.clone(true);
       threadModel_[i]->synchronizeHandlers(1);
+      // master writes progress
+      threadModel_[i]->setProgressStream(NULL);
 #ifdef CBC_HAS_CLP
       // Solver may need to know about model
       CbcModel *thisModel = threadModel_[i];
@@ -1097,6 +1112,7 @@ void CbcBaseModel::setDantzigState()
 static void *doNodesThread(void *voidInfo)
 {
   CbcThread *stuff = reinterpret_cast< CbcThread * >(voidInfo);
+  CbcTrace::setCurrent(stuff->traceRun());
   CbcModel *thisModel = stuff->thisModel();
   CbcModel *baseModel = stuff->baseModel();
   while (true) {
@@ -1239,7 +1255,11 @@ static void *doHeurThread(void *voidInfo)
     double *solution;
     int foundSol;
   } argBundle;
-  argBundle *stuff = reinterpret_cast< argBundle * >(voidInfo);
+  CbcHeurThreadInfo *info = reinterpret_cast< CbcHeurThreadInfo * >(voidInfo);
+  CbcTrace::setCurrent(info->trace);
+  argBundle *stuff = reinterpret_cast< argBundle * >(info->argBundle);
+  CbcTraceSpan traceSpan(CBC_TRACE_HEURISTIC,
+    stuff->model->heuristic(0)->heuristicName());
   stuff->foundSol = stuff->model->heuristic(0)->solution(stuff->solutionValue,
     stuff->solution);
   return NULL;
@@ -1247,6 +1267,7 @@ static void *doHeurThread(void *voidInfo)
 static void *doCutsThread(void *voidInfo)
 {
   CbcThread *stuff = reinterpret_cast< CbcThread * >(voidInfo);
+  CbcTrace::setCurrent(stuff->traceRun());
   CbcModel *thisModel = stuff->thisModel();
   while (true) {
     stuff->waitThread();
@@ -1452,6 +1473,8 @@ void CbcModel::moveToModel(CbcModel *baseModel, int mode)
       thisGlobal->addCutIfNotDuplicate(*baseGlobal->cut(i));
     }
     numberGlobalCutsIn_ = baseNumberCuts;
+    // and global bounds
+    globalFixing_.mergeBounds(baseModel->globalFixing_);
   } else if (mode == 1) {
     lockThread();
     CbcThread *stuff = reinterpret_cast< CbcThread * >(masterThread_);
@@ -1519,6 +1542,7 @@ void CbcModel::moveToModel(CbcModel *baseModel, int mode)
     }
     //thisGlobal->truncate(numberGlobalCutsIn_);
     numberGlobalCutsIn_ = 999999;
+    baseModel->globalFixing_.mergeBounds(globalFixing_);
     unlockThread();
   } else if (mode == 2) {
     baseModel->sumChangeObjective1_ += sumChangeObjective1_;
@@ -1531,15 +1555,24 @@ void CbcModel::moveToModel(CbcModel *baseModel, int mode)
       generator->incrementNumberCutsInTotal(generator2->numberCutsInTotal());
       generator->incrementNumberCutsActive(generator2->numberCutsActive());
       generator->incrementTimeInCutGenerator(generator2->timeInCutGenerator());
+      generator->incrementGainInTree(generator2->gainInTree());
     }
     if (parallelMode() >= 0)
       nodeCompare_ = NULL;
     baseModel->maximumDepthActual_ = CoinMax(baseModel->maximumDepthActual_, maximumDepthActual_);
     baseModel->numberDJFixed_ += numberDJFixed_;
     baseModel->numberStrongIterations_ += numberStrongIterations_;
+    baseModel->numberHotStartReuses_ += numberHotStartReuses_;
+    baseModel->numberFactorizationsSaved_ += numberFactorizationsSaved_;
     int i;
     for (i = 0; i < 3; i++)
       baseModel->strongInfo_[i] += strongInfo_[i];
+    for (i = 0; i < 3; i++)
+      baseModel->lookaheadInfo_[i] += lookaheadInfo_[i];
+    for (i = 0; i < 2; i++)
+      baseModel->fastNodeInfo_[i] += fastNodeInfo_[i];
+    baseModel->nodeCache_.addStatistics(nodeCache_);
+    baseModel->globalFixing_.addStatistics(globalFixing_);
     if (parallelMode() >= 0) {
       walkback_ = NULL;
       lastNodeInfo_ = NULL;
@@ -1572,6 +1605,16 @@ void CbcModel::moveToModel(CbcModel *baseModel, int mode)
     solverCharacteristics_ = new OsiBabSolver(*baseModel->solverCharacteristics_);
     solverCharacteristics_->setSolver(solver_);
     setMaximumNodes(COIN_INT_MAX);
+    // counts are added back to base model at end
+    numberHotStartReuses_ = 0;
+    numberFactorizationsSaved_ = 0;
+    for (int i = 0; i < 3; i++)
+      lookaheadInfo_[i] = 0;
+    for (int i = 0; i < 2; i++)
+      fastNodeInfo_[i] = 0;
+    nodeCache_.clear();
+    // keeps root reduced costs and global bounds
+    globalFixing_.zeroStatistics();
     if (parallelMode() >= 0) {
       delete[] walkback_;
       //delete [] addedCuts_;
@@ -1685,6 +1728,7 @@ void CbcModel::moveToModel(CbcModel *baseModel, int mode)
           baseModel->bestSolution_ = new double[numberColumns];
         CoinCopyN(bestSolution_, numberColumns, baseModel->bestSolution_);
         baseModel->setCutoff(getCutoff());
+        baseModel->boundHistory_.addPrimal(bestObjective_);
         baseModel->handler_->message(CBC_ROUNDING, messages_)
           << bestObjective_
           << "heuristic"
@@ -1793,7 +1837,10 @@ int CbcModel::parallelCuts(CbcBaseModel *master, OsiCuts &theseCuts,
   // wait
   master->waitForThreadsInCuts(1, eachCuts, 0);
   // Now put together
+  // first row cut from each generator
+  int *generatorStart = new int[numberCutGenerators_ + 1];
   for (i = 0; i < numberCutGenerators_; i++) {
+    generatorStart[i] = theseCuts.sizeRowCuts();
     // add column cuts
     int numberColumnCutsBefore = theseCuts.sizeColCuts();
     int numberColumnCuts = eachCuts[i].sizeColCuts();
@@ -1907,6 +1954,11 @@ int CbcModel::parallelCuts(CbcBaseModel *master, OsiCuts &theseCuts,
       }
     }
   }
+  for (; i <= numberCutGenerators_; i++)
+    generatorStart[i] = theseCuts.sizeRowCuts();
+  if (status >= 0)
+    selectCuts(theseCuts, generatorStart, lastNumberCuts);
+  delete[] generatorStart;
   // Add in any violated saved cuts
   if (!theseCuts.sizeRowCuts() && !theseCuts.sizeColCuts()) {
     int numberOld = theseCuts.sizeRowCuts() + lastNumberCuts;
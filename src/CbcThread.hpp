@@ -322,6 +322,11 @@ public:
   {
     return locked_;
   }
+  /// Trace of thread which set up this one (see CbcTrace)
+  inline void *traceRun() const
+  {
+    return traceRun_;
+  }
 
 public: // private:
   CbcSpecificThread threadStuff_;
@@ -348,6 +353,7 @@ public: // private:
   int nodesThisTime_;
   int iterationsThisTime_;
   int deterministic_;
+  void *traceRun_; // trace of master when set up
 #ifdef THREAD_DEBUG
 public:
   int threadNumber_;
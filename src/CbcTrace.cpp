@@ -0,0 +1,318 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#pragma warning(disable : 4786)
+#endif
+
+#include "CbcConfig.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#ifdef CBC_THREAD
+#include <pthread.h>
+#endif
+
+#include "CoinTime.hpp"
+#include "CbcTrace.hpp"
+
+int CbcTrace::numberRecording_ = 0;
+
+namespace {
+/// One span
+typedef struct {
+  double start;
+  double end;
+  int type;
+  char name[28];
+} CbcTraceEvent;
+
+/// Ring buffer of one thread
+typedef struct {
+  CbcTraceEvent *events;
+  /// Number recorded (next is at count & mask)
+  long long count;
+  /// Thread number in trace
+  int thread;
+} CbcTraceBuffer;
+
+/// One trace (made by start)
+typedef struct {
+  /// Size of each ring buffer (power of 2)
+  int size;
+  /// True while recording
+  bool recording;
+  /// Wall clock time when started
+  double startTime;
+  /// All buffers in order of first use
+  std::vector< CbcTraceBuffer * > buffers;
+} CbcTraceRun;
+
+/// Trace of a thread and its buffer in that trace
+typedef struct {
+  CbcTraceRun *run;
+  CbcTraceBuffer *buffer;
+} CbcTraceThread;
+
+const char *typeName[CBC_TRACE_NUMBER_TYPES] = {
+  "lp", "cuts", "heuristic", "branch", "addCuts", "lock", "tree"
+};
+
+#ifdef CBC_THREAD
+/* traceMutex protects numberRecording_ and the buffer lists.  Each thread
+   keeps its trace and buffer under traceKey. */
+pthread_mutex_t traceMutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_once_t traceOnce = PTHREAD_ONCE_INIT;
+pthread_key_t traceKey;
+
+void freeThread(void *info)
+{
+  delete reinterpret_cast< CbcTraceThread * >(info);
+}
+
+void createKey()
+{
+  pthread_key_create(&traceKey, freeThread);
+}
+
+// Trace and buffer of this thread (NULL if none and create false)
+CbcTraceThread *threadInfo(bool create)
+{
+  pthread_once(&traceOnce, createKey);
+  CbcTraceThread *info = reinterpret_cast< CbcTraceThread * >(pthread_getspecific(traceKey));
+  if (!info && create) {
+    info = new CbcTraceThread;
+    info->run = NULL;
+    info->buffer = NULL;
+    pthread_setspecific(traceKey, info);
+  }
+  return info;
+}
+
+inline void lockTrace()
+{
+  pthread_mutex_lock(&traceMutex);
+}
+
+inline void unlockTrace()
+{
+  pthread_mutex_unlock(&traceMutex);
+}
+#else
+CbcTraceThread mainThread = { NULL, NULL };
+
+CbcTraceThread *threadInfo(bool)
+{
+  return &mainThread;
+}
+
+inline void lockTrace()
+{
+}
+
+inline void unlockTrace()
+{
+}
+#endif
+
+// Trace of this thread (NULL if none)
+CbcTraceRun *threadRun()
+{
+  CbcTraceThread *info = threadInfo(false);
+  return info ? info->run : NULL;
+}
+
+CbcTraceBuffer *newBuffer(CbcTraceRun *run)
+{
+  CbcTraceBuffer *buffer = new CbcTraceBuffer;
+  buffer->events = new CbcTraceEvent[run->size];
+  buffer->count = 0;
+  lockTrace();
+  buffer->thread = static_cast< int >(run->buffers.size());
+  run->buffers.push_back(buffer);
+  unlockTrace();
+  return buffer;
+}
+
+// Stops recording (must hold lock)
+void stopRun(CbcTraceRun *run)
+{
+  if (run->recording) {
+    run->recording = false;
+    CbcTrace::numberRecording_--;
+  }
+}
+
+// Stops and frees trace - no thread may still be recording into it
+void freeRun(CbcTraceRun *run)
+{
+  lockTrace();
+  stopRun(run);
+  unlockTrace();
+  for (size_t i = 0; i < run->buffers.size(); i++) {
+    delete[] run->buffers[i]->events;
+    delete run->buffers[i];
+  }
+  delete run;
+}
+
+// Writes name as JSON string
+void writeName(FILE *fp, const char *name)
+{
+  putc('"', fp);
+  for (const char *c = name; *c; c++) {
+    if (*c == '"' || *c == '\\')
+      fprintf(fp, "\\%c", *c);
+    else if (static_cast< unsigned char >(*c) < 32)
+      fprintf(fp, "\\u%04x", *c);
+    else
+      putc(*c, fp);
+  }
+  putc('"', fp);
+}
+}
+
+void CbcTrace::start(int numberEvents)
+{
+  CbcTraceThread *info = threadInfo(true);
+  if (info->run)
+    freeRun(info->run);
+  CbcTraceRun *run = new CbcTraceRun;
+  run->size = 1;
+  while (run->size < numberEvents && run->size < (1 << 24))
+    run->size <<= 1;
+  run->startTime = CoinGetTimeOfDay();
+  run->recording = true;
+  info->run = run;
+  info->buffer = NULL;
+  lockTrace();
+  numberRecording_++;
+  unlockTrace();
+}
+
+void CbcTrace::stop()
+{
+  CbcTraceRun *run = threadRun();
+  if (run) {
+    lockTrace();
+    stopRun(run);
+    unlockTrace();
+  }
+}
+
+void CbcTrace::clear()
+{
+  CbcTraceThread *info = threadInfo(false);
+  if (info && info->run) {
+    freeRun(info->run);
+    info->run = NULL;
+    info->buffer = NULL;
+  }
+}
+
+bool CbcTrace::active()
+{
+  CbcTraceRun *run = threadRun();
+  return run && run->recording;
+}
+
+double CbcTrace::now()
+{
+  CbcTraceRun *run = threadRun();
+  return run ? CoinGetTimeOfDay() - run->startTime : 0.0;
+}
+
+void CbcTrace::record(CbcTraceType type, const char *name,
+  double startTime, double endTime)
+{
+  CbcTraceThread *info = threadInfo(false);
+  if (!info || !info->run || !info->run->recording)
+    return;
+  if (!info->buffer)
+    info->buffer = newBuffer(info->run);
+  CbcTraceBuffer *buffer = info->buffer;
+  CbcTraceEvent &event = buffer->events[buffer->count & (info->run->size - 1)];
+  event.start = startTime;
+  event.end = endTime;
+  event.type = type;
+  strncpy(event.name, name, sizeof(event.name) - 1);
+  event.name[sizeof(event.name) - 1] = '\0';
+  buffer->count++;
+}
+
+long long CbcTrace::numberRecorded()
+{
+  CbcTraceRun *run = threadRun();
+  long long n = 0;
+  if (run) {
+    lockTrace();
+    for (size_t i = 0; i < run->buffers.size(); i++)
+      n += run->buffers[i]->count;
+    unlockTrace();
+  }
+  return n;
+}
+
+void *CbcTrace::current()
+{
+  return threadRun();
+}
+
+void CbcTrace::setCurrent(void *trace)
+{
+  CbcTraceThread *info = threadInfo(trace != NULL);
+  if (info && info->run != trace) {
+    info->run = reinterpret_cast< CbcTraceRun * >(trace);
+    info->buffer = NULL;
+  }
+}
+
+/* Complete ("X") events with times in microseconds.  Buffers may still
+   be added to by other threads so this should be called when search has
+   finished. */
+int CbcTrace::write(const char *fileName)
+{
+  FILE *fp = fopen(fileName, "w");
+  if (!fp)
+    return 1;
+  CbcTraceRun *run = threadRun();
+  const std::vector< CbcTraceBuffer * > noBuffers;
+  lockTrace();
+  const std::vector< CbcTraceBuffer * > &traceBuffers = run ? run->buffers : noBuffers;
+  int traceSize = run ? run->size : 1;
+  fprintf(fp, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+  bool first = true;
+  for (size_t i = 0; i < traceBuffers.size(); i++) {
+    const CbcTraceBuffer *buffer = traceBuffers[i];
+    fprintf(fp, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+                "\"tid\":%d,\"args\":{\"name\":\"%s %d\"}}",
+      first ? "" : ",\n", buffer->thread,
+      buffer->thread ? "thread" : "main", buffer->thread);
+    first = false;
+    long long count = buffer->count;
+    long long lost = count > traceSize ? count - traceSize : 0;
+    for (long long j = lost; j < count; j++) {
+      const CbcTraceEvent &event = buffer->events[j & (traceSize - 1)];
+      fprintf(fp, ",\n{\"name\":");
+      writeName(fp, event.name);
+      fprintf(fp, ",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+                  "\"pid\":1,\"tid\":%d}",
+        typeName[event.type], 1.0e6 * event.start,
+        1.0e6 * (event.end - event.start), buffer->thread);
+    }
+    if (lost)
+      fprintf(fp, ",\n{\"name\":\"%lld spans lost\",\"ph\":\"i\",\"s\":\"t\","
+                  "\"ts\":0,\"pid\":1,\"tid\":%d}",
+        lost, buffer->thread);
+  }
+  fprintf(fp, "\n]}\n");
+  unlockTrace();
+  fclose(fp);
+  return 0;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
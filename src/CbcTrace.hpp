@@ -0,0 +1,120 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+/*! \file CbcTrace.hpp
+    \brief Timeline of the search written in Chrome trace (Perfetto) format.
+*/
+
+#ifndef CbcTrace_H
+#define CbcTrace_H
+
+#include "CbcConfig.h"
+
+/// What a span was doing
+enum CbcTraceType {
+  CBC_TRACE_NODE_LP = 0,
+  CBC_TRACE_CUTS,
+  CBC_TRACE_HEURISTIC,
+  CBC_TRACE_STRONG,
+  CBC_TRACE_ADDCUTS,
+  CBC_TRACE_LOCK,
+  CBC_TRACE_TREE,
+  CBC_TRACE_NUMBER_TYPES
+};
+
+/** Search timeline.
+
+    Once started, spans (start, end, type and name) are recorded for
+    node LP solves, each cut generator call, each heuristic call, choice
+    of branch (including strong branching), restoring a node in addCuts,
+    waiting for locks in threaded search and tree operations.  Each thread
+    has its own ring buffer of numberEvents spans so recording needs no
+    lock and, if the buffer fills, the oldest spans are lost.
+
+    Each start begins a separate trace belonging to the calling thread
+    so concurrent searches in one process do not share buffers.  Threads
+    started by a search pick up the trace of the thread starting them
+    (current and setCurrent) and threads with no trace record nothing.
+    stop, write and clear act on the calling thread's trace and clear
+    must only be called once threads using that trace have finished.
+
+    write dumps all buffers as Chrome trace JSON which can be loaded
+    into chrome://tracing or ui.perfetto.dev.
+
+    When no trace is recording the cost is one test of a static count
+    per span.
+*/
+
+class CBCLIB_EXPORT CbcTrace {
+public:
+  /** Starts (or restarts) tracing for this thread with room for
+      numberEvents spans per thread (rounded up to a power of 2).
+      Any previous spans of this thread's trace are lost. */
+  static void start(int numberEvents = 1 << 20);
+  /// Stops recording (spans are kept until start or clear)
+  static void stop();
+  /** Writes spans so far in Chrome trace format.
+      Returns 0 if OK, 1 if file could not be opened. */
+  static int write(const char *fileName);
+  /// Stops and frees all buffers of this thread's trace
+  static void clear();
+  /// True if this thread is recording
+  static bool active();
+  /// Seconds since this thread's trace started
+  static double now();
+  /// Records a span for this thread (times from now())
+  static void record(CbcTraceType type, const char *name,
+    double startTime, double endTime);
+  /// Number of spans recorded (including any overwritten)
+  static long long numberRecorded();
+  /// Trace of this thread (NULL if none) - to hand on to new threads
+  static void *current();
+  /// Makes this thread record into trace (from current() of its starter)
+  static void setCurrent(void *trace);
+
+  /// Number of traces recording - only use through CbcTraceSpan
+  static int numberRecording_;
+};
+/** Records a span from construction to destruction (or finish).
+    Name must be valid until then (it is copied when recorded). */
+class CbcTraceSpan {
+public:
+  inline CbcTraceSpan(CbcTraceType type, const char *name)
+  {
+    if (CbcTrace::numberRecording_ && CbcTrace::active()) {
+      type_ = type;
+      name_ = name ? name : "";
+      start_ = CbcTrace::now();
+    } else {
+      name_ = 0;
+    }
+  }
+  inline ~CbcTraceSpan()
+  {
+    finish();
+  }
+  /// Ends span now rather than at destruction
+  inline void finish()
+  {
+    if (name_) {
+      CbcTrace::record(type_, name_, start_, CbcTrace::now());
+      name_ = 0;
+    }
+  }
+
+private:
+  CbcTraceSpan(const CbcTraceSpan &);
+  CbcTraceSpan &operator=(const CbcTraceSpan &);
+  /// Name (NULL if not recording)
+  const char *name_;
+  /// Start time
+  double start_;
+  /// Type
+  CbcTraceType type_;
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -6,6 +6,7 @@
 #include "CbcNode.hpp"
 #include "CbcTree.hpp"
 #include "CbcThread.hpp"
+#include "CbcTrace.hpp"
 #include "CbcCountRowCut.hpp"
 #include "CbcCompareActual.hpp"
 #include "CbcBranchActual.hpp"
@@ -139,6 +140,8 @@ void CbcTree::validateHeap()
 
 CbcTree::CbcTree()
 {
+  useKeys_ = true;
+  keyed_ = false;
   maximumNodeNumber_ = 0;
   numberBranching_ = 0;
   maximumBranching_ = 0;
@@ -154,6 +157,9 @@ CbcTree::~CbcTree()
 CbcTree::CbcTree(const CbcTree &rhs)
 {
   nodes_ = rhs.nodes_;
+  // comparison is not copied so order on keys again after setComparison
+  useKeys_ = rhs.useKeys_;
+  keyed_ = false;
   maximumNodeNumber_ = rhs.maximumNodeNumber_;
   numberBranching_ = rhs.numberBranching_;
   maximumBranching_ = rhs.maximumBranching_;
@@ -171,6 +177,9 @@ CbcTree::operator=(const CbcTree &rhs)
 {
   if (this != &rhs) {
     nodes_ = rhs.nodes_;
+    keys_.clear();
+    useKeys_ = rhs.useKeys_;
+    keyed_ = false;
     maximumNodeNumber_ = rhs.maximumNodeNumber_;
     delete[] branched_;
     delete[] newBound_;
@@ -192,7 +201,20 @@ CbcTree::operator=(const CbcTree &rhs)
 */
 void CbcTree::rebuild()
 {
-  std::make_heap(nodes_.begin(), nodes_.end(), comparison_);
+  CbcCompareBase *compare = comparison_.test_;
+  keyed_ = useKeys_ && compare && compare->keyed();
+  if (keyed_) {
+    // compute all keys again and heapify bottom up
+    int n = static_cast< int >(nodes_.size());
+    keys_.resize(n);
+    for (int i = 0; i < n; i++)
+      compare->fillKey(nodes_[i], keys_[i]);
+    for (int i = n / 2 - 1; i >= 0; i--)
+      keyDown(i);
+  } else {
+    keys_.clear();
+    std::make_heap(nodes_.begin(), nodes_.end(), comparison_);
+  }
 #if CBC_DEBUG_HEAP > 1
   std::cout << "  HEAP: rebuild complete." << std::endl;
 #endif
@@ -201,6 +223,56 @@ void CbcTree::rebuild()
 #endif
 }
 
+/*
+  Keyed heap - same layout as std heap (children of i at 2i+1 and 2i+2,
+  best at front) but comparing keys held alongside nodes.
+*/
+void CbcTree::keyUp(int i)
+{
+  CbcNode *node = nodes_[i];
+  CbcNodeKey key = keys_[i];
+  while (i > 0) {
+    int parent = (i - 1) >> 1;
+    if (!CbcCompareBase::keyTest(keys_[parent], key))
+      break;
+    nodes_[i] = nodes_[parent];
+    keys_[i] = keys_[parent];
+    i = parent;
+  }
+  nodes_[i] = node;
+  keys_[i] = key;
+}
+void CbcTree::keyDown(int i)
+{
+  int n = static_cast< int >(nodes_.size());
+  CbcNode *node = nodes_[i];
+  CbcNodeKey key = keys_[i];
+  while (true) {
+    int child = 2 * i + 1;
+    if (child >= n)
+      break;
+    if (child + 1 < n && CbcCompareBase::keyTest(keys_[child], keys_[child + 1]))
+      child++;
+    if (!CbcCompareBase::keyTest(key, keys_[child]))
+      break;
+    nodes_[i] = nodes_[child];
+    keys_[i] = keys_[child];
+    i = child;
+  }
+  nodes_[i] = node;
+  keys_[i] = key;
+}
+void CbcTree::keyPop()
+{
+  int last = static_cast< int >(nodes_.size()) - 1;
+  nodes_[0] = nodes_[last];
+  keys_[0] = keys_[last];
+  nodes_.pop_back();
+  keys_.pop_back();
+  if (last > 1)
+    keyDown(0);
+}
+
 // Adds branching information to complete state
 void CbcTree::addBranchingInformation(const CbcModel *model, const CbcNodeInfo *nodeInfo,
   const double *currentLower,
@@ -352,6 +424,7 @@ CbcTree::top() const
 // Add a node to the heap
 void CbcTree::push(CbcNode *x)
 {
+  CbcTraceSpan traceSpan(CBC_TRACE_TREE, "push");
   x->setNodeNumber(maximumNodeNumber_);
   lastObjective_ = x->objectiveValue();
   lastDepth_ = x->depth();
@@ -373,7 +446,14 @@ void CbcTree::push(CbcNode *x)
 #endif
   x->setOnTree(true);
   nodes_.push_back(x);
-  std::push_heap(nodes_.begin(), nodes_.end(), comparison_);
+  if (keyed_) {
+    CbcNodeKey key;
+    comparison_.test_->fillKey(x, key);
+    keys_.push_back(key);
+    keyUp(static_cast< int >(nodes_.size()) - 1);
+  } else {
+    std::push_heap(nodes_.begin(), nodes_.end(), comparison_);
+  }
 #if CBC_DEBUG_HEAP > 0
   validateHeap();
 #endif
@@ -399,8 +479,12 @@ void CbcTree::pop()
   validateHeap();
 #endif
   nodes_.front()->setOnTree(false);
-  std::pop_heap(nodes_.begin(), nodes_.end(), comparison_);
-  nodes_.pop_back();
+  if (keyed_) {
+    keyPop();
+  } else {
+    std::pop_heap(nodes_.begin(), nodes_.end(), comparison_);
+    nodes_.pop_back();
+  }
 
 #if CBC_DEBUG_HEAP > 0
   validateHeap();
@@ -428,6 +512,7 @@ bool CbcTree::empty()
 CbcNode *
 CbcTree::bestNode(double cutoff)
 {
+  CbcTraceSpan traceSpan(CBC_TRACE_TREE, "bestNode");
 #if CBC_DEBUG_HEAP > 0
   validateHeap();
 #endif
@@ -510,8 +595,12 @@ CbcTree::bestNode(double cutoff)
       << ", refd by " << info->numberPointingToThis() << "." << std::endl;
 #endif
     // take off
-    std::pop_heap(nodes_.begin(), nodes_.end(), comparison_);
-    nodes_.pop_back();
+    if (keyed_) {
+      keyPop();
+    } else {
+      std::pop_heap(nodes_.begin(), nodes_.end(), comparison_);
+      nodes_.pop_back();
+    }
   }
 #if CBC_DEBUG_HEAP > 0
   validateHeap();
@@ -528,6 +617,7 @@ CbcTree::bestNode(double cutoff)
 
 void CbcTree::cleanTree(CbcModel *model, double cutoff, double &bestPossibleObjective)
 {
+  CbcTraceSpan traceSpan(CBC_TRACE_TREE, "cleanTree");
 #if CBC_DEBUG_HEAP > 1
   std::cout << " cleanTree: beginning clean." << std::endl;
 #endif
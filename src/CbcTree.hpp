@@ -11,6 +11,7 @@
 
 #include "CoinHelperFunctions.hpp"
 #include "CbcCompare.hpp"
+#include "CbcCompareBase.hpp"
 
 /*! \brief Using MS heap implementation
 
@@ -47,6 +48,12 @@
     \brief Implementation of the live set as a heap.
 
     This class is used to hold the set of live nodes in the search tree.
+
+    If the comparison object says it is keyed() then a key is computed
+    once for each node as it is pushed (and for all nodes when the heap
+    is rebuilt, e.g. after a new solution) and the heap is ordered on
+    those keys, held in an array parallel to nodes_, so push and pop make
+    no virtual calls.
 */
 class CBCLIB_EXPORT CbcTree {
 
@@ -111,6 +118,10 @@ public:
 
   /// Return a node pointer
   inline CbcNode *nodePointer(int i) const { return nodes_[i]; }
+  /// Allow ordering on keys if comparison object can give them
+  inline void setUseKeys(bool yesNo) { useKeys_ = yesNo; }
+  /// True if heap is currently ordered on keys
+  inline bool usingKeys() const { return keyed_; }
   void realpop();
   /** After changing data in the top node, fix the heap */
   void fixTop();
@@ -192,10 +203,23 @@ public:
 #endif
 
 protected:
+  /// Moves node at position i up heap (keyed)
+  void keyUp(int i);
+  /// Moves node at position i down heap (keyed)
+  void keyDown(int i);
+  /// Takes top node off heap (keyed)
+  void keyPop();
+
   /// Storage vector for the heap
   std::vector< CbcNode * > nodes_;
+  /// Keys for nodes_ (same order) if keyed_
+  std::vector< CbcNodeKey > keys_;
   /// Sort predicate for heap ordering.
   CbcCompare comparison_;
+  /// Allow ordering on keys
+  bool useKeys_;
+  /// Heap ordered on keys_
+  bool keyed_;
   /// Maximum "node" number so far to split ties
   int maximumNodeNumber_;
   /// Size of variable list
@@ -40,6 +40,8 @@ CbcTreeLocal::CbcTreeLocal()
   , searchType_(-1)
   , refine_(false)
 {
+  // own push and pop use comparison
+  useKeys_ = false;
 }
 /* Constructor with solution.
    range is upper bound on difference from given solution.
@@ -72,6 +74,8 @@ CbcTreeLocal::CbcTreeLocal(CbcModel *model, const double *solution,
   , searchType_(-1)
   , refine_(refine)
 {
+  // own push and pop use comparison
+  useKeys_ = false;
 
   OsiSolverInterface *solver = model_->solver();
   const double *lower = solver->getColLower();
@@ -901,6 +905,8 @@ CbcTreeVariable::CbcTreeVariable()
   , searchType_(-1)
   , refine_(false)
 {
+  // own push and pop use comparison
+  useKeys_ = false;
 }
 /* Constructor with solution.
    range is upper bound on difference from given solution.
@@ -933,6 +939,8 @@ CbcTreeVariable::CbcTreeVariable(CbcModel *model, const double *solution,
   , searchType_(-1)
   , refine_(refine)
 {
+  // own push and pop use comparison
+  useKeys_ = false;
 
   OsiSolverInterface *solver = model_->solver();
   const double *lower = solver->getColLower();
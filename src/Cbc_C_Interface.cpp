@@ -24,6 +24,7 @@
 #include "CoinTime.hpp"
 
 #include "CbcModel.hpp"
+#include "CbcProgressStream.hpp"
 #include "CbcSolver.hpp"
 #include "CbcBranchActual.hpp"
 
@@ -51,11 +52,13 @@
 #include "CglZeroHalf.hpp"
 #include "CglLandP.hpp"
 #include "CbcCutGenerator.hpp"
+#include "CbcLazyConstraints.hpp"
 #include "ClpDualRowSteepest.hpp"
 #include "ClpDualRowDantzig.hpp"
 #include "ClpPEDualRowSteepest.hpp"
 #include "ClpPEDualRowDantzig.hpp"
 #include "CbcMipStartIO.hpp"
+#include "CbcBinaryModel.hpp"
 #include "ClpMessage.hpp"
 #include "CoinStaticConflictGraph.hpp"
 #include <OsiAuxInfo.hpp>
@@ -66,6 +69,10 @@ using namespace std;
 static void *xmalloc( const size_t size );
 static void *xrealloc( void *ptr, const size_t newSize );
 static void Cbc_updateSlack( Cbc_Model *model, const double *ractivity );
+static void fillAllNameIndexes(Cbc_Model *model);
+static void Cbc_unpackNames(const char *names, int n, int first,
+  std::vector< const char * > &ptrs, void *nameIndex);
+static void Cbc_progressStreamLine(const char *line, void *data);
 
 #define VALIDATE_ROW_INDEX(iRow, model)  \
       if (iRow<0 || iRow >= Cbc_getNumRows(model)) { \
@@ -229,6 +236,14 @@ struct Cbc_Model {
    **/
   void *pgrAppData;
 
+  /**
+   * JSON lines progress - to callback or file
+   **/
+  cbc_stream_callback stream_callback;
+  void *streamAppData;
+  string progressFile;
+  double progressInterval;
+
 #ifdef CBC_THREAD
   pthread_mutex_t cbcMutexCG;
   pthread_mutex_t cbcMutexEvent;
@@ -263,7 +278,7 @@ struct Cbc_Model {
   enum DualPivot dualp;
 
   // lazy constraints
-  CglStored *lazyConstrs;
+  CbcLazyConstraints *lazyConstrs;
 
   int int_param[N_INT_PARAMS];
   double dbl_param[N_DBL_PARAMS];
@@ -289,6 +304,11 @@ struct Cbc_Model {
   double mipBestPossibleObjValue;
   int mipNumSavedSolutions;
   int mipNodeCount;
+  double mipPrimalIntegral;
+  double mipDualIntegral;
+  double mipPrimalDualIntegral;
+  double mipTimeToFirstSolution;
+  double mipTimeToOnePercent;
   std::vector< std::vector< double > > *mipSavedSolution;
   std::vector< double > *mipSavedSolutionObj;
   std::vector< double > *mipBestSolution;
@@ -721,13 +741,19 @@ static void Cbc_flushCols(Cbc_Model *model) {
   solver->addCols( model->nCols, model->cStart, model->cIdx, model->cCoef, model->cLB, model->cUB, model->cObj );
 
   if (model->nInt) {
+    std::vector< int > intCols;
+    intCols.reserve(model->nInt);
     for ( int i=0 ; i<model->nCols; ++i )
       if (model->cInt[i])
-        solver->setInteger( colsBefore+i );
+        intCols.push_back( colsBefore+i );
+    solver->setInteger( &intCols[0], (int)intCols.size() );
   }
 
+  // names in one pass, straight from the buffer
+  std::vector< const char * > names(model->nCols);
   for ( int i=0 ; i<model->nCols; ++i )
-    solver->setColName( colsBefore+i, std::string(model->cNames+model->cNameStart[i]) );
+    names[i] = model->cNames+model->cNameStart[i];
+  solver->getModelPtr()->copyColumnNames( &names[0], colsBefore, colsBefore+model->nCols );
 
   model->nCols = 0;
   model->cStart[0] = 0;
@@ -744,12 +770,10 @@ static void Cbc_flushRows(Cbc_Model *model) {
   int rowsBefore = solver->getNumRows();
   solver->addRows(model->nRows, model->rStart, model->rIdx, model->rCoef, model->rLB, model->rUB);
 
+  std::vector< const char * > names(model->nRows);
   for ( int i=0 ; i<model->nRows; ++i )
-  {
-    const int rIdx = rowsBefore+i;
-    const std::string rName = std::string(model->rNames+model->rNameStart[i]);
-    solver->setRowName(rIdx, rName);
-  }
+    names[i] = model->rNames+model->rNameStart[i];
+  solver->getModelPtr()->copyRowNames( &names[0], rowsBefore, rowsBefore+model->nRows );
 
   model->nRows = 0;
   model->rStart[0] = 0;
@@ -1160,6 +1184,9 @@ Cbc_newModel()
 
   model->icAppData = NULL;
   model->pgrAppData = NULL;
+  model->stream_callback = NULL;
+  model->streamAppData = NULL;
+  model->progressInterval = 5.0;
 
   model->colNameIndex = NULL;
   model->rowNameIndex = NULL;
@@ -1282,6 +1309,111 @@ Cbc_loadProblem(Cbc_Model *model, const int numcols, const int numrows,
     collb, colub, obj, rowlb, rowub);
 } //  Cbc_loadProblem()
 
+/* freeCachedResults is protected in OsiClpSolverInterface - reach it
+   through a derived class so row copies, senses etc are rebuilt after
+   the matrix is swapped under the interface */
+class Cbc_ClpCachedResults : public OsiClpSolverInterface {
+public:
+  static void reset(OsiClpSolverInterface *solver)
+  {
+    void (OsiClpSolverInterface::*method)() const = &Cbc_ClpCachedResults::freeCachedResults;
+    (solver->*method)();
+  }
+};
+
+/* Loads a problem adopting matrix arrays */
+void CBC_LINKAGE
+Cbc_assignProblem(Cbc_Model *model, const int numcols, const int numrows,
+  CoinBigIndex *start, int *index, double *value,
+  double *collb, double *colub, double *obj,
+  double *rowlb, double *rowub,
+  const char *isInteger, const char *colNames, const char *rowNames)
+{
+  Cbc_deleteColBuffer(model);
+  Cbc_deleteRowBuffer(model);
+  Cbc_iniBuffer(model);
+
+  OsiClpSolverInterface *solver = model->solver_;
+
+  // bounds with an empty matrix of the right shape
+  {
+    CoinPackedMatrix empty(true, 0.0, 0.0);
+    empty.setDimensions(numrows, numcols);
+    solver->loadProblem(empty, collb, colub, obj, rowlb, rowub);
+  }
+  delete[] collb;
+  delete[] colub;
+  delete[] obj;
+  delete[] rowlb;
+  delete[] rowub;
+
+  // then hand matrix arrays over - no copy
+  CoinPackedMatrix *matrix = new CoinPackedMatrix();
+  int *length = NULL;
+  matrix->assignMatrix(true, numrows, numcols, start[numcols],
+    value, index, start, length);
+  solver->getModelPtr()->replaceMatrix(matrix, true);
+  solver->getModelPtr()->setWhatsChanged(0);
+  Cbc_ClpCachedResults::reset(solver);
+
+  if (isInteger) {
+    std::vector< int > intCols;
+    for ( int i=0 ; i<numcols ; ++i )
+      if (isInteger[i])
+        intCols.push_back(i);
+    if (intCols.size())
+      solver->setInteger(&intCols[0], (int)intCols.size());
+  }
+
+  std::vector< const char * > ptrs;
+  if (rowNames) {
+    Cbc_unpackNames(rowNames, numrows, 0, ptrs, NULL);
+    solver->getModelPtr()->copyRowNames(&ptrs[0], 0, numrows);
+  }
+  if (colNames) {
+    Cbc_unpackNames(colNames, numcols, 0, ptrs, NULL);
+    solver->getModelPtr()->copyColumnNames(&ptrs[0], 0, numcols);
+  }
+
+  fillAllNameIndexes(model);
+}
+
+CoinBigIndex * CBC_LINKAGE
+Cbc_newBigIndexArray(size_t size)
+{
+  return new CoinBigIndex[size];
+}
+
+int * CBC_LINKAGE
+Cbc_newIntArray(size_t size)
+{
+  return new int[size];
+}
+
+double * CBC_LINKAGE
+Cbc_newDoubleArray(size_t size)
+{
+  return new double[size];
+}
+
+void CBC_LINKAGE
+Cbc_deleteBigIndexArray(CoinBigIndex *array)
+{
+  delete[] array;
+}
+
+void CBC_LINKAGE
+Cbc_deleteIntArray(int *array)
+{
+  delete[] array;
+}
+
+void CBC_LINKAGE
+Cbc_deleteDoubleArray(double *array)
+{
+  delete[] array;
+}
+
 /* should be called after reading a new problem */
 static void fillAllNameIndexes(Cbc_Model *model)
 {
@@ -1400,6 +1532,62 @@ Cbc_readLp(Cbc_Model *model, const char *filename)
   return result;
 }
 
+/** Reads a model in native binary format
+ *
+ * @param model problem object
+ * @param fileName file name */
+int CBC_LINKAGE
+Cbc_readBinary(Cbc_Model *model, const char *filename)
+{
+  CbcBinaryModel binaryModel;
+  int status = binaryModel.open(filename);
+  if (status) {
+    if (model->int_param[INT_PARAM_LOG_LEVEL] > 0) {
+      fflush(stdout); fflush(stderr);
+      fprintf(stderr, "Could not read binary model %s (error %d).\n", filename, status);
+      fflush(stderr);
+    }
+    return status;
+  }
+
+  OsiClpSolverInterface *solver = model->solver_;
+  if (binaryModel.loadInto(solver)) {
+    if (model->int_param[INT_PARAM_LOG_LEVEL] > 0) {
+      fflush(stdout); fflush(stderr);
+      fprintf(stderr, "Binary model %s can not be loaded into this build.\n", filename);
+      fflush(stderr);
+    }
+    return 8;
+  }
+
+  Cbc_deleteColBuffer(model);
+  Cbc_deleteRowBuffer(model);
+  Cbc_iniBuffer(model);
+
+  fillAllNameIndexes(model);
+
+  if (binaryModel.mipStart())
+    Cbc_setInitialSolution(model, binaryModel.mipStart());
+
+  return 0;
+}
+
+/** Writes a model in native binary format
+ *
+ * @param model problem object
+ * @param fileName file name */
+int CBC_LINKAGE
+Cbc_writeBinary(Cbc_Model *model, const char *filename)
+{
+  Cbc_flush(model);
+
+  const double *mipStart = NULL;
+  if (model->iniSol && (int)model->iniSol->size() == Cbc_getNumCols(model))
+    mipStart = VEC_PTR(model->iniSol);
+
+  return CbcBinaryModel::write(model->solver_, filename, mipStart);
+}
+
 /** @brief If Cbc was built with gzip compressed files support
   *
   * @return 1 if yes, 0 otherwise
@@ -2083,6 +2271,11 @@ static void Cbc_cleanOptResults(Cbc_Model *model) {
   model->mipBestPossibleObjValue = COIN_DBL_MIN;
   model->mipNumSavedSolutions = 0;
   model->mipNodeCount = 0;
+  model->mipPrimalIntegral = 0.0;
+  model->mipDualIntegral = 0.0;
+  model->mipPrimalDualIntegral = 0.0;
+  model->mipTimeToFirstSolution = -1.0;
+  model->mipTimeToOnePercent = -1.0;
   model->mipIterationCount = 0;
   model->x = NULL;
   model->rActv = NULL;
@@ -2106,6 +2299,12 @@ static void Cbc_getMIPOptimizationResults( Cbc_Model *model, CbcModel &cbcModel
   model->mipNodeCount = cbcModel.getNodeCount();
   model->mipNumSavedSolutions = cbcModel.numberSavedSolutions();
   model->mipBestPossibleObjValue = cbcModel.getBestPossibleObjValue();
+  const CbcBoundHistory &history = cbcModel.boundHistory();
+  model->mipPrimalIntegral = history.primalIntegral();
+  model->mipDualIntegral = history.dualIntegral();
+  model->mipPrimalDualIntegral = history.primalDualIntegral();
+  model->mipTimeToFirstSolution = history.timeToFirstSolution();
+  model->mipTimeToOnePercent = history.timeToOnePercent();
 
   int numSols = model->mipNumSavedSolutions;
 
@@ -2234,11 +2433,12 @@ Cbc_solve(Cbc_Model *model)
     OsiClpSolverInterface linearProgram(*solver);
     CbcModel cbcModel(linearProgram);
     try {
-      /* stored lazy Constraints */
-      if (model->lazyConstrs) {
-        cbcModel.addCutGenerator(model->lazyConstrs, 1, "Stored LazyConstraints", true, 1);
-        model->cutCBAtSol = 1;
-      }
+      /* stored lazy constraints - checked at every node and solution
+         (solver type 4 below so a solution which violates one is rejected)
+         and mapped through pre-processing, so pre-processing and heuristics
+         can stay on */
+      if (model->lazyConstrs)
+        cbcModel.addCutGenerator(model->lazyConstrs, 1, "LazyConstraints", true, 1);
 
       Cbc_EventHandler *cbc_eh = NULL;
       if (model->inc_callback!=NULL || model->progr_callback!=NULL)
@@ -2278,7 +2478,7 @@ Cbc_solve(Cbc_Model *model)
       }
 
       if (model->cutCBAtSol) {
-        /* lazy constraints require no pre-processing and no heuristics */
+        /* cut callback at solutions requires no pre-processing and no heuristics */
         Cbc_setParameter(model, "preprocess", "off");
         Cbc_setParameter(model, "heur", "off");
         Cbc_setParameter(model, "cgraph", "off");
@@ -2376,7 +2576,8 @@ Cbc_solve(Cbc_Model *model)
       inputQueue.push_back("-quit");
 
       OsiBabSolver defaultC;
-      if (model->cutCBAtSol) {
+      if (model->cutCBAtSol || model->lazyConstrs) {
+        /* solutions are only feasible once no cuts are added */
         defaultC.setSolverType(4);
         cbcModel.solver()->setAuxiliaryInfo(&defaultC);
         cbcModel.passInSolverCharacteristics(&defaultC);
@@ -2401,6 +2602,20 @@ Cbc_solve(Cbc_Model *model)
 
       synchronizeParams(&cbcModel, &parameters);
 
+      CbcProgressStream progressStream;
+      if (model->stream_callback || model->progressFile.size()) {
+        progressStream.setInterval(model->progressInterval);
+        if (model->stream_callback) {
+          progressStream.setCallback(Cbc_progressStreamLine, model);
+          cbcModel.setProgressStream(&progressStream);
+        } else if (!progressStream.open(model->progressFile.c_str())) {
+          cbcModel.setProgressStream(&progressStream);
+        } else {
+          fprintf(stderr, "Unable to open progress file %s\n",
+            model->progressFile.c_str());
+        }
+      }
+
       CbcMain1(inputQueue, cbcModel, parameters, cbc_callb);
 
       Cbc_getMIPOptimizationResults( model, cbcModel );
@@ -2437,6 +2652,29 @@ void CBC_LINKAGE Cbc_addProgrCallback(
   model->pgrAppData = appData;
 }
 
+// passes line from CbcProgressStream to user callback
+static void Cbc_progressStreamLine(const char *line, void *data)
+{
+  Cbc_Model *model = (Cbc_Model *)data;
+  model->stream_callback(line, model->streamAppData);
+}
+
+void CBC_LINKAGE Cbc_addProgressStreamCallback(
+  Cbc_Model *model, cbc_stream_callback streamcb,
+  double interval, void *appData)
+{
+  model->stream_callback = streamcb;
+  model->streamAppData = appData;
+  model->progressInterval = interval;
+}
+
+void CBC_LINKAGE Cbc_setProgressStreamFile(
+  Cbc_Model *model, const char *fileName, double interval)
+{
+  model->progressFile = fileName ? fileName : "";
+  model->progressInterval = interval;
+}
+
 void CBC_LINKAGE Cbc_addCutCallback( 
     Cbc_Model *model, 
     cbc_cut_callback cutcb, 
@@ -3252,6 +3490,52 @@ Cbc_getNodeCount(Cbc_Model *model) {
   return false;
 }
 
+// aborts if no integer optimization results
+static void Cbc_checkIntegerResults(Cbc_Model *model) {
+  switch (model->lastOptimization) {
+    case ModelNotOptimized:
+      fprintf( stderr, "Information not available, model was not optimized yet.\n");
+      abort();
+      break;
+    case ContinuousOptimization:
+      fprintf( stderr, "Information only available when optimizing integer models.\n");
+      abort();
+      break;
+    case IntegerOptimization:
+      break;
+  }
+}
+
+double CBC_LINKAGE
+Cbc_getPrimalIntegral(Cbc_Model *model) {
+  Cbc_checkIntegerResults(model);
+  return model->mipPrimalIntegral;
+}
+
+double CBC_LINKAGE
+Cbc_getDualIntegral(Cbc_Model *model) {
+  Cbc_checkIntegerResults(model);
+  return model->mipDualIntegral;
+}
+
+double CBC_LINKAGE
+Cbc_getPrimalDualIntegral(Cbc_Model *model) {
+  Cbc_checkIntegerResults(model);
+  return model->mipPrimalDualIntegral;
+}
+
+double CBC_LINKAGE
+Cbc_getTimeToFirstSolution(Cbc_Model *model) {
+  Cbc_checkIntegerResults(model);
+  return model->mipTimeToFirstSolution;
+}
+
+double CBC_LINKAGE
+Cbc_getTimeToOnePercent(Cbc_Model *model) {
+  Cbc_checkIntegerResults(model);
+  return model->mipTimeToOnePercent;
+}
+
 
 /** Return a copy of this model */
 Cbc_Model *CBC_LINKAGE
@@ -3267,6 +3551,10 @@ Cbc_clone(Cbc_Model *model)
 
   result->inc_callback = model->inc_callback;
   result->progr_callback = model->progr_callback;
+  result->stream_callback = model->stream_callback;
+  result->streamAppData = model->streamAppData;
+  result->progressFile = model->progressFile;
+  result->progressInterval = model->progressInterval;
   result->userCallBack = model->userCallBack;
 
   result->cut_callback = model->cut_callback;
@@ -3376,6 +3664,11 @@ Cbc_clone(Cbc_Model *model)
   result-> mipBestPossibleObjValue = model-> mipBestPossibleObjValue;
   result->mipNumSavedSolutions = model->mipNumSavedSolutions;
   result->mipNodeCount = model->mipNodeCount;
+  result->mipPrimalIntegral = model->mipPrimalIntegral;
+  result->mipDualIntegral = model->mipDualIntegral;
+  result->mipPrimalDualIntegral = model->mipPrimalDualIntegral;
+  result->mipTimeToFirstSolution = model->mipTimeToFirstSolution;
+  result->mipTimeToOnePercent = model->mipTimeToOnePercent;
 
   if (model->mipSavedSolution) {
     result->mipSavedSolution = new vector< vector<double> >(model->mipSavedSolution->begin(), model->mipSavedSolution->end());
@@ -3489,6 +3782,78 @@ Cbc_addCol(Cbc_Model *model, const char *name, double lb,
   }
 }
 
+/* pointers to names in a packed buffer of '\0' terminated names,
+ * also updating name index if active */
+static void Cbc_unpackNames(const char *names, int n, int first,
+  std::vector< const char * > &ptrs, void *nameIndex)
+{
+  ptrs.resize(n);
+  const char *p = names;
+  for ( int i=0 ; i<n ; ++i ) {
+    ptrs[i] = p;
+    p += strlen(p) + 1;
+  }
+
+  if (nameIndex) {
+    NameIndex &index = *((NameIndex *)nameIndex);
+    for ( int i=0 ; i<n ; ++i )
+      index[std::string(ptrs[i])] = first + i;
+  }
+}
+
+/** Adds a block of columns */
+void CBC_LINKAGE
+Cbc_addCols(Cbc_Model *model, int numCols, const CoinBigIndex *start,
+  const int *rows, const double *coefs, const double *lb, const double *ub,
+  const double *obj, const char *isInteger, const char *names)
+{
+  if (numCols <= 0)
+    return;
+
+  Cbc_flush(model);
+
+  OsiClpSolverInterface *solver = model->solver_;
+  int colsBefore = solver->getNumCols();
+  solver->addCols(numCols, start, rows, coefs, lb, ub, obj);
+
+  if (isInteger) {
+    std::vector< int > intCols;
+    for ( int i=0 ; i<numCols ; ++i )
+      if (isInteger[i])
+        intCols.push_back(colsBefore + i);
+    if (intCols.size())
+      solver->setInteger(&intCols[0], (int)intCols.size());
+  }
+
+  if (names) {
+    std::vector< const char * > ptrs;
+    Cbc_unpackNames(names, numCols, colsBefore, ptrs, model->colNameIndex);
+    solver->getModelPtr()->copyColumnNames(&ptrs[0], colsBefore, colsBefore + numCols);
+  }
+}
+
+/** Adds a block of rows */
+void CBC_LINKAGE
+Cbc_addRows(Cbc_Model *model, int numRows, const CoinBigIndex *start,
+  const int *cols, const double *coefs, const double *rowLB,
+  const double *rowUB, const char *names)
+{
+  if (numRows <= 0)
+    return;
+
+  Cbc_flush(model);
+
+  OsiClpSolverInterface *solver = model->solver_;
+  int rowsBefore = solver->getNumRows();
+  solver->addRows(numRows, start, cols, coefs, rowLB, rowUB);
+
+  if (names) {
+    std::vector< const char * > ptrs;
+    Cbc_unpackNames(names, numRows, rowsBefore, ptrs, model->rowNameIndex);
+    solver->getModelPtr()->copyRowNames(&ptrs[0], rowsBefore, rowsBefore + numRows);
+  }
+}
+
 /** Adds a new row */
 void CBC_LINKAGE
 Cbc_addRow(Cbc_Model *model, const char *name, int nz,
@@ -3542,41 +3907,38 @@ Cbc_addLazyConstraint(Cbc_Model *model, int nz,
   int *cols, double *coefs, char sense, double rhs)
 {
   if (model->lazyConstrs==NULL)
-    model->lazyConstrs = new CglStored();
+    model->lazyConstrs = new CbcLazyConstraints();
 
-  OsiRowCut orc;
-  orc.setRow( nz, cols, coefs );
-
-  orc.setLb(-DBL_MAX);
-  orc.setUb(DBL_MAX);
+  double lower = -DBL_MAX;
+  double upper = DBL_MAX;
 
   switch (toupper(sense)) {
   case '=':
-    orc.setLb(rhs);
-    orc.setUb(rhs);
+    lower = rhs;
+    upper = rhs;
     break;
   case 'E':
-    orc.setLb(rhs);
-    orc.setUb(rhs);
+    lower = rhs;
+    upper = rhs;
     break;
   case '<':
-    orc.setUb(rhs);
+    upper = rhs;
     break;
   case 'L':
-    orc.setUb(rhs);
+    upper = rhs;
     break;
   case '>':
-    orc.setLb(rhs);
+    lower = rhs;
     break;
   case 'G':
-    orc.setLb(rhs);
+    lower = rhs;
     break;
   default:
     fprintf(stderr, "unknown row sense %c.", toupper(sense));
     abort();
   }
 
-  model->lazyConstrs->addCut(orc);
+  model->lazyConstrs->addRow(nz, cols, coefs, lower, upper);
 }
 
 void CBC_LINKAGE
@@ -3585,8 +3947,10 @@ Cbc_readMIPStart(Cbc_Model *model, const char fileName[]) {
   double obj;
   CoinMessages generalMessages = model->solver_->getModelPtr()->messages();
   CoinMessageHandler *messHandler = model->solver_->messageHandler();
-  CbcMipStartIO::read(model->solver_, fileName, colValues, obj, messHandler, &generalMessages);
-  
+  if (CbcMipStartIO::read(model->solver_, fileName, colValues, obj, messHandler, &generalMessages)
+    || colValues.empty())
+    return;
+
   char **cnames = new char*[colValues.size()];
   size_t charSpace = 0;
   for ( int i=0 ; (i<(int)colValues.size()) ; ++i )
@@ -4894,7 +5258,9 @@ void CBC_LINKAGE Cbc_getBuildInfo(char *str) {
   strcat(str, s);
 #endif
   strcat(str, "Components:\n");
-#ifdef CBC_HAS_NAUTY
+#ifdef CBC_NAUTY_BUILTIN
+  strcat(str, "  nauty: no (built-in symmetry search)\n");
+#elif defined(CBC_HAS_NAUTY)
   strcat(str, "  nauty: yes\n");
 #else
   strcat(str, "  nauty: no\n");
@@ -144,6 +144,10 @@ typedef int(CBC_LINKAGE_CB *cbc_progress_callback)(void *model,
  * of new integer feasible solutions */
 typedef int (CBC_LINKAGE_CB *cbc_incumbent_callback)(void *cbcModel, double obj, int nz, char **vnames, double *x, void *appData);
 
+/** typedef for cbc callback to receive progress of the search
+ * as JSON lines (one object per call, see CbcProgressStream.hpp) */
+typedef void(CBC_LINKAGE_CB *cbc_stream_callback)(const char *jsonLine, void *appData);
+
 typedef void(CBC_LINKAGE_CB *cbc_callback)(Cbc_Model *model, int msgno, int ndouble,
   const double *dvec, int nint, const int *ivec,
   int nchar, char **cvec);
@@ -220,6 +224,29 @@ Cbc_addCol(Cbc_Model *model, const char *name, double lb,
   double ub, double obj, char isInteger,
   int nz, int *rows, double *coefs);
 
+/** @brief Adds a block of columns
+  *
+  * Adds several columns at once, given in compressed sparse column
+  * format.  Columns are added directly to the problem (no intermediate
+  * buffer), so this is much faster than repeated calls to Cbc_addCol 
+  * for large models.  Rows referenced must already exist.
+  *
+  * @param model problem object
+  * @param numCols number of columns
+  * @param start column starts, numCols+1 entries (start[0] may be nonzero)
+  * @param rows row indices of nonzeros
+  * @param coefs values of nonzeros
+  * @param lb column lower bounds (NULL for 0)
+  * @param ub column upper bounds (NULL for infinity)
+  * @param obj objective coefficients (NULL for 0)
+  * @param isInteger 1 for integer columns, 0 otherwise (NULL if all continuous)
+  * @param names packed names, each terminated by '\0' (NULL for default names)
+  ***/
+CBCLIB_EXPORT void CBC_LINKAGE
+Cbc_addCols(Cbc_Model *model, int numCols, const CoinBigIndex *start,
+  const int *rows, const double *coefs, const double *lb, const double *ub,
+  const double *obj, const char *isInteger, const char *names);
+
 
 /** @brief Deletes some columns
   *
@@ -248,12 +275,34 @@ CBCLIB_EXPORT void CBC_LINKAGE
 Cbc_addRow(Cbc_Model *model, const char *name, int nz,
   const int *cols, const double *coefs, char sense, double rhs);
 
+/** @brief Adds a block of rows
+  *
+  * Adds several rows at once, given in compressed sparse row format.
+  * Rows are added directly to the problem (no intermediate buffer).
+  * Columns referenced must already exist.
+  *
+  * @param model problem object
+  * @param numRows number of rows
+  * @param start row starts, numRows+1 entries (start[0] may be nonzero)
+  * @param cols column indices of nonzeros
+  * @param coefs values of nonzeros
+  * @param rowLB row lower bounds (NULL for -infinity)
+  * @param rowUB row upper bounds (NULL for infinity)
+  * @param names packed names, each terminated by '\0' (NULL for default names)
+  * */
+CBCLIB_EXPORT void CBC_LINKAGE
+Cbc_addRows(Cbc_Model *model, int numRows, const CoinBigIndex *start,
+  const int *cols, const double *coefs, const double *rowLB,
+  const double *rowUB, const char *names);
+
 
 /** @brief Adds a lazy constraint
  *
  *  This method adds a lazy constraint, i.e. a constraint
  *  that will be included in the model only after the first
- *  integer solution violating it is generated. 
+ *  solution violating it is generated. Only constraints on
+ *  variables whose values changed are checked again, and
+ *  pre-processing and heuristics stay on.
  *
  **/
 CBCLIB_EXPORT void CBC_LINKAGE
@@ -306,6 +355,51 @@ Cbc_loadProblem(Cbc_Model *model, const int numcols, const int numrows,
   const double *obj,
   const double *rowlb, const double *rowub);
 
+/** @brief Loads a problem taking ownership of the arrays
+  *
+  * Same as Cbc_loadProblem (column major, start[0] = 0) but the
+  * constraint matrix arrays
+  * (start, index and value) are adopted by the model without being 
+  * copied and all arrays are freed by the model, so the caller must 
+  * not use or free them afterwards.  All arrays must be allocated 
+  * with Cbc_newBigIndexArray, Cbc_newIntArray or Cbc_newDoubleArray.
+  * Names and integrality are optional and are not adopted.
+  *
+  * @param isInteger 1 for integer columns, 0 otherwise (NULL if all continuous)
+  * @param colNames packed column names, each terminated by '\0' (may be NULL)
+  * @param rowNames packed row names, each terminated by '\0' (may be NULL)
+  */
+CBCLIB_EXPORT void CBC_LINKAGE
+Cbc_assignProblem(Cbc_Model *model, const int numcols, const int numrows,
+  CoinBigIndex *start, int *index, double *value,
+  double *collb, double *colub, double *obj,
+  double *rowlb, double *rowub,
+  const char *isInteger, const char *colNames, const char *rowNames);
+
+/** @brief Allocates an array which can be handed to Cbc_assignProblem */
+CBCLIB_EXPORT CoinBigIndex * CBC_LINKAGE
+Cbc_newBigIndexArray(size_t size);
+
+/** @brief Allocates an array which can be handed to Cbc_assignProblem */
+CBCLIB_EXPORT int * CBC_LINKAGE
+Cbc_newIntArray(size_t size);
+
+/** @brief Allocates an array which can be handed to Cbc_assignProblem */
+CBCLIB_EXPORT double * CBC_LINKAGE
+Cbc_newDoubleArray(size_t size);
+
+/** @brief Frees an array from Cbc_newBigIndexArray not handed to Cbc_assignProblem */
+CBCLIB_EXPORT void CBC_LINKAGE
+Cbc_deleteBigIndexArray(CoinBigIndex *array);
+
+/** @brief Frees an array from Cbc_newIntArray not handed to Cbc_assignProblem */
+CBCLIB_EXPORT void CBC_LINKAGE
+Cbc_deleteIntArray(int *array);
+
+/** @brief Frees an array from Cbc_newDoubleArray not handed to Cbc_assignProblem */
+CBCLIB_EXPORT void CBC_LINKAGE
+Cbc_deleteDoubleArray(double *array);
+
 /** @brief Set the name of a column 
   *
   * @param model problem object 
@@ -836,6 +930,22 @@ Cbc_readMps(Cbc_Model *model, const char *filename);
 CBCLIB_EXPORT int CBC_LINKAGE
 Cbc_readLp(Cbc_Model *model, const char *filename);
 
+/** @brief Read a model saved in Cbc native binary format
+  *
+  * The file is mapped into memory and loaded without parsing.
+  * If the file contains a MIP start it is used as initial solution.
+  *
+  * @param model problem object
+  * @param fileName file name 
+  * @return 0 if OK, otherwise 1 - cannot open, 2 - not a Cbc binary file,
+  *         3 - unsupported version, 4 - different byte order,
+  *         5 - truncated, 6 - checksum error, 7 - inconsistent data
+  *         (bad sizes, starts, indices or names), 8 - model can not be
+  *         loaded into this build (e.g. too many elements)
+  **/
+CBCLIB_EXPORT int CBC_LINKAGE
+Cbc_readBinary(Cbc_Model *model, const char *filename);
+
 /** @brief Read the optimal basis for the linear program
   *
   * @param model problem object
@@ -862,6 +972,19 @@ Cbc_writeMps(Cbc_Model *model, const char *filename);
 CBCLIB_EXPORT void CBC_LINKAGE
 Cbc_writeLp(Cbc_Model *model, const char *filename);
 
+/** @brief Write model in Cbc native binary format
+  *
+  * Writes matrix, bounds, integrality, SOS, names and, if set, 
+  * the initial solution.  The file can be read back quickly by 
+  * Cbc_readBinary or by the cbc executable (import of a .cbcb file).
+  *
+  * @param model problem object
+  * @param fileName file name 
+  * @return 0 if OK, 1 on IO error
+  **/
+CBCLIB_EXPORT int CBC_LINKAGE
+Cbc_writeBinary(Cbc_Model *model, const char *filename);
+
 /** @brief Saves the optimal basis for the linear program
   *
   * @param model problem object
@@ -1134,6 +1257,19 @@ CBCLIB_EXPORT void CBC_LINKAGE Cbc_addProgrCallback(
   Cbc_Model *model, cbc_progress_callback prgcbc,
   void *appData);
 
+/** callback to receive progress of the search as JSON lines - on start,
+ * root cut passes, new solutions, bound improvements, restarts and end
+ * and every interval seconds with counters for cut generators, heuristics
+ * and threads. Cheap enough to leave on. */
+CBCLIB_EXPORT void CBC_LINKAGE Cbc_addProgressStreamCallback(
+  Cbc_Model *model, cbc_stream_callback streamcb,
+  double interval, void *appData);
+
+/** appends progress of the search as JSON lines to a file
+ * (see Cbc_addProgressStreamCallback), NULL to switch off */
+CBCLIB_EXPORT void CBC_LINKAGE Cbc_setProgressStreamFile(
+  Cbc_Model *model, const char *fileName, double interval);
+
 /*@}*/
 
 /**@name Solving the model */
@@ -1404,6 +1540,48 @@ Cbc_getRowSlack(Cbc_Model *model);
 CBCLIB_EXPORT int CBC_LINKAGE
 Cbc_getNodeCount(Cbc_Model *model);
 
+/** @brief Primal integral of last integer optimization
+  *
+  * Integral over wall clock seconds of the gap between incumbent and final
+  * incumbent, where the gap between a and b is |a-b|/max(|a|,|b|) and is 1
+  * while there is no solution.  Smaller is better - 0 if the optimum was
+  * there from the start, search time if nothing was found.
+  *
+  * @param model problem object
+  * @return primal integral (gap seconds)
+  **/
+CBCLIB_EXPORT double CBC_LINKAGE
+Cbc_getPrimalIntegral(Cbc_Model *model);
+
+/** @brief Dual integral of last integer optimization
+  *
+  * As Cbc_getPrimalIntegral but for the gap between best possible
+  * objective and final incumbent.
+  *
+  * @param model problem object
+  * @return dual integral (gap seconds)
+  **/
+CBCLIB_EXPORT double CBC_LINKAGE
+Cbc_getDualIntegral(Cbc_Model *model);
+
+/** @brief Primal-dual integral of last integer optimization
+  *
+  * Integral over time of the gap between incumbent and best possible.
+  *
+  * @param model problem object
+  * @return primal-dual integral (gap seconds)
+  **/
+CBCLIB_EXPORT double CBC_LINKAGE
+Cbc_getPrimalDualIntegral(Cbc_Model *model);
+
+/** @brief Seconds until first integer feasible solution (-1 if none) */
+CBCLIB_EXPORT double CBC_LINKAGE
+Cbc_getTimeToFirstSolution(Cbc_Model *model);
+
+/** @brief Seconds until a solution within 1% of the best found (-1 if none) */
+CBCLIB_EXPORT double CBC_LINKAGE
+Cbc_getTimeToOnePercent(Cbc_Model *model);
+
 /*@}*/
 
 /** \name OsiSolverInterface related routines (used in callbacks) */
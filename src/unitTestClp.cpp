@@ -20,6 +20,7 @@
 #include "ClpFactorization.hpp"
 #include "OsiRowCutDebugger.hpp"
 #include "CbcSolver.hpp"
+#include "CbcSolverBenchmark.hpp"
 //#############################################################################
 
 #ifdef NDEBUG
@@ -550,6 +551,13 @@ int CbcClpUnitTest(const CbcModel &saveModel, const std::string &dirMiplibIn,
 #endif
   int totalNodes = 0;
   int totalIterations = 0;
+  // CbcMain0 resets parameters so get benchmark file now
+  std::string benchFile = parameters[CbcParam::BENCHRESULTSFILE]->fileName();
+  int benchSeed = parameters[CbcParam::RANDOMSEED]->intVal();
+#ifdef CBC_THREAD
+  int benchThreads = parameters[CbcParam::THREADS]->intVal();
+#endif
+  CbcBenchmarkRecorder benchRecorder;
   /*
   Open the main loop to step through the MPS problems.
   */
@@ -577,8 +585,19 @@ int CbcClpUnitTest(const CbcModel &saveModel, const std::string &dirMiplibIn,
     // Careful! We're initialising for the benefit of other code.
     CoinDrand48(true, 123456);
     double startTime = CoinCpuTime() + CoinCpuTimeJustChildren();
+    int mainReturnCode = 0;
     if (oldStyle) {
       model = new CbcModel(saveModel);
+      if (benchFile != "") {
+        // so runs can be repeated (CbcMain1 does this for other way)
+        if (benchSeed >= 0)
+          model->setRandomSeed(benchSeed);
+#ifdef CBC_THREAD
+        model->setNumberThreads(benchThreads % 100);
+        model->setThreadMode(benchThreads / 100);
+#endif
+        benchRecorder.start(model);
+      }
       model->solver()->readMps(fn.c_str(), "");
     } else {
       OsiClpSolverInterface solver1;
@@ -623,7 +642,9 @@ int CbcClpUnitTest(const CbcModel &saveModel, const std::string &dirMiplibIn,
 	newInputQueue.push_back("-solve"); 
       model = new CbcModel(solver1);
       CbcMain0(*model, parameters);
-      CbcMain1(newInputQueue, *model, parameters, callBack);
+      if (benchFile != "")
+        benchRecorder.start(model);
+      mainReturnCode = CbcMain1(newInputQueue, *model, parameters, callBack);
     }
     if ((model->getNumRows() != nRows[m] ||
 	 model->getNumCols() != nCols[m]) && model->getNumRows())
@@ -996,6 +1017,14 @@ int CbcClpUnitTest(const CbcModel &saveModel, const std::string &dirMiplibIn,
       << model->getIterationCount() << " i / "
       << timeOfSolution << " s) (subtotal " << timeTaken << " seconds)"
       << std::endl << std::flush;
+    if (benchFile != "") {
+      CbcBenchmarkResult result;
+      benchRecorder.finish(model, mpsName[m], objValue[m], mainReturnCode,
+        result);
+      if (CbcBenchmarkWrite(benchFile, result))
+        std::cout << "Unable to write benchmark results to " << benchFile
+                  << std::endl;
+    }
     delete model;
   }
   /*
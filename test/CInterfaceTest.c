@@ -1083,6 +1083,129 @@ void testTSPUlysses22( char lazy ) {
     Cbc_deleteModel(m);
 }
 
+void testBinaryModel() {
+
+    Cbc_Model *model = Cbc_newModel();
+    Cbc_Model *copy = Cbc_newModel();
+
+    /* Same knapsack as testKnapsack, written in binary format
+       and read back */
+    CoinBigIndex start[] = {0, 1, 2, 3, 4, 5};
+    int rowindex[] = {0, 0, 0, 0, 0};
+    double value[] = {2, 8, 4, 2, 5};
+    double collb[] = {0,0,0,0,0};
+    double colub[] = {1,1,1,1,1};
+    double obj[] = {5, 3, 2, 7, 4};
+    double rowlb[] = {-INFINITY};
+    double rowub[] = {10};
+    char name[20];
+    int i;
+
+    Cbc_loadProblem(model, 5, 1, start, rowindex, value, collb, colub, obj, rowlb, rowub);
+    for (i = 0; i < 5; i++)
+        Cbc_setInteger(model, i);
+    Cbc_setColName(model, 2, "var2");
+    Cbc_setRowName(model, 0, "constr0");
+    Cbc_setObjSense(model, -1);
+
+    assert(Cbc_writeBinary(model, "knapsack.cbcb") == 0);
+    assert(Cbc_readBinary(copy, "knapsack.cbcb") == 0);
+    assert(Cbc_readBinary(copy, "doesNotExist.cbcb") != 0);
+    assert(Cbc_readBinary(copy, "knapsack.cbcb") == 0);
+
+    assert(Cbc_getNumCols(copy) == 5);
+    assert(Cbc_getNumRows(copy) == 1);
+    assert(Cbc_getNumElements(copy) == 5);
+    assert(Cbc_getObjSense(copy) == -1);
+    for (i = 0; i < 5; i++)
+        assert(Cbc_isInteger(copy, i));
+    Cbc_getColName(copy, 2, name, 20);
+    assert(strcmp(name, "var2") == 0);
+    Cbc_getRowName(copy, 0, name, 20);
+    assert(strcmp(name, "constr0") == 0);
+
+    Cbc_solve(copy);
+    assert(Cbc_isProvenOptimal(copy));
+    assert(fabs(Cbc_getObjValue(copy)- (16.0)) < 1e-6);
+
+    remove("knapsack.cbcb");
+    Cbc_deleteModel(model);
+    Cbc_deleteModel(copy);
+}
+
+void testBulkBuild() {
+
+    Cbc_Model *model = Cbc_newModel();
+    Cbc_Model *assigned = Cbc_newModel();
+
+    /* Same knapsack as testKnapsack, built with block methods */
+    CoinBigIndex rowStart[] = {0, 0};
+    double rowlb[] = {-INFINITY};
+    double rowub[] = {10};
+    CoinBigIndex start[] = {0, 1, 2, 3, 4, 5};
+    int rowindex[] = {0, 0, 0, 0, 0};
+    double value[] = {2, 8, 4, 2, 5};
+    double collb[] = {0,0,0,0,0};
+    double colub[] = {1,1,1,1,1};
+    double obj[] = {5, 3, 2, 7, 4};
+    char isInteger[] = {1, 1, 1, 1, 1};
+    const char colNames[] = "x0\0x1\0x2\0x3\0x4";
+    char name[20];
+    int i;
+
+    Cbc_storeNameIndexes(model, 1);
+    Cbc_addRows(model, 1, rowStart, NULL, NULL, rowlb, rowub, "cap");
+    Cbc_addCols(model, 5, start, rowindex, value, collb, colub, obj, isInteger, colNames);
+    Cbc_setObjSense(model, -1);
+
+    assert(Cbc_getNumCols(model) == 5);
+    assert(Cbc_getNumRows(model) == 1);
+    assert(Cbc_getNumElements(model) == 5);
+    assert(Cbc_getColNameIndex(model, "x3") == 3);
+    assert(Cbc_getRowNameIndex(model, "cap") == 0);
+    Cbc_getColName(model, 4, name, 20);
+    assert(strcmp(name, "x4") == 0);
+    for (i = 0; i < 5; i++)
+        assert(Cbc_isInteger(model, i));
+
+    Cbc_solve(model);
+    assert(Cbc_isProvenOptimal(model));
+    assert(fabs(Cbc_getObjValue(model)- (16.0)) < 1e-6);
+
+    /* again, handing arrays over to model */
+    {
+        CoinBigIndex *aStart = Cbc_newBigIndexArray(6);
+        int *aIndex = Cbc_newIntArray(5);
+        double *aValue = Cbc_newDoubleArray(5);
+        double *aCollb = Cbc_newDoubleArray(5);
+        double *aColub = Cbc_newDoubleArray(5);
+        double *aObj = Cbc_newDoubleArray(5);
+        double *aRowlb = Cbc_newDoubleArray(1);
+        double *aRowub = Cbc_newDoubleArray(1);
+        memcpy(aStart, start, sizeof(start));
+        memcpy(aIndex, rowindex, sizeof(rowindex));
+        memcpy(aValue, value, sizeof(value));
+        memcpy(aCollb, collb, sizeof(collb));
+        memcpy(aColub, colub, sizeof(colub));
+        memcpy(aObj, obj, sizeof(obj));
+        aRowlb[0] = rowlb[0];
+        aRowub[0] = rowub[0];
+        Cbc_assignProblem(assigned, 5, 1, aStart, aIndex, aValue, aCollb, aColub,
+            aObj, aRowlb, aRowub, isInteger, colNames, "cap");
+    }
+    Cbc_setObjSense(assigned, -1);
+    assert(Cbc_getNumElements(assigned) == 5);
+    Cbc_getRowName(assigned, 0, name, 20);
+    assert(strcmp(name, "cap") == 0);
+
+    Cbc_solve(assigned);
+    assert(Cbc_isProvenOptimal(assigned));
+    assert(fabs(Cbc_getObjValue(assigned)- (16.0)) < 1e-6);
+
+    Cbc_deleteModel(model);
+    Cbc_deleteModel(assigned);
+}
+
 int main() {
     printf("\nStarting C Interface test.\n\n");
     char buildInfo[1024];
@@ -1092,6 +1215,10 @@ int main() {
 
     printf("Knapsack test\n");
     testKnapsack();
+    printf("Binary model test\n");
+    testBinaryModel();
+    printf("Bulk build test\n");
+    testBulkBuild();
     printf("SOS test\n");
     testSOS();
     printf("Infeasible test\n");
@@ -0,0 +1,187 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#pragma warning(disable : 4786)
+#endif
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+using namespace std;
+#include "CoinHelperFunctions.hpp"
+#include "CoinModel.hpp"
+#include "CbcModel.hpp"
+#include "CbcFathomDynamicProgramming.hpp"
+#include "OsiClpSolverInterface.hpp"
+#define testtol 1e-6
+/** Random model for dynamic programming - binary columns with
+ * coefficients 1 (or 2 if rhs allows) and rows either equality or
+ * less than or equal with rhs from 1 to maxRhs */
+void randomModel(CoinModel &build, int numberRows, int numberColumns,
+  int maxRhs, unsigned int seed);
+/** Best objective by trying all 0-1 vectors (COIN_DBL_MAX if infeasible) */
+double bruteForce(const CoinModel &build);
+/** Solves model by dynamic programming with given state mode and threads
+ * and checks answer against brute force */
+void checkFathom(const CoinModel &build, double best, int stateMode,
+  int numberThreads, const char *name, int &error_count);
+int main(int argc, const char *argv[])
+{
+  WindowsErrorPopupBlocker();
+  int error_count = 0;
+  int numberModels = 0;
+  const char *modeName[] = { "dense", "sparse" };
+
+  // small models and then ones big enough for sweeps to use threads
+  for (int size = 0; size < 2; size++) {
+    int numberRows = size ? 10 : 6;
+    int numberColumns = size ? 16 : 14;
+    for (unsigned int seed = 1; seed <= 8; seed++) {
+      CoinModel build;
+      randomModel(build, numberRows, numberColumns, 3, seed);
+      double best = bruteForce(build);
+      for (int mode = 0; mode < 2; mode++) {
+        for (int threads = 1; threads <= 4; threads += 3) {
+          char name[80];
+          sprintf(name, "seed %u rows %d %s with %d thread%s", seed, numberRows,
+            modeName[mode], threads, threads > 1 ? "s" : "");
+          checkFathom(build, best, mode + 1, threads, name, error_count);
+        }
+      }
+      numberModels++;
+    }
+  }
+
+  cout << endl
+       << "Finished - there have been " << error_count << " errors on "
+       << numberModels << " models." << endl;
+  return error_count;
+}
+void randomModel(CoinModel &build, int numberRows, int numberColumns,
+  int maxRhs, unsigned int seed)
+{
+  srand(seed);
+  int *rhs = new int[numberRows];
+  for (int iRow = 0; iRow < numberRows; iRow++) {
+    rhs[iRow] = 1 + rand() % maxRhs;
+    if (rand() % 3)
+      build.setRowBounds(iRow, -COIN_DBL_MAX, rhs[iRow]);
+    else
+      build.setRowBounds(iRow, rhs[iRow], rhs[iRow]);
+  }
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    build.setColumnBounds(iColumn, 0.0, 1.0);
+    build.setColumnIsInteger(iColumn, true);
+    int n = 0;
+    for (int iRow = 0; iRow < numberRows; iRow++) {
+      if (rand() % 3 == 0) {
+        int value = (rhs[iRow] > 1 && rand() % 2) ? 2 : 1;
+        build.setElement(iRow, iColumn, value);
+        n++;
+      }
+    }
+    if (!n)
+      build.setElement(rand() % numberRows, iColumn, 1.0);
+    // negative costs so less than or equal rows matter
+    build.setColumnObjective(iColumn, -10 + rand() % 20);
+  }
+  delete[] rhs;
+}
+double bruteForce(const CoinModel &build)
+{
+  int numberRows = build.numberRows();
+  int numberColumns = build.numberColumns();
+  double best = COIN_DBL_MAX;
+  // dense copy of matrix
+  double *element = new double[numberRows * numberColumns];
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    for (int iRow = 0; iRow < numberRows; iRow++)
+      element[iColumn * numberRows + iRow] = build.getElement(iRow, iColumn);
+  }
+  double *activity = new double[numberRows];
+  for (int pattern = 0; pattern < (1 << numberColumns); pattern++) {
+    CoinZeroN(activity, numberRows);
+    double objective = 0.0;
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+      if ((pattern & (1 << iColumn)) != 0) {
+        objective += build.getColumnObjective(iColumn);
+        for (int iRow = 0; iRow < numberRows; iRow++)
+          activity[iRow] += element[iColumn * numberRows + iRow];
+      }
+    }
+    bool feasible = true;
+    for (int iRow = 0; iRow < numberRows; iRow++) {
+      if (activity[iRow] < build.getRowLower(iRow) - testtol || activity[iRow] > build.getRowUpper(iRow) + testtol) {
+        feasible = false;
+        break;
+      }
+    }
+    if (feasible && objective < best)
+      best = objective;
+  }
+  delete[] element;
+  delete[] activity;
+  return best;
+}
+void checkFathom(const CoinModel &build, double best, int stateMode,
+  int numberThreads, const char *name, int &error_count)
+{
+  OsiClpSolverInterface solver;
+  CoinModel copy(build);
+  solver.loadFromCoinModel(copy);
+  int numberRows = build.numberRows();
+  int numberColumns = build.numberColumns();
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+    solver.setInteger(iColumn);
+  CbcModel model(solver);
+  model.messageHandler()->setLogLevel(0);
+  CbcFathomDynamicProgramming fathom(model);
+  fathom.setMaximumSize(100000000);
+  fathom.setStateMode(stateMode);
+  fathom.setNumberThreads(numberThreads);
+  double *solution = NULL;
+  int returnCode = fathom.fathom(solution);
+  if (returnCode != 1) {
+    cerr << name << ": search not complete (return code " << returnCode << ")" << endl;
+    error_count++;
+  } else if (best == COIN_DBL_MAX) {
+    if (solution) {
+      cerr << name << ": solution found for infeasible model" << endl;
+      error_count++;
+    }
+  } else if (!solution) {
+    cerr << name << ": no solution but best is " << best << endl;
+    error_count++;
+  } else {
+    double objective = 0.0;
+    bool feasible = true;
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+      double value = solution[iColumn];
+      if (value != 0.0 && value != 1.0)
+        feasible = false;
+      objective += value * build.getColumnObjective(iColumn);
+    }
+    for (int iRow = 0; iRow < numberRows; iRow++) {
+      double activity = 0.0;
+      for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+        activity += solution[iColumn] * build.getElement(iRow, iColumn);
+      if (activity < build.getRowLower(iRow) - testtol || activity > build.getRowUpper(iRow) + testtol)
+        feasible = false;
+    }
+    if (!feasible) {
+      cerr << name << ": solution infeasible" << endl;
+      error_count++;
+    } else if (fabs(objective - best) > testtol) {
+      cerr << name << ": objective " << objective << " but best is " << best << endl;
+      error_count++;
+    }
+  }
+  delete[] solution;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/